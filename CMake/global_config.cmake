@@ -41,6 +41,10 @@ macro(global_set_flags)
         add_definitions(-DTRACE_API)
     endif()
 
+    if(TRACE_API_ALL_CALLS)
+        add_definitions(-DTRACE_API_ALL_CALLS)
+    endif()
+
     if(HWM_OVER_XU)
         add_definitions(-DHWM_OVER_XU)
     endif()
@@ -61,6 +65,10 @@ macro(global_set_flags)
         add_definitions(-DBUILD_SHARED_LIBS)
     endif()
 
+    if (BUILD_WITH_LOCKFREE_QUEUES)
+        add_definitions(-DRS2_LOCKFREE_QUEUES)
+    endif()
+
     if (BUILD_INTERNAL_UNIT_TESTS)
         add_definitions(-DBUILD_INTERNAL_UNIT_TESTS)
     endif()
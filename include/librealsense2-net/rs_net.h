@@ -23,6 +23,14 @@ extern "C" {
  */
 rs2_device* rs2_create_net_device(int api_version, const char* address, rs2_error** error);
 
+/**
+ * Limit the number of buffers net devices receive frames of each size into (100 by default). When the application and the
+ * frame queues hold that many, further frames of that size are dropped until buffers are released; streaming goes on.
+ * \param[in] max_buffers   buffers of each size, at least 1
+ * \param[out] error  if non-null, receives any error that occurs during this call, otherwise, errors are ignored
+ */
+void rs2_net_device_set_max_frame_buffers(int max_buffers, rs2_error** error);
+
 #ifdef __cplusplus
 }
 #endif
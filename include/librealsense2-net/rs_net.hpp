@@ -30,6 +30,20 @@ namespace rs2
                 error::handle(e);
             }
 
+            /**
+            * Limit the number of buffers net devices receive frames of each size into (100 by default). Once the
+            * application and the frame queues hold that many, further frames of that size are dropped until buffers are
+            * released.
+            *
+            * \param[in] max_buffers   buffers of each size, at least 1
+            */
+            static void set_max_frame_buffers(int max_buffers)
+            {
+                rs2_error* e = nullptr;
+                rs2_net_device_set_max_frame_buffers(max_buffers, &e);
+                error::handle(e);
+            }
+
 
         private:
             std::shared_ptr<rs2_device> init(const std::string& address)
@@ -80,6 +80,17 @@ void rs2_context_remove_device(rs2_context* ctx, const char* file, rs2_error** e
  */
 void rs2_context_unload_tracking_module(rs2_context* ctx, rs2_error** error);
 
+/**
+ * Configures the worker threads that processing blocks attached to the context (see rs2_processing_block_attach_executor)
+ * process frames on. Blocks already attached keep using the previous threads until they are attached again.
+ * \param[in]  ctx        The context
+ * \param[in]  threads    Number of worker threads, or 0 for one per hardware thread (the default)
+ * \param[in]  cpus       CPUs to pin the worker threads to in turn, or null to leave them unpinned
+ * \param[in]  cpus_count Number of entries in cpus
+ * \param[out] error      If non-null, receives any error that occurs during this call, otherwise, errors are ignored
+ */
+void rs2_context_set_executor(rs2_context* ctx, int threads, const int* cpus, int cpus_count, rs2_error** error);
+
 /**
 * create a static snapshot of all connected devices at the time of the call
 * \param context     Object representing librealsense session
@@ -237,6 +237,46 @@ rs2_vertex* rs2_get_frame_vertices(const rs2_frame* frame, rs2_error** error);
 */
 void rs2_export_to_ply(const rs2_frame* frame, const char* fname, rs2_frame* texture, rs2_error** error);
 
+/**
+* When called on Points frame type, this method creates a binary ply file of the model with the given file name, with or without the mesh and its normals.
+* Rows of the point cloud are processed in parallel. To export a sequence of clouds without allocating for each, use rs2_ply_exporter_export.
+* \param[in] frame       Points frame
+* \param[in] fname       The name for the ply file
+* \param[in] texture     Texture frame, or null for no colors
+* \param[in] mesh        Non-zero to write the faces joining neighbouring vertices
+* \param[in] normals     Non-zero to write the normal of each vertex (with the mesh only)
+* \param[in] threshold   Faces are only made of vertices whose depths differ less than this, in meters
+* \param[out] error      If non-null, receives any error that occurs during this call, otherwise, errors are ignored
+*/
+void rs2_export_to_ply_ex(const rs2_frame* frame, const char* fname, rs2_frame* texture, int mesh, int normals, float threshold, rs2_error** error);
+
+/**
+* Create a PLY exporter: it keeps the buffers of an export for the next one, so that exporting a sequence of point clouds of the same size does not allocate.
+* An exporter is used by one thread at a time.
+* \param[out] error     If non-null, receives any error that occurs during this call, otherwise, errors are ignored
+* \return               The exporter, to be released with rs2_delete_ply_exporter
+*/
+rs2_ply_exporter* rs2_create_ply_exporter(rs2_error** error);
+
+/**
+* Delete a PLY exporter and release its buffers
+* \param[in] exporter   The exporter
+*/
+void rs2_delete_ply_exporter(rs2_ply_exporter* exporter);
+
+/**
+* Create a binary ply file of a Points frame, as rs2_export_to_ply_ex, with the buffers of the given exporter
+* \param[in] exporter   The exporter
+* \param[in] frame      Points frame
+* \param[in] fname      The name for the ply file
+* \param[in] texture    Texture frame, or null for no colors
+* \param[in] mesh       Non-zero to write the faces joining neighbouring vertices
+* \param[in] normals    Non-zero to write the normal of each vertex (with the mesh only)
+* \param[in] threshold  Faces are only made of vertices whose depths differ less than this, in meters
+* \param[out] error     If non-null, receives any error that occurs during this call, otherwise, errors are ignored
+*/
+void rs2_ply_exporter_export(rs2_ply_exporter* exporter, const rs2_frame* frame, const char* fname, rs2_frame* texture, int mesh, int normals, float threshold, rs2_error** error);
+
 /**
 * When called on Points frame type, this method returns a pointer to an array of texture coordinates per vertex
 * Each coordinate represent a (u,v) pair within [0,1] range, to be mapped to texture image
@@ -359,6 +399,23 @@ void rs2_synthetic_frame_ready(rs2_source* source, rs2_frame* frame, rs2_error**
 */
 void rs2_pose_frame_get_pose_data(const rs2_frame* frame, rs2_pose* pose, rs2_error** error);
 
+/**
+* retrieve the number of IMU samples a motion frame carries: more than one when the sensor's RS2_OPTION_MOTION_SAMPLES_PER_FRAME is.
+* The samples of an RS2_FORMAT_MOTION_XYZ32F frame are contiguous rs2_vector values at the start of its data
+* \param[in] frame      Motion frame
+* \param[out] error     If non-null, receives any error that occurs during this call, otherwise, errors are ignored
+* \return               number of samples
+*/
+int rs2_get_motion_frame_sample_count(const rs2_frame* frame, rs2_error** error);
+
+/**
+* retrieve the timestamps of the samples of a motion frame, in the domain of the frame's timestamp, which is the one of its last sample
+* \param[in] frame      Motion frame
+* \param[out] error     If non-null, receives any error that occurs during this call, otherwise, errors are ignored
+* \return               array of rs2_get_motion_frame_sample_count() timestamps, in milliseconds, valid as long as the frame is
+*/
+const double* rs2_get_motion_frame_sample_timestamps(const rs2_frame* frame, rs2_error** error);
+
 /**
 * Extract the target dimensions on the specific target
 * \param[in] frame            Left or right camera frame of specified size based on the target type
@@ -116,6 +116,9 @@ extern "C" {
         RS2_OPTION_AUTO_EXPOSURE_LIMIT_TOGGLE, /**< Enable / disable color image auto-exposure*/
         RS2_OPTION_AUTO_GAIN_LIMIT_TOGGLE, /**< Enable / disable color image auto-gain*/
         RS2_OPTION_EMITTER_FREQUENCY, /**< Select emitter (laser projector) frequency, see rs2_emitter_frequency for values */
+        RS2_OPTION_ZERO_COPY, /**< Deliver frames that reference the driver's buffers directly instead of a copy of them. Takes effect when the sensor is next opened */
+        RS2_OPTION_MOTION_SAMPLES_PER_FRAME, /**< Number of IMU samples each motion frame carries, see rs2_get_motion_frame_sample_count. Takes effect when the sensor is next started */
+        RS2_OPTION_CONTROL_CACHE_MAX_AGE, /**< Milliseconds for which a control value read from the camera is reused instead of read again, 0 to always read it. See rs2_get_control_cache_statistics */
         RS2_OPTION_COUNT /**< Number of enumeration values. Not a valid input: intended to be used in for-loops. */
     } rs2_option;
 
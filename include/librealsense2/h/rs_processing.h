@@ -131,6 +131,26 @@ void rs2_start_processing(rs2_processing_block* block, rs2_frame_callback* on_fr
 */
 void rs2_start_processing_fptr(rs2_processing_block* block, rs2_frame_callback_ptr on_frame, void* user, rs2_error** error);
 
+/**
+* This method provides the buffers that video, depth and disparity frames produced by the processing block are written to.
+* Buffers are obtained from on_allocate, and returned through on_deallocate when the last reference to the frame is released.
+* If on_allocate returns null, the frame falls back to an internally allocated buffer.
+* \param[in] block          Processing block
+* \param[in] on_allocate    Function returning a buffer of at least the given size in bytes
+* \param[in] on_deallocate  Function receiving back a buffer obtained from on_allocate, together with its size
+* \param[in] user           User context for the allocator (can be anything or null)
+* \param[out] error  if non-null, receives any error that occurs during this call, otherwise, errors are ignored
+*/
+void rs2_set_processing_block_frame_allocator(rs2_processing_block* block, rs2_frame_allocate_ptr on_allocate, rs2_frame_deallocate_ptr on_deallocate, void* user, rs2_error** error);
+
+/**
+* This method provides the buffers that frames produced by the processing block are written to (see rs2_set_processing_block_frame_allocator)
+* \param[in] block          Processing block
+* \param[in] allocator      Allocator object created from c++ application. ownership over the allocator object is moved into the block
+* \param[out] error  if non-null, receives any error that occurs during this call, otherwise, errors are ignored
+*/
+void rs2_set_processing_block_frame_allocator_cpp(rs2_processing_block* block, rs2_frame_allocator* allocator, rs2_error** error);
+
 /**
 * This method is used to direct the output from the processing block to a dedicated queue object
 * \param[in] block          Processing block
@@ -147,6 +167,46 @@ void rs2_start_processing_queue(rs2_processing_block* block, rs2_frame_queue* qu
 */
 void rs2_process_frame(rs2_processing_block* block, rs2_frame* frame, rs2_error** error);
 
+/**
+* This method is used to pass frame into a processing block and have it processed before returning, on the caller's thread,
+* even when the block is attached to an executor (see rs2_processing_block_attach_executor)
+* \param[in] block          Processing block
+* \param[in] frame          Frame to process, ownership is moved to the block object
+* \param[out] error  if non-null, receives any error that occurs during this call, otherwise, errors are ignored
+*/
+void rs2_process_frame_sync(rs2_processing_block* block, rs2_frame* frame, rs2_error** error);
+
+/**
+* Have frames passed to the processing block processed on the worker threads of a context (see rs2_context_set_executor)
+* rather than on the caller's thread; rs2_process_frame then returns immediately. Frames of a block are processed one at a
+* time, unless it is stateless (see rs2_processing_block_set_stateless), and its results are delivered in order, while
+* different blocks run in parallel. If frames arrive faster than the block can process them, the oldest waiting frames are
+* dropped.
+* \param[in] block          Processing block
+* \param[in] ctx            Context whose executor to use, or null to process frames on the caller's thread again
+* \param[out] error  if non-null, receives any error that occurs during this call, otherwise, errors are ignored
+*/
+void rs2_processing_block_attach_executor(rs2_processing_block* block, rs2_context* ctx, rs2_error** error);
+
+/**
+* Check whether the processing block is attached to an executor (see rs2_processing_block_attach_executor)
+* \param[in] block          Processing block
+* \param[out] error  if non-null, receives any error that occurs during this call, otherwise, errors are ignored
+* \return true if frames passed to the block are processed asynchronously
+*/
+int rs2_processing_block_uses_executor(rs2_processing_block* block, rs2_error** error);
+
+/**
+* Declare that the processing block keeps no state from one frame to the next, so that once attached to an executor it
+* may process several frames at the same time. Its results are still delivered in the order the frames were passed in.
+* Takes effect the next time the block is attached (see rs2_processing_block_attach_executor). Only blocks made with
+* rs2_create_processing_block can be declared stateless; the built-in blocks keep state between frames.
+* \param[in] block          Processing block made with rs2_create_processing_block
+* \param[in] stateless      Non-zero if the block may process several frames at once
+* \param[out] error  if non-null, receives any error that occurs during this call, otherwise, errors are ignored
+*/
+void rs2_processing_block_set_stateless(rs2_processing_block* block, int stateless, rs2_error** error);
+
 /**
 * Deletes the processing block
 * \param[in] block          Processing block
@@ -203,6 +263,36 @@ int rs2_poll_for_frame(rs2_frame_queue* queue, rs2_frame** output_frame, rs2_err
 */
 int rs2_try_wait_for_frame(rs2_frame_queue* queue, unsigned int timeout_ms, rs2_frame** output_frame, rs2_error** error);
 
+/**
+* dequeue all frames available in the queue, up to max_frames, at once
+* \param[in] queue          the frame queue data structure
+* \param[out] output_frames array of at least max_frames frame handles, each to be released using rs2_release_frame
+* \param[in] max_frames     max number of frames to dequeue
+* \param[out] error         if non-null, receives any error that occurs during this call, otherwise, errors are ignored
+* \return number of frames stored to output_frames
+*/
+int rs2_poll_for_frames_batch(rs2_frame_queue* queue, rs2_frame** output_frames, int max_frames, rs2_error** error);
+
+/**
+* wait until frames become available in the queue and dequeue them, up to max_frames, at once
+* \param[in] queue          the frame queue data structure
+* \param[in] timeout_ms     max time in milliseconds to wait until a frame becomes available
+* \param[out] output_frames array of at least max_frames frame handles, each to be released using rs2_release_frame
+* \param[in] max_frames     max number of frames to dequeue
+* \param[out] error         if non-null, receives any error that occurs during this call, otherwise, errors are ignored
+* \return number of frames stored to output_frames (0 on timeout)
+*/
+int rs2_try_wait_for_frames_batch(rs2_frame_queue* queue, unsigned int timeout_ms, rs2_frame** output_frames, int max_frames, rs2_error** error);
+
+/**
+* have a consumer waiting on the queue woken only once enough frames accumulated, to cut down on wake-ups at high frame rates
+* \param[in] queue          the frame queue data structure
+* \param[in] frames         wake once this many frames are queued (1, the default, wakes for every frame)
+* \param[in] latency_us     ... or once the first queued frame waited this many microseconds
+* \param[out] error         if non-null, receives any error that occurs during this call, otherwise, errors are ignored
+*/
+void rs2_set_frame_queue_wake_threshold(rs2_frame_queue* queue, int frames, unsigned int latency_us, rs2_error** error);
+
 /**
 * enqueue new frame into a queue
 * \param[in] frame frame handle to enqueue (this operation passed ownership to the queue)
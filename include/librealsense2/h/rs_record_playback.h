@@ -29,6 +29,16 @@ const char* rs2_playback_status_to_string(rs2_playback_status status);
 
 typedef void (*rs2_playback_status_changed_callback_ptr)(rs2_playback_status);
 
+/** \brief Counters of the frames going through the write queue of a recording device */
+typedef struct rs2_record_statistics
+{
+    unsigned long long queued_bytes;     /**< Frame data waiting to be written to the file */
+    unsigned long long written_frames;   /**< Frames written to the file */
+    unsigned long long dropped_frames;   /**< Frames dropped because the write queue was over its budget */
+    double max_write_latency;            /**< Longest time, in milliseconds, from a frame's arrival to its write completing */
+    double average_write_latency;        /**< Average time, in milliseconds, from a frame's arrival to its write completing */
+} rs2_record_statistics;
+
 /**
  * Creates a recording device to record the given device and save it to the given file
  * \param[in]  device    The device to record
@@ -71,6 +81,34 @@ void rs2_record_device_resume(const rs2_device* device, rs2_error** error);
 */
 const char* rs2_record_device_filename(const rs2_device* device, rs2_error** error);
 
+/**
+* Gets the counters of the frames going through the write queue of the recording device
+* \param[in]  device    A recording device
+* \param[out] stats     The counters since the recording started
+* \param[out] error     If non-null, receives any error that occurs during this call, otherwise, errors are ignored
+*/
+void rs2_record_device_get_statistics(const rs2_device* device, rs2_record_statistics* stats, rs2_error** error);
+
+/**
+* Sets the budget of the write queue of the recording device. Frames arriving while the frame data waiting to be
+* written exceeds it are dropped, so that a slow disk does not make the queue grow without bound.
+* The default is about one second of 1080p RGBA video at 30 FPS.
+* \param[in]  device                A recording device
+* \param[in]  max_cached_data_size  The most frame data, in bytes, to keep waiting to be written; must be positive
+* \param[out] error     If non-null, receives any error that occurs during this call, otherwise, errors are ignored
+*/
+void rs2_record_device_set_max_cached_data_size(const rs2_device* device, unsigned long long max_cached_data_size, rs2_error** error);
+
+/**
+* Enables or disables writing a copy of the message index of the file to a sidecar file ("<file>.idx") when the recording
+* ends. Playback with the sidecar enabled then loads the index in one sequential read instead of seeking through the whole
+* file. Disabled by default.
+* \param[in]  device    A recording device
+* \param[in]  enabled   0 means false, otherwise true
+* \param[out] error     If non-null, receives any error that occurs during this call, otherwise, errors are ignored
+*/
+void rs2_record_device_set_index_file(const rs2_device* device, int enabled, rs2_error** error);
+
 /**
 * Creates a playback device to play the content of the given file
 * \param[in]  file      Path to the file to play
@@ -150,6 +188,26 @@ void rs2_playback_device_set_real_time(const rs2_device* device, int real_time,
  */
 int rs2_playback_device_is_real_time(const rs2_device* device, rs2_error** error);
 
+/**
+ * Enables or disables the index sidecar file ("<file>.idx") of the played file. When enabled, the message index is loaded from
+ * the sidecar if it matches the file, and the sidecar is created or replaced otherwise; a sidecar that cannot be written is
+ * not an error. Applies from the next time the file is reopened, when the playback is stopped or resumed. Disabled by default.
+ * \param[in] device    A playback device
+ * \param[in] enabled   0 means false, otherwise true
+ * \param[out] error     If non-null, receives any error that occurs during this call, otherwise, errors are ignored
+ */
+void rs2_playback_device_set_index_file(const rs2_device* device, int enabled, rs2_error** error);
+
+/**
+ * Sets how much data a playback device in non real time mode may read from the file ahead of the frames it raises, on a
+ * background thread, so that reading and decompressing the file overlaps with the handling of the previous frames.
+ * Real time playback does not read ahead. The default is 256MB.
+ * \param[in] device    A playback device
+ * \param[in] bytes     The most data, in bytes, to read ahead; 0 disables reading ahead
+ * \param[out] error     If non-null, receives any error that occurs during this call, otherwise, errors are ignored
+ */
+void rs2_playback_device_set_read_ahead(const rs2_device* device, unsigned long long bytes, rs2_error** error);
+
 /**
  * Register to receive callback from playback device upon its status changes
  *
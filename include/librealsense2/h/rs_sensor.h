@@ -101,6 +101,23 @@ typedef struct rs2_extrinsics
     float translation[3]; /**< Three-element translation vector, in meters */
 } rs2_extrinsics;
 
+/** \brief Counters of how well a sensor recycles the buffers of its frames */
+typedef struct rs2_frame_pool_statistics
+{
+    unsigned long long hits;       /**< Frames whose buffer was recycled from a released frame */
+    unsigned long long misses;     /**< Frames that needed a new buffer */
+    unsigned long long evictions;  /**< Released buffers freed because they were not reused in time */
+    unsigned long long pooled;     /**< Released buffers currently waiting to be reused */
+} rs2_frame_pool_statistics;
+
+/** \brief Counters of how many control transfers the caching of a sensor's option values and ranges saved */
+typedef struct rs2_control_cache_statistics
+{
+    unsigned long long transfers;     /**< Control transfers made: value and range queries, and sets */
+    unsigned long long values_saved;  /**< Value queries answered from the cache */
+    unsigned long long ranges_saved;  /**< Range queries answered from the cache */
+} rs2_control_cache_statistics;
+
 /**
 * Deletes sensors list, any sensors created from this list will remain unaffected
 * \param[in] info_list list to delete
@@ -256,6 +273,47 @@ void rs2_start_cpp(const rs2_sensor* sensor, rs2_frame_callback* callback, rs2_e
 */
 void rs2_start_queue(const rs2_sensor* sensor, rs2_frame_queue* queue, rs2_error** error);
 
+/**
+* provide the buffers that frames of the specified sensor will be written to. Once set, every video, depth or disparity
+* frame the sensor produces gets its pixel buffer from on_allocate, and returns it through on_deallocate when the last
+* reference to the frame is released. This allows frames to be placed in hugepage-backed, DMA-pinned or shared memory.
+* Buffers obtained from the allocator are not recycled by the library. If on_allocate returns null, the frame falls back
+* to an internally allocated buffer. Must be called while the sensor is not streaming.
+* \param[in] sensor         RealSense sensor
+* \param[in] on_allocate    function pointer returning a buffer of at least the given size in bytes
+* \param[in] on_deallocate  function pointer receiving back a buffer obtained from on_allocate, together with its size
+* \param[in] user           auxiliary data the user wishes to receive together with every allocator call
+* \param[out] error         if non-null, receives any error that occurs during this call, otherwise, errors are ignored
+*/
+void rs2_set_frame_allocator(const rs2_sensor* sensor, rs2_frame_allocate_ptr on_allocate, rs2_frame_deallocate_ptr on_deallocate, void* user, rs2_error** error);
+
+/**
+* provide the buffers that frames of the specified sensor will be written to (see rs2_set_frame_allocator)
+* \param[in] sensor     RealSense sensor
+* \param[in] allocator  allocator object created from c++ application. ownership over the allocator object is moved into the sensor
+* \param[out] error     if non-null, receives any error that occurs during this call, otherwise, errors are ignored
+*/
+void rs2_set_frame_allocator_cpp(const rs2_sensor* sensor, rs2_frame_allocator* allocator, rs2_error** error);
+
+/**
+* retrieve the counters of the buffers the frames of the specified sensor are written to. Released frames keep their
+* buffer for a later frame of the same size; frames written to buffers of a user-supplied allocator are not counted.
+* \param[in] sensor     RealSense sensor
+* \param[out] stats     The counters since the sensor was last opened
+* \param[out] error     if non-null, receives any error that occurs during this call, otherwise, errors are ignored
+*/
+void rs2_get_frame_pool_statistics(const rs2_sensor* sensor, rs2_frame_pool_statistics* stats, rs2_error** error);
+
+/**
+* retrieve the counters of the control transfers the options of the specified sensor made and saved. Values are
+* reused for RS2_OPTION_CONTROL_CACHE_MAX_AGE milliseconds, and ranges for as long as the sensor exists. The counters
+* are all zero for sensors whose options are not cached.
+* \param[in] sensor     RealSense sensor
+* \param[out] stats     The counters since the sensor was created
+* \param[out] error     if non-null, receives any error that occurs during this call, otherwise, errors are ignored
+*/
+void rs2_get_control_cache_statistics(const rs2_sensor* sensor, rs2_control_cache_statistics* stats, rs2_error** error);
+
 /**
 * stops streaming from specified configured device
 * \param[in] sensor  RealSense sensor
@@ -9,6 +9,8 @@
 #ifndef LIBREALSENSE_RS2_TYPES_H
 #define LIBREALSENSE_RS2_TYPES_H
 
+#include <stddef.h>
+
 #ifdef __cplusplus
 extern "C" {
 #endif
@@ -261,6 +263,7 @@ typedef struct rs2_log_message rs2_log_message;
 typedef struct rs2_raw_data_buffer rs2_raw_data_buffer;
 typedef struct rs2_frame rs2_frame;
 typedef struct rs2_frame_queue rs2_frame_queue;
+typedef struct rs2_ply_exporter rs2_ply_exporter;
 typedef struct rs2_pipeline rs2_pipeline;
 typedef struct rs2_pipeline_profile rs2_pipeline_profile;
 typedef struct rs2_config rs2_config;
@@ -269,6 +272,7 @@ typedef struct rs2_stream_profile_list rs2_stream_profile_list;
 typedef struct rs2_processing_block_list rs2_processing_block_list;
 typedef struct rs2_stream_profile rs2_stream_profile;
 typedef struct rs2_frame_callback rs2_frame_callback;
+typedef struct rs2_frame_allocator rs2_frame_allocator;
 typedef struct rs2_log_callback rs2_log_callback;
 typedef struct rs2_syncer rs2_syncer;
 typedef struct rs2_device_serializer rs2_device_serializer;
@@ -296,6 +300,8 @@ typedef void(*rs2_software_device_destruction_callback_ptr)(void*);
 typedef void (*rs2_devices_changed_callback_ptr)(rs2_device_list*, rs2_device_list*, void*);
 typedef void (*rs2_frame_callback_ptr)(rs2_frame*, void*);
 typedef void (*rs2_frame_processor_callback_ptr)(rs2_frame*, rs2_source*, void*);
+typedef void* (*rs2_frame_allocate_ptr)(size_t size, void*);
+typedef void (*rs2_frame_deallocate_ptr)(void* buffer, size_t size, void*);
 typedef void(*rs2_update_progress_callback_ptr)(const float, void*);
 
 typedef double      rs2_time_t;     /**< Timestamp format. units are milliseconds */
@@ -206,6 +206,31 @@ namespace rs2
             rs2::error::handle(e);
         }
 
+        /**
+        * Configure the worker threads that processing blocks attached to this context process frames on
+        * \param[in] threads   number of worker threads, or 0 for one per hardware thread
+        * \param[in] cpus      CPUs to pin the worker threads to in turn; empty to leave them unpinned
+        */
+        void set_executor(int threads, const std::vector<int>& cpus = {}) const
+        {
+            rs2_error* e = nullptr;
+            rs2_context_set_executor(_context.get(), threads, cpus.empty() ? nullptr : cpus.data(), static_cast<int>(cpus.size()), &e);
+            rs2::error::handle(e);
+        }
+
+        /**
+        * Have frames passed to a processing block processed on the worker threads of this context rather than on
+        * the caller's thread. Frames of the block are still processed one at a time, unless it is stateless (see
+        * processing_block::set_stateless), and its results delivered in order.
+        * \param[in] block     processing block to attach; use processing_block::detach_executor to undo
+        */
+        void attach_executor(const processing_block& block) const
+        {
+            rs2_error* e = nullptr;
+            rs2_processing_block_attach_executor(block.get(), _context.get(), &e);
+            rs2::error::handle(e);
+        }
+
         context(std::shared_ptr<rs2_context> ctx)
             : _context(ctx)
         {}
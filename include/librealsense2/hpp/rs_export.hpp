@@ -79,6 +79,13 @@ namespace rs2
             bool mesh = get_option(OPTION_PLY_MESH) != 0;
             bool binary = get_option(OPTION_PLY_BINARY) != 0;
             bool use_normals = get_option(OPTION_PLY_NORMALS) != 0;
+            const auto threshold = get_option(OPTION_PLY_THRESHOLD);
+            if (binary)
+            {
+                p.export_to_ply(_exporter, fname, use_texcoords ? color : video_frame(frame()), mesh, use_normals, threshold);
+                return;
+            }
+
             const auto verts = p.get_vertices();
             const auto texcoords = p.get_texture_coordinates();
             const uint8_t* texture_data;
@@ -111,7 +118,6 @@ namespace rs2
 
             auto profile = p.get_profile().as<video_stream_profile>();
             auto width = profile.width(), height = profile.height();
-            static const auto threshold = get_option(OPTION_PLY_THRESHOLD);
             std::vector<std::array<size_t, 3>> faces;
             if (mesh)
             {
@@ -170,10 +176,7 @@ namespace rs2
 
             std::ofstream out(fname);
             out << "ply\n";
-            if (binary)
-                out << "format binary_little_endian 1.0\n";
-            else
-                out << "format ascii 1.0\n";
+            out << "format ascii 1.0\n";
             out << "comment pointcloud saved from Realsense Viewer\n";
             out << "element vertex " << new_verts.size() << "\n";
             out << "property float" << sizeof(float) * 8 << " x\n";
@@ -198,79 +201,39 @@ namespace rs2
             }
             out << "end_header\n";
 
-            if (binary)
+            for (size_t i = 0; i <new_verts.size(); ++i)
             {
-                out.close();
-                out.open(fname, std::ios_base::app | std::ios_base::binary);
-                for (size_t i = 0; i < new_verts.size(); ++i)
-                {
-                    // we assume little endian architecture on your device
-                    out.write(reinterpret_cast<const char*>(&(new_verts[i].x)), sizeof(float));
-                    out.write(reinterpret_cast<const char*>(&(new_verts[i].y)), sizeof(float));
-                    out.write(reinterpret_cast<const char*>(&(new_verts[i].z)), sizeof(float));
+                out << new_verts[i].x << " ";
+                out << new_verts[i].y << " ";
+                out << new_verts[i].z << " ";
+                out << "\n";
 
-                    if (mesh && use_normals)
-                    {
-                        out.write(reinterpret_cast<const char*>(&(normals[i].x)), sizeof(float));
-                        out.write(reinterpret_cast<const char*>(&(normals[i].y)), sizeof(float));
-                        out.write(reinterpret_cast<const char*>(&(normals[i].z)), sizeof(float));
-                    }
-
-                    if (use_texcoords)
-                    {
-                        out.write(reinterpret_cast<const char*>(&(new_tex[i][0])), sizeof(uint8_t));
-                        out.write(reinterpret_cast<const char*>(&(new_tex[i][1])), sizeof(uint8_t));
-                        out.write(reinterpret_cast<const char*>(&(new_tex[i][2])), sizeof(uint8_t));
-                    }
+                if (mesh && use_normals)
+                {
+                    out << normals[i].x << " ";
+                    out << normals[i].y << " ";
+                    out << normals[i].z << " ";
+                    out << "\n";
                 }
-                if (mesh)
+
+                if (use_texcoords)
                 {
-                    auto size = faces.size();
-                    for (size_t i = 0; i < size; ++i) {
-                        static const int three = 3;
-                        out.write(reinterpret_cast<const char*>(&three), sizeof(uint8_t));
-                        out.write(reinterpret_cast<const char*>(&(faces[i][0])), sizeof(int));
-                        out.write(reinterpret_cast<const char*>(&(faces[i][1])), sizeof(int));
-                        out.write(reinterpret_cast<const char*>(&(faces[i][2])), sizeof(int));
-                    }
+                    out << unsigned(new_tex[i][0]) << " ";
+                    out << unsigned(new_tex[i][1]) << " ";
+                    out << unsigned(new_tex[i][2]) << " ";
+                    out << "\n";
                 }
             }
-            else
+            if (mesh)
             {
-                for (size_t i = 0; i <new_verts.size(); ++i)
-                {
-                    out << new_verts[i].x << " ";
-                    out << new_verts[i].y << " ";
-                    out << new_verts[i].z << " ";
+                auto size = faces.size();
+                for (size_t i = 0; i < size; ++i) {
+                    int three = 3;
+                    out << three << " ";
+                    out << std::get<0>(faces[i]) << " ";
+                    out << std::get<1>(faces[i]) << " ";
+                    out << std::get<2>(faces[i]) << " ";
                     out << "\n";
-
-                    if (mesh && use_normals)
-                    {
-                        out << normals[i].x << " ";
-                        out << normals[i].y << " ";
-                        out << normals[i].z << " ";
-                        out << "\n";
-                    }
-
-                    if (use_texcoords)
-                    {
-                        out << unsigned(new_tex[i][0]) << " ";
-                        out << unsigned(new_tex[i][1]) << " ";
-                        out << unsigned(new_tex[i][2]) << " ";
-                        out << "\n";
-                    }
-                }
-                if (mesh)
-                {
-                    auto size = faces.size();
-                    for (size_t i = 0; i < size; ++i) {
-                        int three = 3;
-                        out << three << " ";
-                        out << std::get<0>(faces[i]) << " ";
-                        out << std::get<1>(faces[i]) << " ";
-                        out << std::get<2>(faces[i]) << " ";
-                        out << "\n";
-                    }
                 }
             }
         }
@@ -286,6 +249,7 @@ namespace rs2
 
         std::string fname;
         pointcloud _pc;
+        ply_exporter _exporter;
     };
 
     class save_single_frameset : public filter {
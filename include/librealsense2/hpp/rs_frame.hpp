@@ -736,6 +736,26 @@ namespace rs2
         operator const float*() const { return &u; }
     };
 
+    /**
+    * Keeps the buffers of a PLY export for the next one, so that exporting a sequence of point clouds of the same size
+    * (see points::export_to_ply) does not allocate
+    */
+    class ply_exporter
+    {
+    public:
+        ply_exporter()
+        {
+            rs2_error* e = nullptr;
+            _exporter = std::shared_ptr<rs2_ply_exporter>(rs2_create_ply_exporter(&e), rs2_delete_ply_exporter);
+            error::handle(e);
+        }
+
+        rs2_ply_exporter* get() const { return _exporter.get(); }
+
+    private:
+        std::shared_ptr<rs2_ply_exporter> _exporter;
+    };
+
     class points : public frame
     {
     public:
@@ -790,6 +810,40 @@ namespace rs2
             error::handle(e);
         }
         /**
+        * Export the point cloud to a binary PLY file
+        * \param[in] string fname - file name of the PLY to be saved
+        * \param[in] video_frame texture - the texture for the PLY, or an empty frame for no colors
+        * \param[in] bool mesh - whether to write the faces joining neighbouring vertices
+        * \param[in] bool normals - whether to write the normal of each vertex (with the mesh only)
+        * \param[in] float threshold - faces are only made of vertices whose depths differ less than this
+        */
+        void export_to_ply(const std::string& fname, video_frame texture, bool mesh, bool normals, float threshold)
+        {
+            rs2_frame* ptr = nullptr;
+            std::swap(texture.frame_ref, ptr);
+            rs2_error* e = nullptr;
+            rs2_export_to_ply_ex(get(), fname.c_str(), ptr, mesh, normals, threshold, &e);
+            error::handle(e);
+        }
+        /**
+        * Export the point cloud to a binary PLY file, with the buffers of an exporter kept for the next export
+        * \param[in] ply_exporter exporter - the exporter; one thread at a time may use it
+        * \param[in] string fname - file name of the PLY to be saved
+        * \param[in] video_frame texture - the texture for the PLY, or an empty frame for no colors
+        * \param[in] bool mesh - whether to write the faces joining neighbouring vertices
+        * \param[in] bool normals - whether to write the normal of each vertex (with the mesh only)
+        * \param[in] float threshold - faces are only made of vertices whose depths differ less than this
+        */
+        void export_to_ply(ply_exporter& exporter, const std::string& fname, video_frame texture,
+                           bool mesh = true, bool normals = false, float threshold = 0.05f)
+        {
+            rs2_frame* ptr = nullptr;
+            std::swap(texture.frame_ref, ptr);
+            rs2_error* e = nullptr;
+            rs2_ply_exporter_export(exporter.get(), get(), fname.c_str(), ptr, mesh, normals, threshold, &e);
+            error::handle(e);
+        }
+        /**
         * Retrieve the texture coordinates (uv map) for the point cloud
         * \return texture_coordinate* - pointer of texture coordinates.
         */
@@ -911,6 +965,36 @@ namespace rs2
             auto data = reinterpret_cast<const float*>(get_data());
             return rs2_vector{ data[0], data[1], data[2] };
         }
+        /**
+        * Retrieve the number of IMU samples the frame carries (see RS2_OPTION_MOTION_SAMPLES_PER_FRAME)
+        * \return int - number of samples, of which get_motion_data() is the first
+        */
+        int get_sample_count() const
+        {
+            rs2_error* e = nullptr;
+            auto r = rs2_get_motion_frame_sample_count(get(), &e);
+            error::handle(e);
+            return r;
+        }
+        /**
+        * Retrieve the motion data of all the samples the frame carries
+        * \return const rs2_vector* - get_sample_count() 3D vectors
+        */
+        const rs2_vector* get_motion_samples() const
+        {
+            return reinterpret_cast<const rs2_vector*>(get_data());
+        }
+        /**
+        * Retrieve the timestamps of all the samples the frame carries; the last one is the frame's
+        * \return const double* - get_sample_count() timestamps, in milliseconds
+        */
+        const double* get_sample_timestamps() const
+        {
+            rs2_error* e = nullptr;
+            auto r = rs2_get_motion_frame_sample_timestamps(get(), &e);
+            error::handle(e);
+            return r;
+        }
     };
 
     class pose_frame : public frame
@@ -1180,5 +1264,26 @@ namespace rs2
 
         void release() override { delete this; }
     };
+
+    template<class A, class D>
+    class frame_allocator : public rs2_frame_allocator
+    {
+        A allocate_function;   // Callable of type: void*(size_t size)
+        D deallocate_function; // Callable of type: void(void* buffer, size_t size)
+    public:
+        frame_allocator(A allocate, D deallocate) : allocate_function(allocate), deallocate_function(deallocate) {}
+
+        void* allocate(size_t size) override
+        {
+            return allocate_function(size);
+        }
+
+        void deallocate(void* buffer, size_t size) override
+        {
+            deallocate_function(buffer, size);
+        }
+
+        void release() override { delete this; }
+    };
 }
 #endif // LIBREALSENSE_RS2_FRAME_HPP
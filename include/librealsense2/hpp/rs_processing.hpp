@@ -202,6 +202,53 @@ namespace rs2
             if (res) *output = f;
             return res > 0;
         }
+
+        /**
+        * dequeue all frames available in the queue, up to max_frames, at once
+        * \param[out] output - receives the dequeued frames (previous contents are cleared)
+        * \return number of frames dequeued
+        */
+        size_t poll_for_frames_batch(std::vector<frame>& output, size_t max_frames) const
+        {
+            output.clear();
+            poll_into(output, max_frames);
+            return output.size();
+        }
+
+        /**
+        * wait until frames become available in the queue and dequeue them, up to max_frames, at once
+        * \param[out] output - receives the dequeued frames (previous contents are cleared)
+        * \return number of frames dequeued (0 on timeout)
+        */
+        size_t try_wait_for_frames_batch(std::vector<frame>& output, size_t max_frames, unsigned int timeout_ms = 5000) const
+        {
+            output.clear();
+            if (!max_frames)
+                return 0;
+
+            rs2_frame* refs[BATCH_CHUNK];
+            rs2_error* e = nullptr;
+            auto res = rs2_try_wait_for_frames_batch(_queue.get(), timeout_ms, refs, static_cast<int>(max_frames < BATCH_CHUNK ? max_frames : BATCH_CHUNK), &e);
+            error::handle(e);
+            append_frames(refs, res, output);
+            // Whatever else was queued by then is taken without waiting again
+            if (static_cast<size_t>(res) == BATCH_CHUNK)
+                poll_into(output, max_frames);
+            return output.size();
+        }
+
+        /**
+        * have a consumer waiting on the queue woken only once enough frames accumulated
+        * \param[in] frames     wake once this many frames are queued (1, the default, wakes for every frame)
+        * \param[in] latency_us ... or once the first queued frame waited this many microseconds
+        */
+        void set_wake_threshold(int frames, unsigned int latency_us) const
+        {
+            rs2_error* e = nullptr;
+            rs2_set_frame_queue_wake_threshold(_queue.get(), frames, latency_us, &e);
+            error::handle(e);
+        }
+
         /**
         * Does the same thing as enqueue function.
         */
@@ -240,6 +287,34 @@ namespace rs2
         std::shared_ptr<rs2_frame_queue> get() { return _queue; }
 
     private:
+        // Batches are dequeued through a small buffer on the stack, a chunk at a time, so that each call
+        // has its own and only the output grows (once, if the caller reuses it)
+        static const size_t BATCH_CHUNK = 64;
+
+        // Appends the queued frames to output, until it holds max_frames or the queue is empty
+        void poll_into(std::vector<frame>& output, size_t max_frames) const
+        {
+            rs2_frame* refs[BATCH_CHUNK];
+            while (output.size() < max_frames)
+            {
+                auto chunk = max_frames - output.size();
+                if (chunk > BATCH_CHUNK)
+                    chunk = BATCH_CHUNK;
+                rs2_error* e = nullptr;
+                auto res = rs2_poll_for_frames_batch(_queue.get(), refs, static_cast<int>(chunk), &e);
+                error::handle(e);
+                append_frames(refs, res, output);
+                if (static_cast<size_t>(res) < chunk)
+                    break;
+            }
+        }
+
+        static void append_frames(rs2_frame* const* refs, int count, std::vector<frame>& output)
+        {
+            for (int i = 0; i < count; ++i)
+                output.emplace_back(refs[i]);
+        }
+
         std::shared_ptr<rs2_frame_queue> _queue;
         size_t _capacity;
         bool _keep;
@@ -278,6 +353,20 @@ namespace rs2
             return on_frame;
         }
         /**
+        * Provide the buffers that video, depth and disparity frames produced by the processing block are written to
+        *
+        * \param[in] allocate     callable accepting a size in bytes and returning a buffer of at least that size, or nullptr
+        *                         to fall back to an internally allocated buffer
+        * \param[in] deallocate   callable accepting a buffer returned by allocate and its size, invoked once the frame is released
+        */
+        template<class A, class D>
+        void set_frame_allocator(A allocate, D deallocate)
+        {
+            rs2_error* e = nullptr;
+            rs2_set_processing_block_frame_allocator_cpp(get(), new frame_allocator<A, D>(std::move(allocate), std::move(deallocate)), &e);
+            error::handle(e);
+        }
+        /**
         * Ask processing block to process the frame
         *
         * \param[in] on_frame      frame to be processed.
@@ -292,6 +381,53 @@ namespace rs2
             error::handle(e);
         }
         /**
+        * Ask processing block to process the frame before returning, on the caller's thread, even when it is attached
+        * to an executor (see context::attach_executor)
+        *
+        * \param[in] on_frame      frame to be processed.
+        */
+        void invoke_sync(frame f) const
+        {
+            rs2_frame* ptr = nullptr;
+            std::swap(f.frame_ref, ptr);
+
+            rs2_error* e = nullptr;
+            rs2_process_frame_sync(get(), ptr, &e);
+            error::handle(e);
+        }
+        /**
+        * Check whether frames passed to the processing block are processed on the worker threads of a context
+        * (see context::attach_executor) rather than on the caller's thread
+        */
+        bool uses_executor() const
+        {
+            rs2_error* e = nullptr;
+            auto res = rs2_processing_block_uses_executor(get(), &e);
+            error::handle(e);
+            return res > 0;
+        }
+        /**
+        * Declare that the processing block keeps no state from one frame to the next, so that once attached to an
+        * executor it may process several frames at the same time; results are still delivered in order. Takes effect
+        * the next time the block is attached (see context::attach_executor). Only custom blocks (made around a
+        * callback) can be declared stateless; the built-in filters keep state between frames.
+        */
+        void set_stateless(bool stateless = true) const
+        {
+            rs2_error* e = nullptr;
+            rs2_processing_block_set_stateless(get(), stateless, &e);
+            error::handle(e);
+        }
+        /**
+        * Process frames passed to the processing block on the caller's thread again
+        */
+        void detach_executor() const
+        {
+            rs2_error* e = nullptr;
+            rs2_processing_block_attach_executor(get(), nullptr, &e);
+            error::handle(e);
+        }
+        /**
         * constructor with already created low level processing block assigned.
         *
         * \param[in] block - low level rs2_processing_block created before.
@@ -369,7 +505,7 @@ namespace rs2
         */
         rs2::frame process(rs2::frame frame) const override
         {
-            invoke(frame);
+            invoke_sync(frame);
             rs2::frame f;
             if (!_queue.poll_for_frame(&f))
                 throw std::runtime_error("Error occured during execution of the processing block! See the log for more info");
@@ -126,6 +126,31 @@ namespace rs2
             error::handle(e);
         }
 
+        /**
+        * Enables or disables the index sidecar file ("<file>.idx") of the played file: the message index is loaded from it
+        * when it matches the file, and it is created or replaced otherwise. Applies from the next time the file is
+        * reopened, when the playback is stopped or resumed.
+        * \param[in] enabled  Indicates if the sidecar is used
+        */
+        void set_index_file(bool enabled) const
+        {
+            rs2_error* e = nullptr;
+            rs2_playback_device_set_index_file(_dev.get(), (enabled ? 1 : 0), &e);
+            error::handle(e);
+        }
+
+        /**
+        * Set how much data non real time playback may read from the file ahead of the frames it raises, on a background
+        * thread. Real time playback does not read ahead.
+        * \param[in] bytes  The most data, in bytes, to read ahead; 0 disables reading ahead
+        */
+        void set_read_ahead(unsigned long long bytes) const
+        {
+            rs2_error* e = nullptr;
+            rs2_playback_device_set_read_ahead(_dev.get(), bytes, &e);
+            error::handle(e);
+        }
+
         /**
         * Set the playing speed
         * \param[in] speed  Indicates a multiplication of the speed to play (e.g: 1 = normal, 0.5 twice as slow)
@@ -266,6 +291,43 @@ namespace rs2
             error::handle(e);
             return filename;
         }
+
+        /**
+        * Gets the counters of the frames going through the write queue of the recorder
+        * \return The counters since the recording started
+        */
+        rs2_record_statistics get_statistics() const
+        {
+            rs2_error* e = nullptr;
+            rs2_record_statistics stats;
+            rs2_record_device_get_statistics(_dev.get(), &stats, &e);
+            error::handle(e);
+            return stats;
+        }
+
+        /**
+        * Sets the budget of the write queue of the recorder: frames arriving while more frame data than this is
+        * waiting to be written are dropped
+        * \param[in]  max_cached_data_size  The most frame data, in bytes, to keep waiting to be written
+        */
+        void set_max_cached_data_size(unsigned long long max_cached_data_size)
+        {
+            rs2_error* e = nullptr;
+            rs2_record_device_set_max_cached_data_size(_dev.get(), max_cached_data_size, &e);
+            error::handle(e);
+        }
+
+        /**
+        * Enables or disables writing a copy of the message index to a sidecar file ("<file>.idx") when the recording
+        * ends, for playback to load quickly
+        * \param[in]  enabled  Indicates if the sidecar is written
+        */
+        void set_index_file(bool enabled)
+        {
+            rs2_error* e = nullptr;
+            rs2_record_device_set_index_file(_dev.get(), (enabled ? 1 : 0), &e);
+            error::handle(e);
+        }
     protected:
         explicit recorder(std::shared_ptr<rs2_device> dev) : device(dev)
         {
@@ -189,6 +189,46 @@ namespace rs2
             error::handle(e);
         }
 
+        /**
+        * Provide the buffers that video, depth and disparity frames of this sensor are written to
+        * \param[in] allocate     Callable accepting a size in bytes and returning a buffer of at least that size, or nullptr
+        *                         to fall back to an internally allocated buffer
+        * \param[in] deallocate   Callable accepting a buffer returned by allocate and its size, invoked once the frame is released
+        */
+        template<class A, class D>
+        void set_frame_allocator(A allocate, D deallocate) const
+        {
+            rs2_error* e = nullptr;
+            rs2_set_frame_allocator_cpp(_sensor.get(), new frame_allocator<A, D>(std::move(allocate), std::move(deallocate)), &e);
+            error::handle(e);
+        }
+
+        /**
+        * Retrieve how well the sensor recycles the buffers of its frames
+        * \return The counters since the sensor was last opened
+        */
+        rs2_frame_pool_statistics get_frame_pool_statistics() const
+        {
+            rs2_error* e = nullptr;
+            rs2_frame_pool_statistics stats;
+            rs2_get_frame_pool_statistics(_sensor.get(), &stats, &e);
+            error::handle(e);
+            return stats;
+        }
+
+        /**
+        * Retrieve how many control transfers the caching of the sensor's option values and ranges saved
+        * \return The counters since the sensor was created
+        */
+        rs2_control_cache_statistics get_control_cache_statistics() const
+        {
+            rs2_error* e = nullptr;
+            rs2_control_cache_statistics stats;
+            rs2_get_control_cache_statistics(_sensor.get(), &stats, &e);
+            error::handle(e);
+            return stats;
+        }
+
         /**
         * stop streaming
         */
@@ -29,6 +29,14 @@ struct rs2_frame_callback
     virtual                                 ~rs2_frame_callback() {}
 };
 
+struct rs2_frame_allocator
+{
+    virtual void *                          allocate(size_t size) = 0;
+    virtual void                            deallocate(void * buffer, size_t size) = 0;
+    virtual void                            release() = 0;
+    virtual                                 ~rs2_frame_allocator() {}
+};
+
 struct rs2_frame_processor_callback
 {
     virtual void                            on_frame(rs2_frame * f, rs2_source * source) = 0;
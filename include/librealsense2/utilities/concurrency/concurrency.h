@@ -9,6 +9,10 @@
 #include <atomic>
 #include <functional>
 #include <cassert>
+#include <algorithm>
+#include <chrono>
+#include <memory>
+#include <cstddef>
 
 const int QUEUE_MAX_SIZE = 10;
 // Simplest implementation of a blocking concurrent queue for thread messaging
@@ -23,8 +27,39 @@ class single_consumer_queue
     unsigned int const _cap;
     bool _accepting;
 
+    // A waiting consumer is woken only once this many items are queued, or the first of them has
+    // waited for the latency below; see set_wake_threshold()
+    size_t _wake_count = 1;
+    std::chrono::microseconds _wake_latency{ 0 };
+
     std::function<void(T const &)> const _on_drop_callback;
 
+    // Whether an enqueue that brought the queue to 'size' items should wake the consumer: it is
+    // either waiting for a first item or for the wake threshold
+    bool _should_wake( size_t size ) const { return size == 1 || size >= _wake_count; }
+
+    // Wait (with the lock held) for something to dequeue, honoring the wake threshold
+    // Return true if there's something in the queue
+    bool _wait_for_items( std::unique_lock< std::mutex > & lock, unsigned int timeout_ms )
+    {
+        auto const deadline = std::chrono::steady_clock::now() + std::chrono::milliseconds( timeout_ms );
+        if( ! _deq_cv.wait_until( lock, deadline, [this]() { return ! _accepting || ! _queue.empty(); } )
+            || _queue.empty() )
+        {
+            return false;
+        }
+
+        if( _wake_count > 1 && _queue.size() < _wake_count )
+        {
+            // Let more items accumulate, but don't hold the first one back for longer than allowed
+            auto const batch_deadline = std::min( deadline, std::chrono::steady_clock::now() + _wake_latency );
+            _deq_cv.wait_until( lock, batch_deadline, [this]() {
+                return ! _accepting || _queue.size() >= _wake_count;
+            } );
+        }
+        return ! _queue.empty();
+    }
+
 public:
     explicit single_consumer_queue< T >( unsigned int cap = QUEUE_MAX_SIZE,
                                          std::function< void( T const & ) > on_drop_callback = nullptr )
@@ -55,10 +90,12 @@ public:
             _queue.pop_front();
         }
 
+        bool const wake = _should_wake( _queue.size() );
         lock.unlock();
 
         // We pushed something -- let others know there's something to dequeue
-        _deq_cv.notify_one();
+        if( wake )
+            _deq_cv.notify_one();
 
         return true;
     }
@@ -80,10 +117,12 @@ public:
         }
 
         _queue.push_back(std::move(item));
+        bool const wake = _should_wake( _queue.size() );
         lock.unlock();
 
         // We pushed something -- let another know there's something to dequeue
-        _deq_cv.notify_one();
+        if( wake )
+            _deq_cv.notify_one();
 
         return true;
     }
@@ -94,13 +133,8 @@ public:
     bool dequeue( T * item, unsigned int timeout_ms )
     {
         std::unique_lock<std::mutex> lock(_mutex);
-        if( ! _deq_cv.wait_for( lock,
-                                std::chrono::milliseconds( timeout_ms ),
-                                [this]() { return ! _accepting || ! _queue.empty(); } )
-            || _queue.empty() )
-        {
+        if( ! _wait_for_items( lock, timeout_ms ) )
             return false;
-        }
 
         *item = std::move(_queue.front());
         _queue.pop_front();
@@ -111,6 +145,37 @@ public:
         return true;
     }
 
+    // Remove up to 'max' items, all under a single lock; if none are available, wait for them
+    // Each item is passed to fn (with the lock held!) in order
+    // Return the number of items removed
+    template< class Fn >
+    size_t dequeue_batch( size_t max, unsigned int timeout_ms, Fn fn )
+    {
+        std::unique_lock< std::mutex > lock( _mutex );
+        if( ! max || ! _wait_for_items( lock, timeout_ms ) )
+            return 0;
+        return _dequeue_batch( max, fn );
+    }
+
+    // Remove up to 'max' items if available; do not wait for them
+    template< class Fn >
+    size_t try_dequeue_batch( size_t max, Fn fn )
+    {
+        std::lock_guard< std::mutex > lock( _mutex );
+        return _dequeue_batch( max, fn );
+    }
+
+    // Have a waiting consumer woken only once 'count' items are queued, or the first of them has
+    // waited for 'latency'; useful to cut down on wake-ups when many small items arrive at a high
+    // rate. A count of 1 (the default) wakes the consumer for every item.
+    void set_wake_threshold( size_t count, std::chrono::microseconds latency )
+    {
+        std::lock_guard< std::mutex > lock( _mutex );
+        // The queue never holds more than its capacity
+        _wake_count = std::max< size_t >( 1, std::min< size_t >( count, _cap ) );
+        _wake_latency = latency;
+    }
+
     // Remove one item if available; do not wait for one
     // Return true if an item was removed -- otherwise, false
     bool try_dequeue(T* item)
@@ -165,6 +230,22 @@ public:
     }
 
 protected:
+    template< class Fn >
+    size_t _dequeue_batch( size_t max, Fn & fn )
+    {
+        size_t n = 0;
+        for( ; n < max && ! _queue.empty(); ++n )
+        {
+            fn( std::move( _queue.front() ) );
+            _queue.pop_front();
+        }
+
+        // We've made room -- let whoever is waiting for room know about it
+        if( n )
+            _enq_cv.notify_all();
+        return n;
+    }
+
     void _clear()
     {
         _queue.clear();
@@ -193,11 +274,405 @@ public:
     bool empty() const { return ! size(); }
 };
 
+// A bounded, lock-free alternative to single_consumer_queue, with the same drop-oldest/blocking
+// semantics and on_drop callback.
+//
+// Producers claim slots in a ring with a CAS on the tail, so enqueueing never takes a lock. Items
+// leave the ring from the head, either to the consumer or, when the ring is full, to a producer
+// that drops the oldest item to make room; those (and peek) are serialized by a spin flag that is
+// only held for the duration of a move. A mutex and condition variables are used only to put an
+// idle consumer (or a blocked producer) to sleep, and are skipped while nobody is waiting.
+template< class T >
+class ring_single_consumer_queue
+{
+    struct cell
+    {
+        std::atomic< size_t > seq;
+        T value;
+    };
+
+    std::unique_ptr< cell[] > _cells;
+    size_t const _mask;
+    unsigned int const _cap;
+
+    // Keep the producer and consumer ends on separate cache lines
+    char _pad0[64];
+    std::atomic< size_t > _tail;
+    char _pad1[64];
+    std::atomic< size_t > _head;
+    mutable std::atomic_flag _head_lock = ATOMIC_FLAG_INIT;
+    char _pad2[64];
+
+    std::atomic< bool > _accepting;
+    std::function< void( T const & ) > const _on_drop_callback;
+
+    std::mutex _wait_mutex;
+    std::condition_variable _deq_cv;  // not empty signal
+    std::condition_variable _enq_cv;  // not full signal
+    std::atomic< int > _deq_waiters;
+    std::atomic< int > _enq_waiters;
+
+    // See single_consumer_queue::set_wake_threshold()
+    std::atomic< size_t > _wake_count;
+    std::atomic< long long > _wake_latency_us;
+    std::atomic< bool > _awaiting_first;  // the consumer is waiting for an empty queue to fill
+
+    static size_t ring_size( unsigned int cap )
+    {
+        size_t size = 1;
+        while( size < cap )
+            size <<= 1;
+        return size;
+    }
+
+    class head_guard
+    {
+        std::atomic_flag & _flag;
+
+    public:
+        explicit head_guard( std::atomic_flag & flag )
+            : _flag( flag )
+        {
+            while( _flag.test_and_set( std::memory_order_acquire ) )
+                std::this_thread::yield();
+        }
+        ~head_guard() { _flag.clear( std::memory_order_release ); }
+    };
+
+    // Claim the next slot and move 'item' into it
+    // Returns false (leaving 'item' untouched) if the queue is at capacity
+    bool try_push( T & item )
+    {
+        size_t pos = _tail.load( std::memory_order_relaxed );
+        while( true )
+        {
+            // 'pos' may be stale (behind the head), in which case the slot check below catches it
+            auto const used = std::ptrdiff_t( pos - _head.load( std::memory_order_acquire ) );
+            if( used >= std::ptrdiff_t( _cap ) )
+                return false;
+
+            cell & c = _cells[pos & _mask];
+            size_t const seq = c.seq.load( std::memory_order_acquire );
+            if( seq == pos )
+            {
+                if( _tail.compare_exchange_weak( pos, pos + 1, std::memory_order_relaxed ) )
+                {
+                    c.value = std::move( item );
+                    c.seq.store( pos + 1, std::memory_order_release );
+                    return true;
+                }
+            }
+            else
+            {
+                // Either another producer claimed this slot, or the item that was in it is still
+                // being moved out; both are transient
+                if( seq < pos )
+                    std::this_thread::yield();
+                pos = _tail.load( std::memory_order_relaxed );
+            }
+        }
+    }
+
+    // Move the oldest item out
+    // Returns false if the queue is empty (or its oldest item is still being written)
+    bool pop( T & item )
+    {
+        head_guard guard( _head_lock );
+        size_t const pos = _head.load( std::memory_order_relaxed );
+        cell & c = _cells[pos & _mask];
+        if( c.seq.load( std::memory_order_acquire ) != pos + 1 )
+            return false;
+
+        item = std::move( c.value );
+        c.value = T();
+        _head.store( pos + 1, std::memory_order_release );
+        c.seq.store( pos + _mask + 1, std::memory_order_release );
+        return true;
+    }
+
+    // Like pop(), but also lets whoever is waiting for room know about it
+    bool try_pop( T & item )
+    {
+        if( ! pop( item ) )
+            return false;
+        notify( _enq_waiters, _enq_cv );
+        return true;
+    }
+
+    // Wake a sleeper, if any. The fence pairs with the one in wait() so that either the sleeper
+    // sees our change before going to sleep, or we see it waiting and notify it.
+    void notify( std::atomic< int > & waiters, std::condition_variable & cv )
+    {
+        std::atomic_thread_fence( std::memory_order_seq_cst );
+        if( waiters.load( std::memory_order_relaxed ) )
+        {
+            std::lock_guard< std::mutex > lock( _wait_mutex );
+            cv.notify_all();
+        }
+    }
+
+    template< class Pred >
+    bool wait( std::atomic< int > & waiters,
+               std::condition_variable & cv,
+               std::chrono::steady_clock::time_point deadline,
+               Pred pred )
+    {
+        std::unique_lock< std::mutex > lock( _wait_mutex );
+        waiters.fetch_add( 1, std::memory_order_relaxed );
+        std::atomic_thread_fence( std::memory_order_seq_cst );
+        bool const result = cv.wait_until( lock, deadline, pred );
+        waiters.fetch_sub( 1, std::memory_order_relaxed );
+        return result;
+    }
+
+    // True if the oldest item is ready to be removed
+    bool has_item() const
+    {
+        size_t const pos = _head.load( std::memory_order_acquire );
+        return _cells[pos & _mask].seq.load( std::memory_order_acquire ) == pos + 1;
+    }
+
+    // Wake the consumer after an enqueue if it is waiting for a first item, or if the wake
+    // threshold was reached
+    void notify_dequeuer()
+    {
+        std::atomic_thread_fence( std::memory_order_seq_cst );
+        if( ! _deq_waiters.load( std::memory_order_relaxed ) )
+            return;
+
+        size_t const count = _wake_count.load( std::memory_order_relaxed );
+        if( count > 1 && ! _awaiting_first && size() < count )
+            return;
+
+        std::lock_guard< std::mutex > lock( _wait_mutex );
+        _deq_cv.notify_all();
+    }
+
+    // Wait for something to dequeue, honoring the wake threshold
+    void wait_for_items( unsigned int timeout_ms )
+    {
+        auto const deadline = std::chrono::steady_clock::now() + std::chrono::milliseconds( timeout_ms );
+        if( ! has_item() )
+        {
+            _awaiting_first = true;
+            bool const ready
+                = wait( _deq_waiters, _deq_cv, deadline, [this]() { return ! _accepting || has_item(); } );
+            _awaiting_first = false;
+            if( ! ready )
+                return;
+        }
+
+        size_t const count = _wake_count.load( std::memory_order_relaxed );
+        if( count > 1 && _accepting && size() < count )
+        {
+            // Let more items accumulate, but don't hold the first one back for longer than allowed
+            auto const batch_deadline = std::min(
+                deadline,
+                std::chrono::steady_clock::now() + std::chrono::microseconds( _wake_latency_us.load() ) );
+            wait( _deq_waiters, _deq_cv, batch_deadline, [&]() { return ! _accepting || size() >= count; } );
+        }
+    }
+
+    void drop( T const & item )
+    {
+        if( _on_drop_callback )
+            _on_drop_callback( item );
+    }
+
+public:
+    explicit ring_single_consumer_queue< T >( unsigned int cap = QUEUE_MAX_SIZE,
+                                              std::function< void( T const & ) > on_drop_callback = nullptr )
+        : _cells( new cell[ring_size( cap )] )
+        , _mask( ring_size( cap ) - 1 )
+        , _cap( cap )
+        , _tail( 0 )
+        , _head( 0 )
+        , _accepting( true )
+        , _on_drop_callback( on_drop_callback )
+        , _deq_waiters( 0 )
+        , _enq_waiters( 0 )
+        , _wake_count( 1 )
+        , _wake_latency_us( 0 )
+        , _awaiting_first( false )
+    {
+        assert( cap > 0 );
+        for( size_t i = 0; i <= _mask; ++i )
+            _cells[i].seq.store( i, std::memory_order_relaxed );
+    }
+
+    // Enqueue an item onto the queue.
+    // If the queue grows beyond capacity, the front will be removed, losing whatever was there!
+    bool enqueue( T && item )
+    {
+        if( ! _accepting )
+        {
+            drop( item );
+            return false;
+        }
+
+        while( ! try_push( item ) )
+        {
+            T oldest;
+            if( try_pop( oldest ) )
+                drop( oldest );
+            else
+                // The oldest item is still being written, or another thread is removing it: let it
+                // finish rather than spin against it
+                std::this_thread::yield();
+        }
+
+        // A stop() that raced with us has already cleared the queue; don't leave our item behind
+        if( ! _accepting )
+            clear();
+
+        // We pushed something -- let others know there's something to dequeue
+        notify_dequeuer();
+        return true;
+    }
+
+    // Enqueue an item, but wait for room if there isn't any
+    // Returns true if the enqueue succeeded
+    bool blocking_enqueue( T && item )
+    {
+        bool pushed = false;
+        while( _accepting && ! ( pushed = try_push( item ) ) )
+            wait( _enq_waiters,
+                  _enq_cv,
+                  std::chrono::steady_clock::now() + std::chrono::milliseconds( 100 ),
+                  [this]() {
+                return ! _accepting || size() < _cap;
+            } );
+
+        if( ! pushed )
+        {
+            // We shouldn't be adding anything to the queue when we're stopping
+            drop( item );
+            return false;
+        }
+        if( ! _accepting )
+            clear();
+
+        // We pushed something -- let another know there's something to dequeue
+        notify_dequeuer();
+        return true;
+    }
+
+    // Remove one item; if unavailable, wait for it
+    // Return true if an item was removed -- otherwise, false
+    bool dequeue( T * item, unsigned int timeout_ms )
+    {
+        wait_for_items( timeout_ms );
+        return try_pop( *item );
+    }
+
+    // Remove one item if available; do not wait for one
+    // Return true if an item was removed -- otherwise, false
+    bool try_dequeue( T * item ) { return try_pop( *item ); }
+
+    // Remove up to 'max' items; if none are available, wait for them
+    // Each item is passed to fn in order
+    // Return the number of items removed
+    template< class Fn >
+    size_t dequeue_batch( size_t max, unsigned int timeout_ms, Fn fn )
+    {
+        if( ! max )
+            return 0;
+        wait_for_items( timeout_ms );
+        return try_dequeue_batch( max, fn );
+    }
+
+    // Remove up to 'max' items if available; do not wait for them
+    template< class Fn >
+    size_t try_dequeue_batch( size_t max, Fn fn )
+    {
+        size_t n = 0;
+        T item;
+        for( ; n < max && pop( item ); ++n )
+            fn( std::move( item ) );
+
+        if( n )
+            notify( _enq_waiters, _enq_cv );
+        return n;
+    }
+
+    void set_wake_threshold( size_t count, std::chrono::microseconds latency )
+    {
+        _wake_latency_us = latency.count();
+        _wake_count = std::max< size_t >( 1, std::min< size_t >( count, _cap ) );
+    }
+
+    template< class Fn >
+    bool peek( Fn fn ) const
+    {
+        head_guard guard( _head_lock );
+        size_t const pos = _head.load( std::memory_order_relaxed );
+        cell const & c = _cells[pos & _mask];
+        if( c.seq.load( std::memory_order_acquire ) != pos + 1 )
+            return false;
+        fn( c.value );
+        return true;
+    }
+
+    template< class Fn >
+    bool peek( Fn fn )
+    {
+        head_guard guard( _head_lock );
+        size_t const pos = _head.load( std::memory_order_relaxed );
+        cell & c = _cells[pos & _mask];
+        if( c.seq.load( std::memory_order_acquire ) != pos + 1 )
+            return false;
+        fn( c.value );
+        return true;
+    }
+
+    void stop()
+    {
+        // We no longer accept any more items!
+        _accepting = false;
+        clear();
+    }
+
+    void clear()
+    {
+        T item;
+        while( pop( item ) )
+            ;
+
+        // Wake up anyone who is waiting for room to enqueue, or waiting for something to dequeue -- there's nothing now
+        std::lock_guard< std::mutex > lock( _wait_mutex );
+        _enq_cv.notify_all();
+        _deq_cv.notify_all();
+    }
+
+    void start() { _accepting = true; }
+
+    bool started() const { return _accepting; }
+    bool stopped() const { return ! started(); }
+
+    size_t size() const
+    {
+        // Items still being written are counted
+        size_t const head = _head.load( std::memory_order_acquire );
+        size_t const tail = _tail.load( std::memory_order_acquire );
+        return tail > head ? tail - head : 0;
+    }
+
+    bool empty() const { return ! size(); }
+};
+
+// The queue used wherever frames and actions hop between threads (dispatcher, frame queues,
+// syncer, aggregator); the lock-free ring is selected with BUILD_WITH_LOCKFREE_QUEUES
+#ifdef RS2_LOCKFREE_QUEUES
+template< class T > using hop_queue = ring_single_consumer_queue< T >;
+#else
+template< class T > using hop_queue = single_consumer_queue< T >;
+#endif
+
 // A single_consumer_queue meant to hold frame_holder objects
 template<class T>
 class single_consumer_frame_queue
 {
-    single_consumer_queue<T> _queue;
+    hop_queue<T> _queue;
 
 public:
     single_consumer_frame_queue< T >( unsigned int cap = QUEUE_MAX_SIZE,
@@ -224,6 +699,23 @@ public:
         return _queue.try_dequeue(item);
     }
 
+    template< class Fn >
+    size_t dequeue_batch( size_t max, unsigned int timeout_ms, Fn fn )
+    {
+        return _queue.dequeue_batch( max, timeout_ms, fn );
+    }
+
+    template< class Fn >
+    size_t try_dequeue_batch( size_t max, Fn fn )
+    {
+        return _queue.try_dequeue_batch( max, fn );
+    }
+
+    void set_wake_threshold( size_t count, std::chrono::microseconds latency )
+    {
+        _queue.set_wake_threshold( count, latency );
+    }
+
     template< class Fn >
     bool peek( Fn fn ) const
     {
@@ -387,7 +879,7 @@ private:
 
     friend cancellable_timer;
 
-    single_consumer_queue<std::function<void(cancellable_timer)>> _queue;
+    hop_queue<std::function<void(cancellable_timer)>> _queue;
     std::thread _thread;
 
     std::atomic<bool> _was_stopped;
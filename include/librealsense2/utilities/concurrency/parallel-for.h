@@ -0,0 +1,149 @@
+// License: Apache 2.0. See LICENSE file in root directory.
+// Copyright(c) 2022 Intel Corporation. All Rights Reserved.
+
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <exception>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+
+// A process-wide pool of worker threads for splitting the work on one image (rows, slices, points)
+// between cores, where OpenMP would otherwise be needed (and is off by default).
+//
+// Work is handed out in chunks, from a shared counter, to the workers and to the calling thread
+// alike: the caller never waits for a chunk that nobody has started, so a loop may be run from a
+// worker thread (of this pool or any other) without deadlocking, even when all workers are busy.
+class parallel_pool
+{
+public:
+    // The most threads (the caller's included) a loop runs on
+    size_t get_max_threads() const { return _workers + 1; }
+
+    // Calls fn(begin, end) over contiguous ranges covering [0, count), at most 'threads' at a time
+    // (0 for all), and returns once all have returned. Ranges are at least 'grain' long. The first
+    // exception thrown by fn is rethrown here, once the other ranges are done.
+    void run( size_t count, std::function< void( size_t, size_t ) > const & fn, size_t threads = 0, size_t grain = 1 )
+    {
+        if( ! threads || threads > get_max_threads() )
+            threads = get_max_threads();
+        grain = std::max< size_t >( 1, grain );
+        size_t chunks = std::min( ( count + grain - 1 ) / grain, threads * CHUNKS_PER_THREAD );
+        if( chunks <= 1 || threads == 1 )
+        {
+            if( count )
+                fn( 0, count );
+            return;
+        }
+
+        auto j = std::make_shared< job >( fn, count, chunks );
+        {
+            std::lock_guard< std::mutex > lock( _mutex );
+            for( size_t i = 1; i < std::min( threads, chunks ); ++i )
+                _jobs.push_back( j );
+        }
+        _cv.notify_all();
+
+        j->work();
+        {
+            std::unique_lock< std::mutex > lock( j->mutex );
+            j->done_cv.wait( lock, [&]() { return j->done == j->chunks; } );
+        }
+        if( j->error )
+            std::rethrow_exception( j->error );
+    }
+
+    static parallel_pool & instance()
+    {
+        // Never destroyed, as it may be used until the very end of the process
+        static parallel_pool * pool = new parallel_pool( std::max( 1u, std::thread::hardware_concurrency() ) - 1 );
+        return *pool;
+    }
+
+private:
+    // Smaller chunks even out cores that are slower, or busy with something else
+    static const size_t CHUNKS_PER_THREAD = 4;
+
+    struct job
+    {
+        std::function< void( size_t, size_t ) > fn;
+        size_t const count;
+        size_t const chunks;
+        std::atomic< size_t > next;
+        size_t done = 0;  // guarded by 'mutex'
+        std::exception_ptr error;
+        std::mutex mutex;
+        std::condition_variable done_cv;
+
+        job( std::function< void( size_t, size_t ) > const & f, size_t n, size_t c )
+            : fn( f )
+            , count( n )
+            , chunks( c )
+            , next( 0 )
+        {
+        }
+
+        void work()
+        {
+            for( size_t i = next++; i < chunks; i = next++ )
+            {
+                std::exception_ptr e;
+                try
+                {
+                    fn( count * i / chunks, count * ( i + 1 ) / chunks );
+                }
+                catch( ... )
+                {
+                    e = std::current_exception();
+                }
+                std::lock_guard< std::mutex > lock( mutex );
+                if( e && ! error )
+                    error = e;
+                if( ++done == chunks )
+                    done_cv.notify_all();
+            }
+        }
+    };
+
+    explicit parallel_pool( size_t workers )
+        : _workers( workers )
+    {
+        for( size_t i = 0; i < _workers; ++i )
+            std::thread( [this]() { work(); } ).detach();
+    }
+
+    void work()
+    {
+        while( true )
+        {
+            std::shared_ptr< job > j;
+            {
+                std::unique_lock< std::mutex > lock( _mutex );
+                _cv.wait( lock, [this]() { return ! _jobs.empty(); } );
+                j = std::move( _jobs.front() );
+                _jobs.pop_front();
+            }
+            // By now the caller (or other workers) may have done all the chunks
+            j->work();
+        }
+    }
+
+    size_t const _workers;
+    std::mutex _mutex;
+    std::condition_variable _cv;
+    std::deque< std::shared_ptr< job > > _jobs;
+};
+
+
+// Runs fn(begin, end) over [0, count) on the threads of the parallel_pool; see parallel_pool::run
+inline void parallel_for( size_t count, std::function< void( size_t, size_t ) > const & fn, size_t threads = 0, size_t grain = 1 )
+{
+    parallel_pool::instance().run( count, fn, threads, grain );
+}
@@ -289,6 +289,114 @@ namespace librealsense
         std::chrono::high_resolution_clock::time_point _start;
     };
 
+    // Per-frame API calls (frame data, metadata, reference counting...) are made for every frame of
+    // every stream, too often to afford api_logger. They are recorded into a fixed ring of the
+    // latest calls instead, without locking or allocating, and summarized in the log every
+    // sample_period calls of each function. The ring is dumped when one of them fails.
+    class hot_api_trace
+    {
+    public:
+        static const size_t ring_size = 256;
+        static const uint64_t sample_period = 1 << 16;
+
+        // The totals of one API function, logged every sample_period calls
+        class function_stats
+        {
+        public:
+            explicit function_stats(const char* function) : _function(function) {}
+
+            const char* function() const { return _function; }
+
+            void add(int64_t ns)
+            {
+                auto total = _total_ns.fetch_add(ns, std::memory_order_relaxed) + ns;
+                auto max = _max_ns.load(std::memory_order_relaxed);
+                while (ns > max && !_max_ns.compare_exchange_weak(max, ns, std::memory_order_relaxed));
+                auto calls = _calls.fetch_add(1, std::memory_order_relaxed) + 1;
+                if (calls % sample_period == 0)
+                    LOG_DEBUG(_function << ": " << calls << " calls, " << total / int64_t(calls) << " ns on average, "
+                        << std::max(ns, max) << " ns max");
+            }
+
+        private:
+            const char* _function;
+            std::atomic<uint64_t> _calls{ 0 };
+            std::atomic<int64_t> _total_ns{ 0 };
+            std::atomic<int64_t> _max_ns{ 0 };
+        };
+
+        static hot_api_trace& instance()
+        {
+            static hot_api_trace instance;
+            return instance;
+        }
+
+        // Entries being overwritten while they are dumped may come out mixed, which is
+        // acceptable for a trace, but every field is still read and written whole
+        void record(const char* function, std::chrono::high_resolution_clock::time_point start, int64_t ns)
+        {
+            auto& e = _ring[_next.fetch_add(1, std::memory_order_relaxed) % ring_size];
+            e.function.store(function, std::memory_order_relaxed);
+            e.start.store(start.time_since_epoch().count(), std::memory_order_relaxed);
+            e.ns.store(ns, std::memory_order_relaxed);
+        }
+
+        // Logs the recorded calls, oldest first
+        void dump() const
+        {
+            auto next = _next.load(std::memory_order_relaxed);
+            std::stringstream ss;
+            ss << "Last per-frame API calls:";
+            for (auto i = next > ring_size ? next - ring_size : 0; i < next; ++i)
+            {
+                auto& e = _ring[i % ring_size];
+                ss << "\n    " << e.function.load(std::memory_order_relaxed) << " at "
+                    << e.start.load(std::memory_order_relaxed) << " took "
+                    << e.ns.load(std::memory_order_relaxed) << " ns";
+            }
+            LOG_DEBUG(ss.str());
+        }
+
+    private:
+        struct entry
+        {
+            std::atomic<const char*> function{ "" };
+            std::atomic<int64_t> start{ 0 };
+            std::atomic<int64_t> ns{ 0 };
+        };
+
+        hot_api_trace() = default;
+
+        entry _ring[ring_size];
+        std::atomic<uint64_t> _next{ 0 };
+    };
+
+    // Wraps a per-frame API call the way api_logger wraps the others
+    class hot_api_call
+    {
+    public:
+        explicit hot_api_call(hot_api_trace::function_stats& stats)
+            : _stats(stats), _start(std::chrono::high_resolution_clock::now()) {}
+
+        void report_error(const std::string& params)
+        {
+            LOG_ERROR(_stats.function() << "(" << params << ") failed");
+            hot_api_trace::instance().dump();
+        }
+
+        ~hot_api_call()
+        {
+            auto ns = std::chrono::duration_cast<std::chrono::nanoseconds>(
+                std::chrono::high_resolution_clock::now() - _start).count();
+            hot_api_trace::instance().record(_stats.function(), _start, ns);
+            _stats.add(ns);
+        }
+
+    private:
+        hot_api_trace::function_stats& _stats;
+        std::chrono::high_resolution_clock::time_point _start;
+    };
+
     // This dummy helper function lets us fetch return type from lambda
     // this is used for result_printer, to be able to be used
     // similarly for functions with and without return parameter
@@ -392,6 +500,26 @@ try {\
 return __p.invoke(func);\
 } catch(...) { librealsense::translate_exception(__FUNCTION__, "", error); __api_logger.report_error(); return R; } } }
 
+#define NOARGS_HANDLE_EXCEPTIONS_AND_RETURN_VOID() };\
+try {\
+func();\
+} catch(...) { librealsense::translate_exception(__FUNCTION__, "", error); __api_logger.report_error(); } } }
+
+#ifndef TRACE_API_ALL_CALLS
+// Per-frame API calls go through hot_api_call instead, unless TRACE_API_ALL_CALLS is defined
+#define BEGIN_HOT_API_CALL { static librealsense::hot_api_trace::function_stats __hot_api_stats(__FUNCTION__);\
+librealsense::hot_api_call __hot_api_call(__hot_api_stats); try
+
+#define HOT_NOEXCEPT_RETURN(R, ...) catch(...) {\
+std::ostringstream ss; librealsense::stream_args(ss, #__VA_ARGS__, __VA_ARGS__);\
+rs2_error* e; librealsense::translate_exception(__FUNCTION__, ss.str(), &e);\
+LOG_WARNING(rs2_get_error_message(e)); rs2_free_error(e); __hot_api_call.report_error(ss.str()); return R; } }
+
+#define HOT_HANDLE_EXCEPTIONS_AND_RETURN(R, ...) catch(...) {\
+std::ostringstream ss; librealsense::stream_args(ss, #__VA_ARGS__, __VA_ARGS__);\
+librealsense::translate_exception(__FUNCTION__, ss.str(), error); __hot_api_call.report_error(ss.str()); return R; } }
+#endif
+
 #else // No API tracing:
 
 #define BEGIN_API_CALL try
@@ -400,6 +528,13 @@ return __p.invoke(func);\
 #define NOARGS_HANDLE_EXCEPTIONS_AND_RETURN(R) catch(...) { librealsense::translate_exception(__FUNCTION__, "", error); return R; }
 #define NOARGS_HANDLE_EXCEPTIONS_AND_RETURN_VOID() catch(...) { librealsense::translate_exception(__FUNCTION__, "", error); }
 
+#endif
+
+// Without hot_api_call, per-frame API calls are wrapped like any other
+#if !defined(TRACE_API) || defined(TRACE_API_ALL_CALLS)
+#define BEGIN_HOT_API_CALL BEGIN_API_CALL
+#define HOT_NOEXCEPT_RETURN NOEXCEPT_RETURN
+#define HOT_HANDLE_EXCEPTIONS_AND_RETURN HANDLE_EXCEPTIONS_AND_RETURN
 #endif
 
     #define VALIDATE_FIXED_SIZE(ARG, SIZE) if((ARG) != (SIZE)) { std::ostringstream ss; ss << "Unsupported size provided { " << ARG << " }," " expecting { " << SIZE << " }"; throw librealsense::invalid_value_exception(ss.str()); }
@@ -6,6 +6,7 @@
 #include "types.h"
 #include "core/streaming.h"
 #include "callback-invocation.h"
+#include "frame-pool.h"
 
 
 namespace librealsense
@@ -21,6 +22,11 @@ namespace librealsense
 
         virtual std::shared_ptr<metadata_parser_map> get_md_parsers() const = 0;
 
+        virtual frame_pool_stats get_pool_stats() = 0;
+
+        // Frame buffers are obtained from the given allocator instead of the internal pool (null to revert)
+        virtual void set_allocator(frame_allocator_ptr allocator) = 0;
+
         virtual void flush() = 0;
 
         virtual frame_interface* publish_frame(frame_interface* frame) = 0;
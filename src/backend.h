@@ -380,6 +380,14 @@ namespace librealsense
             virtual std::string get_device_location() const = 0;
             virtual usb_spec  get_usb_specification() const = 0;
 
+            // True if the pixels passed to the frame callback stay valid until the frame's
+            // continuation is invoked, so they can be handed to the user without a copy
+            virtual bool holds_frame_buffers() const { return false; }
+
+            // False if every control transfer must reach the device, as for the mock devices that
+            // record or replay the sequence of calls made to them
+            virtual bool allows_control_caching() const { return true; }
+
             virtual ~uvc_device() = default;
 
         protected:
@@ -505,6 +513,16 @@ namespace librealsense
                 return _dev->get_usb_specification();
             }
 
+            bool holds_frame_buffers() const override
+            {
+                return _dev->holds_frame_buffers();
+            }
+
+            bool allows_control_caching() const override
+            {
+                return _dev->allows_control_caching();
+            }
+
             void lock() const override { _dev->lock(); }
             void unlock() const override { _dev->unlock(); }
 
@@ -767,6 +785,22 @@ namespace librealsense
                 return _dev.front()->get_usb_specification();
             }
 
+            bool holds_frame_buffers() const override
+            {
+                for (auto& elem : _dev)
+                    if (!elem->holds_frame_buffers())
+                        return false;
+                return true;
+            }
+
+            bool allows_control_caching() const override
+            {
+                for (auto& elem : _dev)
+                    if (!elem->allows_control_caching())
+                        return false;
+                return true;
+            }
+
             void lock() const override
             {
                 std::vector<uvc_device*> locked_dev;
@@ -5,8 +5,9 @@
 #include "JpegCompression.h"
 #include "Lz4Compression.h"
 #include "RvlCompression.h"
+#include "RvlSliceCompression.h"
 
-std::shared_ptr<ICompression> CompressionFactory::getObject(int t_width, int t_height, rs2_format t_format, rs2_stream t_streamType, int t_bpp)
+std::shared_ptr<ICompression> CompressionFactory::getObject(int t_width, int t_height, rs2_format t_format, rs2_stream t_streamType, int t_bpp, bool t_rvlSlices)
 {
     ZipMethod zipMeth;
     if(t_streamType == RS2_STREAM_COLOR || t_streamType == RS2_STREAM_INFRARED)
@@ -15,7 +16,7 @@ std::shared_ptr<ICompression> CompressionFactory::getObject(int t_width, int t_h
     }
     else if(t_streamType == RS2_STREAM_DEPTH)
     {
-        zipMeth = ZipMethod::lz;
+        zipMeth = t_format == RS2_FORMAT_Z16 && t_rvlSlices ? ZipMethod::rvl_slices : ZipMethod::lz;
     }
     if(!isCompressionSupported(t_format, t_streamType))
     {
@@ -33,6 +34,9 @@ std::shared_ptr<ICompression> CompressionFactory::getObject(int t_width, int t_h
     case ZipMethod::lz:
         return std::make_shared<Lz4Compression>(t_width, t_height, t_format, t_bpp);
         break;
+    case ZipMethod::rvl_slices:
+        return std::make_shared<RvlSliceCompression>(t_width, t_height, t_format, t_bpp);
+        break;
     default:
         ERR << "unknown zip method";
         return nullptr;
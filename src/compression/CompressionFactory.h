@@ -5,6 +5,10 @@
 
 #include "ICompression.h"
 #define IS_COMPRESSION_ENABLED 1 // enabled by default
+// Z16 depth is sent as RVL slices only when both ends support them: the server lists this tag in the
+// SDP of its streams, the client in the User-Agent of its requests. Otherwise depth is sent with LZ4.
+// Each end decides per stream, from what its peer on that stream said.
+#define RVL_SLICES_TAG "rvl_slices"
 
 typedef enum ZipMethod
 {
@@ -12,12 +16,14 @@ typedef enum ZipMethod
     rvl,
     jpeg,
     lz,
+    rvl_slices,
 } ZipMethod;
 
 class CompressionFactory
 {
 public:
-    static std::shared_ptr<ICompression> getObject(int t_width, int t_height, rs2_format t_format, rs2_stream t_streamType, int t_bpp);
+    // t_rvlSlices: whether the peer of this stream supports RVL slices
+    static std::shared_ptr<ICompression> getObject(int t_width, int t_height, rs2_format t_format, rs2_stream t_streamType, int t_bpp, bool t_rvlSlices);
     static bool isCompressionSupported(rs2_format t_format, rs2_stream t_streamType);
     static bool& getIsEnabled();
 };
@@ -0,0 +1,326 @@
+// License: Apache 2.0. See LICENSE file in root directory.
+// Copyright(c) 2021 Intel Corporation. All Rights Reserved.
+
+#include "RvlSliceCompression.h"
+#include <librealsense2/utilities/concurrency/parallel-for.h>
+#include <algorithm>
+#include <atomic>
+#include <cstdint>
+#include <cstring>
+#include <iostream>
+#include <thread>
+
+#ifdef __SSE2__
+#include <emmintrin.h>
+#endif
+
+namespace
+{
+// The nibble stream of RvlCompression::encodeVLE, kept in locals so that slices are coded in parallel
+struct VleWriter
+{
+    uint32_t* m_pBuffer;
+    uint32_t m_word = 0;
+    int m_nibblesWritten = 0;
+
+    explicit VleWriter(int* t_buffer)
+        : m_pBuffer((uint32_t*)t_buffer)
+    {
+    }
+
+    void encode(uint32_t t_value)
+    {
+        do
+        {
+            uint32_t nibble = t_value & 0x7; // lower 3 bits
+            if(t_value >>= 3)
+                nibble |= 0x8; // more to come
+            m_word = (m_word << 4) | nibble;
+            if(++m_nibblesWritten == 8) // output word
+            {
+                *m_pBuffer++ = m_word;
+                m_nibblesWritten = 0;
+                m_word = 0;
+            }
+        } while(t_value);
+    }
+
+    void flush()
+    {
+        if(m_nibblesWritten) // last few values
+            *m_pBuffer++ = m_word << 4 * (8 - m_nibblesWritten);
+    }
+};
+
+// RvlCompression::decodeVLE, failing rather than reading past the end of the slice
+struct VleReader
+{
+    const uint32_t* m_pBuffer;
+    const uint32_t* m_end;
+    uint32_t m_word = 0;
+    int m_nibblesWritten = 0;
+    bool m_ok = true;
+
+    VleReader(const uint32_t* t_buffer, const uint32_t* t_end)
+        : m_pBuffer(t_buffer)
+        , m_end(t_end)
+    {
+    }
+
+    int decode()
+    {
+        uint32_t nibble;
+        int value = 0, bits = 29;
+        do
+        {
+            if(bits < 0 || (!m_nibblesWritten && m_pBuffer == m_end))
+            {
+                m_ok = false; // longer than any value, or past the end
+                return 0;
+            }
+            if(!m_nibblesWritten)
+            {
+                m_word = *m_pBuffer++; // load word
+                m_nibblesWritten = 8;
+            }
+            nibble = m_word & 0xf0000000;
+            value |= (nibble << 1) >> bits;
+            m_word <<= 4;
+            m_nibblesWritten--;
+            bits -= 3;
+        } while(nibble & 0x80000000);
+        return value;
+    }
+};
+
+// The first pixel from t_begin that is not 0 (t_zero true), or that is 0 (t_zero false)
+const short* findRunEnd(const short* t_begin, const short* t_end, bool t_zero)
+{
+    const short* p = t_begin;
+#ifdef __SSE2__
+    const __m128i zero = _mm_setzero_si128();
+    const int runMask = t_zero ? 0xFFFF : 0;
+    while(t_end - p >= 8)
+    {
+        __m128i isZero = _mm_cmpeq_epi16(_mm_loadu_si128((const __m128i*)p), zero);
+        if(_mm_movemask_epi8(isZero) != runMask)
+            break; // the run ends within these 8 pixels
+        p += 8;
+    }
+#endif
+    while(p != t_end && (*p == 0) == t_zero)
+        p++;
+    return p;
+}
+
+// Encodes the deltas of a run of non-zero pixels, each from the one before it (t_previous for the first)
+void encodeDeltas(VleWriter& t_writer, const short* t_pixels, int t_count, short t_previous)
+{
+    int i = 0;
+#ifdef __SSE2__
+    if(t_count > 8)
+    {
+        int delta = t_pixels[0] - t_previous;
+        t_writer.encode((delta << 1) ^ (delta >> 31));
+        i = 1;
+        alignas(16) int positive[8];
+        for(; i + 8 <= t_count; i += 8)
+        {
+            __m128i current = _mm_loadu_si128((const __m128i*)(t_pixels + i));
+            __m128i previous = _mm_loadu_si128((const __m128i*)(t_pixels + i - 1));
+            // sign-extended to 32 bits, as the shorts of RvlCompression are
+            __m128i lo = _mm_sub_epi32(_mm_srai_epi32(_mm_unpacklo_epi16(current, current), 16),
+                                       _mm_srai_epi32(_mm_unpacklo_epi16(previous, previous), 16));
+            __m128i hi = _mm_sub_epi32(_mm_srai_epi32(_mm_unpackhi_epi16(current, current), 16),
+                                       _mm_srai_epi32(_mm_unpackhi_epi16(previous, previous), 16));
+            lo = _mm_xor_si128(_mm_slli_epi32(lo, 1), _mm_srai_epi32(lo, 31));
+            hi = _mm_xor_si128(_mm_slli_epi32(hi, 1), _mm_srai_epi32(hi, 31));
+            _mm_store_si128((__m128i*)positive, lo);
+            _mm_store_si128((__m128i*)(positive + 4), hi);
+            for(int j = 0; j < 8; j++)
+                t_writer.encode(positive[j]);
+        }
+        t_previous = t_pixels[i - 1];
+    }
+#endif
+    for(; i < t_count; i++)
+    {
+        short current = t_pixels[i];
+        int delta = current - t_previous;
+        int positive = (delta << 1) ^ (delta >> 31);
+        t_writer.encode(positive);
+        t_previous = current;
+    }
+}
+
+// Codes the pixels as RvlCompression::compressBuffer does, returning the number of words written
+int encodeSlice(const short* t_pixels, const short* t_end, int* t_compressed)
+{
+    VleWriter writer(t_compressed);
+    short previous = 0;
+    while(t_pixels != t_end)
+    {
+        const short* nonzero = findRunEnd(t_pixels, t_end, true);
+        writer.encode(uint32_t(nonzero - t_pixels));
+        const short* zero = findRunEnd(nonzero, t_end, false);
+        int nonzeros = int(zero - nonzero);
+        writer.encode(nonzeros);
+        encodeDeltas(writer, nonzero, nonzeros, previous);
+        if(nonzeros)
+            previous = zero[-1];
+        t_pixels = zero;
+    }
+    writer.flush();
+    return int((int*)writer.m_pBuffer - t_compressed);
+}
+
+bool decodeSlice(const uint32_t* t_compressed, const uint32_t* t_compressedEnd, short* t_pixels, short* t_end)
+{
+    VleReader reader(t_compressed, t_compressedEnd);
+    short previous = 0;
+    while(t_pixels != t_end)
+    {
+        int zeros = reader.decode();
+        if(!reader.m_ok || zeros < 0 || zeros > t_end - t_pixels)
+            return false;
+        memset(t_pixels, 0, zeros * sizeof(short));
+        t_pixels += zeros;
+        int nonzeros = reader.decode();
+        if(!reader.m_ok || nonzeros < 0 || nonzeros > t_end - t_pixels)
+            return false;
+        for(; nonzeros; nonzeros--)
+        {
+            int positive = reader.decode();
+            int delta = (positive >> 1) ^ -(positive & 1);
+            short current = previous + delta;
+            *t_pixels++ = current;
+            previous = current;
+        }
+        if(!reader.m_ok)
+            return false;
+    }
+    return true;
+}
+} // namespace
+
+RvlSliceCompression::RvlSliceCompression(int t_width, int t_height, rs2_format t_format, int t_bpp, int t_slices)
+    : ICompression(t_width, t_height, t_format, t_bpp)
+    , m_slices(t_slices)
+{
+    if(m_slices <= 0)
+    {
+        m_slices = int(std::thread::hardware_concurrency());
+    }
+    m_slices = std::max(1, std::min({m_slices, MAX_SLICES, m_height}));
+    m_sliceBuffers.resize(m_slices);
+    m_sliceSizes.resize(m_slices);
+    for(int i = 0; i < m_slices; i++)
+    {
+        // at most 8 nibbles per pixel: 1 for each run length and 6 for the delta
+        int pixels = (getSliceRow(i + 1, m_slices) - getSliceRow(i, m_slices)) * m_width;
+        m_sliceBuffers[i].resize(pixels + 1);
+    }
+}
+
+int RvlSliceCompression::getSliceRow(int t_slice, int t_slices) const
+{
+    return int((long long)t_slice * m_height / t_slices);
+}
+
+int RvlSliceCompression::compressBuffer(unsigned char* t_buffer, int t_size, unsigned char* t_compressedBuf)
+{
+    if(t_size < m_width * m_height * (int)sizeof(short))
+    {
+        ERR << "Compression failed, the frame is smaller than " << m_width << "x" << m_height;
+        return -1;
+    }
+    const short* pixels = (const short*)t_buffer;
+
+    parallel_for(m_slices, [&](size_t t_first, size_t t_last) {
+        for(int i = int(t_first); i < int(t_last); i++)
+        {
+            m_sliceSizes[i] = encodeSlice(pixels + getSliceRow(i, m_slices) * m_width,
+                                          pixels + getSliceRow(i + 1, m_slices) * m_width,
+                                          m_sliceBuffers[i].data());
+        }
+    });
+
+    int compressedSize = int(sizeof(int) * (1 + m_slices));
+    for(int i = 0; i < m_slices; i++)
+    {
+        compressedSize += m_sliceSizes[i] * sizeof(int);
+    }
+    int compressWithHeaderSize = compressedSize + sizeof(compressedSize);
+    if(compressWithHeaderSize > t_size)
+    {
+        ERR << "Compression overflow, destination buffer is smaller than the compressed size";
+        return -1;
+    }
+
+    int* table = (int*)(t_compressedBuf + sizeof(compressedSize));
+    table[0] = m_slices;
+    int* slice = table + 1 + m_slices;
+    for(int i = 0; i < m_slices; i++)
+    {
+        table[1 + i] = m_sliceSizes[i];
+        memcpy(slice, m_sliceBuffers[i].data(), m_sliceSizes[i] * sizeof(int));
+        slice += m_sliceSizes[i];
+    }
+    if(m_compFrameCounter++ % 50 == 0)
+    {
+        INF << "frame " << m_compFrameCounter << "\tdepth\tcompression\trvl\t" << t_size << "\t/\t" << compressedSize;
+    }
+    memcpy(t_compressedBuf, &compressedSize, sizeof(compressedSize));
+    return compressWithHeaderSize;
+}
+
+int RvlSliceCompression::decompressBuffer(unsigned char* t_buffer, int t_size, unsigned char* t_uncompressedBuf)
+{
+    const uint32_t* table = (const uint32_t*)t_buffer;
+    int words = t_size / sizeof(int);
+    int slices = words > 0 ? int(table[0]) : 0;
+    if(slices < 1 || slices > MAX_SLICES || slices > m_height || slices >= words)
+    {
+        ERR << "Failure trying to decompress the frame: invalid slice table";
+        return -1;
+    }
+
+    // the start of each slice's code, and the end of the last
+    const uint32_t* starts[MAX_SLICES + 1];
+    starts[0] = table + 1 + slices;
+    for(int i = 0; i < slices; i++)
+    {
+        if(table[1 + i] > uint32_t(table + words - starts[i]))
+        {
+            ERR << "Failure trying to decompress the frame: invalid slice table";
+            return -1;
+        }
+        starts[i + 1] = starts[i] + table[1 + i];
+    }
+
+    short* pixels = (short*)t_uncompressedBuf;
+    std::atomic<bool> ok(true);
+    parallel_for(slices, [&](size_t t_first, size_t t_last) {
+        for(int i = int(t_first); i < int(t_last); i++)
+        {
+            if(!decodeSlice(starts[i], starts[i + 1],
+                            pixels + getSliceRow(i, slices) * m_width,
+                            pixels + getSliceRow(i + 1, slices) * m_width))
+            {
+                ok = false;
+            }
+        }
+    });
+    if(!ok)
+    {
+        ERR << "Failure trying to decompress the frame.";
+        return -1;
+    }
+
+    int uncompressedSize = m_width * m_height * sizeof(short);
+    if(m_decompFrameCounter++ % 50 == 0)
+    {
+        INF << "frame " << m_decompFrameCounter << "\tdepth\tdecompression\trvl\t" << t_size << "\t/\t" << uncompressedSize;
+    }
+    return uncompressedSize;
+}
@@ -0,0 +1,30 @@
+// License: Apache 2.0. See LICENSE file in root directory.
+// Copyright(c) 2021 Intel Corporation. All Rights Reserved.
+
+#pragma once
+
+#include "ICompression.h"
+
+#include <vector>
+
+// RVL depth compression, with the image cut into horizontal slices that are coded independently so
+// that they can be encoded and decoded in parallel. The compressed data starts with a slice table:
+// the number of slices, then the size of each in 32-bit words. Each slice is then coded exactly as
+// RvlCompression codes an image made of its rows alone.
+class RvlSliceCompression : public ICompression
+{
+public:
+    // With t_slices 0, as many slices as there are cores (up to MAX_SLICES)
+    RvlSliceCompression(int t_width, int t_height, rs2_format t_format, int t_bpp, int t_slices = 0);
+    int compressBuffer(unsigned char* t_buffer, int t_size, unsigned char* t_compressedBuf);
+    int decompressBuffer(unsigned char* t_buffer, int t_size, unsigned char* t_uncompressedBuf);
+
+    static const int MAX_SLICES = 16;
+
+private:
+    int getSliceRow(int t_slice, int t_slices) const;
+
+    int m_slices;
+    std::vector<std::vector<int>> m_sliceBuffers; // the code of each slice, before it is copied out
+    std::vector<int> m_sliceSizes;
+};
@@ -593,6 +593,25 @@ namespace librealsense
         on_device_changed({},{}, prev_playback_devices, _playback_devices);
     }
 
+    std::shared_ptr<executor> context::get_executor()
+    {
+        std::lock_guard<std::mutex> lock(_executor_mutex);
+        if (!_executor)
+            _executor = std::make_shared<executor>();
+        return _executor;
+    }
+
+    void context::set_executor(int threads, std::vector<int> cpus)
+    {
+        // Blocks already attached keep running on the previous executor until re-attached
+        // The previous executor drains its tasks when released, which must not happen under the lock
+        auto e = std::make_shared<executor>(threads, std::move(cpus));
+        {
+            std::lock_guard<std::mutex> lock(_executor_mutex);
+            std::swap(_executor, e);
+        }
+    }
+
 #if WITH_TRACKING
     void context::unload_tracking_module()
     {
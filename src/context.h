@@ -7,6 +7,7 @@
 #include "backend.h"
 #include "mock/recorder.h"
 #include "core/streaming.h"
+#include "executor.h"
 
 #include <vector>
 #include "media/playback/playback_device.h"
@@ -129,6 +130,11 @@ namespace librealsense
 
         void add_software_device(std::shared_ptr<device_info> software_device);
 
+        // The worker threads that processing blocks attached to this context run on; created with
+        // one thread per hardware thread on first use, unless configured otherwise
+        std::shared_ptr<executor> get_executor();
+        void set_executor(int threads, std::vector<int> cpus);
+
 #if WITH_TRACKING
         void unload_tracking_module();
 #endif
@@ -151,6 +157,9 @@ namespace librealsense
         std::map<int, std::weak_ptr<const stream_interface>> _streams;
         std::map<int, std::map<int, std::weak_ptr<lazy<rs2_extrinsics>>>> _extrinsics;
         std::mutex _streams_mutex, _devices_changed_callbacks_mtx;
+
+        std::shared_ptr<executor> _executor;
+        std::mutex _executor_mutex;
     };
 
     class readonly_device_info : public device_info
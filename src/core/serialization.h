@@ -330,6 +330,8 @@ namespace librealsense
             virtual void write_snapshot(const sensor_identifier& sensor_id, const nanoseconds& timestamp, rs2_extension type, const std::shared_ptr<extension_snapshot>& snapshot) = 0;
             virtual void write_notification(const sensor_identifier& stream_id, const nanoseconds& timestamp, const notification& n) = 0;
             virtual const std::string& get_file_name() const = 0;
+            // Lets the writer keep a copy of the message index in a sidecar file next to the file, written when it is closed
+            virtual void set_index_file(bool enabled) = 0;
             virtual ~writer() = default;
         };
 
@@ -346,6 +348,11 @@ namespace librealsense
             virtual void disable_stream(const std::vector<device_serializer::stream_identifier>& stream_ids) = 0;
             virtual const std::string& get_file_name() const = 0;
             virtual std::vector<std::shared_ptr<serialized_data>> fetch_last_frames(const nanoseconds& seek_time) = 0;
+            // Lets the reader read up to 'bytes' of data ahead of read_next_data() in the background; 0 disables it
+            virtual void set_read_ahead(size_t bytes) = 0;
+            // Lets the reader load the message index from a sidecar file next to the file, creating it if missing or
+            // stale; applies from the next reset()
+            virtual void set_index_file(bool enabled) = 0;
         };
     }
 }
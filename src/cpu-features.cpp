@@ -0,0 +1,88 @@
+// License: Apache 2.0. See LICENSE file in root directory.
+// Copyright(c) 2021 Intel Corporation. All Rights Reserved.
+
+#include "cpu-features.h"
+
+#if defined( _M_X64 ) || defined( _M_IX86 )
+#include <intrin.h>
+#define LRS_X86_CPUID
+#elif ( defined( __x86_64__ ) || defined( __i386__ ) ) && ! defined( ANDROID )
+#include <cpuid.h>
+#define LRS_X86_CPUID
+#endif
+
+
+namespace librealsense {
+
+
+#ifdef LRS_X86_CPUID
+
+namespace {
+
+struct cpu_features
+{
+    bool sse41 = false;
+    bool avx2 = false;
+
+    cpu_features()
+    {
+        int info[4] = {};
+        cpuid( info, 0 );
+        int const max_leaf = info[0];
+        if( max_leaf < 1 )
+            return;
+
+        cpuid( info, 1 );
+        sse41 = ( info[2] & ( 1 << 19 ) ) != 0;
+        bool const osxsave = ( info[2] & ( 1 << 27 ) ) != 0;
+        bool const avx = ( info[2] & ( 1 << 28 ) ) != 0;
+
+        // The OS must have enabled saving of the XMM and YMM state
+        if( max_leaf < 7 || ! osxsave || ! avx || ( xgetbv0() & 6 ) != 6 )
+            return;
+
+        cpuid( info, 7 );
+        avx2 = ( info[1] & ( 1 << 5 ) ) != 0;
+    }
+
+    static void cpuid( int info[4], int leaf )
+    {
+#ifdef _MSC_VER
+        __cpuidex( info, leaf, 0 );
+#else
+        __cpuid_count( leaf, 0, info[0], info[1], info[2], info[3] );
+#endif
+    }
+
+    static unsigned long long xgetbv0()
+    {
+#ifdef _MSC_VER
+        return _xgetbv( 0 );
+#else
+        unsigned eax, edx;
+        __asm__ volatile( "xgetbv" : "=a"( eax ), "=d"( edx ) : "c"( 0 ) );
+        return ( (unsigned long long)edx << 32 ) | eax;
+#endif
+    }
+};
+
+cpu_features const & features()
+{
+    static cpu_features const f;
+    return f;
+}
+
+}  // namespace
+
+bool cpu_has_sse41() { return features().sse41; }
+bool cpu_has_avx2() { return features().avx2; }
+
+#else
+
+bool cpu_has_sse41() { return false; }
+bool cpu_has_avx2() { return false; }
+
+#endif
+
+
+}  // namespace librealsense
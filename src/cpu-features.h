@@ -0,0 +1,21 @@
+// License: Apache 2.0. See LICENSE file in root directory.
+// Copyright(c) 2021 Intel Corporation. All Rights Reserved.
+
+#pragma once
+
+
+namespace librealsense {
+
+
+// Run-time checks for the instruction-set extensions our optimized kernels are built for. Kernels
+// compiled with e.g. -mavx2 may only be called when the CPU we actually run on (and its OS, which
+// must save the wider registers on context switches) supports them. The result is computed once.
+//
+// The *_avx2 kernels live in src/proc/sse/avx-*.cpp, the only sources built for AVX2 (see the
+// CMakeLists.txt there), and must only be called when cpu_has_avx2(). When the compiler does not
+// target AVX2 they fall back to their SSE counterparts, or process nothing where there are none.
+bool cpu_has_sse41();
+bool cpu_has_avx2();
+
+
+}  // namespace librealsense
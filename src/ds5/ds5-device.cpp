@@ -919,6 +919,7 @@ namespace librealsense
 
                     // D457 dev - get_xu fails for D457 - error polling id not defined
                     auto error_control = std::make_shared<uvc_xu_option<uint8_t>>(raw_depth_sensor, depth_xu, DS5_ERROR_REPORTING, "Error reporting");
+                    error_control->mark_volatile();
 
                     _polling_error_handler = std::make_shared<polling_error_handler>(1000,
                         error_control,
@@ -951,6 +952,7 @@ namespace librealsense
                 depth_xu,
                 DS5_EXPOSURE,
                 "Depth Exposure (usec)");
+            uvc_xu_exposure_option->mark_volatile(); // set by the camera's auto-exposure
             option_range exposure_range = uvc_xu_exposure_option->get_range();
             auto uvc_pu_gain_option = std::make_shared<uvc_pu_option>(raw_depth_sensor, RS2_OPTION_GAIN);
             option_range gain_range = uvc_pu_gain_option->get_range();
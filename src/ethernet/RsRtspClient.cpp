@@ -48,7 +48,7 @@ IRsRtsp *RsRTSPClient::createNew(char const *t_rtspURL, char const *t_applicatio
 }
 
 RsRTSPClient::RsRTSPClient(TaskScheduler *t_scheduler, UsageEnvironment *t_env, char const *t_rtspURL, int t_verbosityLevel, char const *t_applicationName, portNumBits t_tunnelOverHTTPPortNum, int idx)
-    : RTSPClient(*t_env, t_rtspURL, t_verbosityLevel, t_applicationName, t_tunnelOverHTTPPortNum, -1)
+    : RTSPClient(*t_env, t_rtspURL, t_verbosityLevel, (std::string(t_applicationName) + " " RVL_SLICES_TAG).c_str(), t_tunnelOverHTTPPortNum, -1)
 {
     m_lastReturnValue.exit_code = RsRtspReturnCode::OK;
     m_env = t_env;
@@ -18,12 +18,13 @@ RsSink* RsSink::createNew(UsageEnvironment& t_env, MediaSubsession& t_subsession
 
 RsSink::RsSink(UsageEnvironment& t_env, MediaSubsession& t_subsession, rs2_video_stream t_stream, MemoryPool* t_memPool, char const* t_streamId)
     : MediaSink(t_env)
-    , m_memPool(t_memPool)
+    , m_bufferSize(t_stream.width * t_stream.height * t_stream.bpp + sizeof(RsFrameHeader))
     , m_subsession(t_subsession)
+    , m_memPool(t_memPool)
+    , m_receiver(*t_memPool, m_bufferSize)
 {
     m_stream = t_stream;
     m_streamId = strDup(t_streamId);
-    m_bufferSize = t_stream.width * t_stream.height * t_stream.bpp + sizeof(RsFrameHeader);
     m_receiveBuffer = nullptr;
     m_to = nullptr;
     std::string urlStr = m_streamId;
@@ -49,7 +50,8 @@ RsSink::RsSink(UsageEnvironment& t_env, MediaSubsession& t_subsession, rs2_video
     */
     if(CompressionFactory::isCompressionSupported(m_stream.fmt, m_stream.type))
     {
-        m_iCompress = CompressionFactory::getObject(m_stream.width, m_stream.height, m_stream.fmt, m_stream.type, m_stream.bpp);
+        // Servers that do not list RVL slices in the SDP of the stream send its depth with LZ4
+        m_iCompress = CompressionFactory::getObject(m_stream.width, m_stream.height, m_stream.fmt, m_stream.type, m_stream.bpp, m_subsession.attrVal_bool(RVL_SLICES_TAG));
     }
     else
     {
@@ -59,10 +61,7 @@ RsSink::RsSink(UsageEnvironment& t_env, MediaSubsession& t_subsession, rs2_video
 
 RsSink::~RsSink()
 {
-    if(m_receiveBuffer != nullptr)
-    {
-        m_memPool->returnMem(m_receiveBuffer);
-    }
+    // a buffer still receiving is returned by m_receiver
     delete[] m_streamId;
     //fclose(fp);
 }
@@ -100,6 +99,15 @@ void RsSink::afterGettingFrameUid3(void* t_clientData, unsigned t_frameSize, uns
 
 void RsSink::afterGettingFrame(unsigned t_frameSize, unsigned t_numTruncatedBytes, struct timeval t_presentationTime, unsigned /*t_durationInMicroseconds*/)
 {
+    m_receiveBuffer = m_receiver.take();
+    if(m_receiveBuffer == nullptr)
+    {
+        // received into our own buffer, as the pool had none left
+        dropFrame();
+        continuePlaying();
+        return;
+    }
+
     RsNetworkHeader* header = (RsNetworkHeader*)m_receiveBuffer;
     if(header->data.frameSize == t_frameSize - sizeof(RsNetworkHeader))
     {
@@ -107,17 +115,26 @@ void RsSink::afterGettingFrame(unsigned t_frameSize, unsigned t_numTruncatedByte
         {
             if(CompressionFactory::isCompressionSupported(m_stream.fmt, m_stream.type) && m_iCompress != nullptr)
             {
-                m_to = m_memPool->getNextMem();
-                if(m_to == nullptr)
+                // the frame is dropped if there is no buffer to decompress it to
+                m_to = m_memPool->getNextMem(m_bufferSize);
+                if(m_to != nullptr)
                 {
-                    return;
+                    int decompressedSize = m_iCompress->decompressBuffer(m_receiveBuffer + sizeof(RsFrameHeader), header->data.frameSize - sizeof(RsMetadataHeader), m_to + sizeof(RsFrameHeader));
+                    if(decompressedSize != -1)
+                    {
+                        // copy metadata
+                        memcpy(m_to + sizeof(RsNetworkHeader), m_receiveBuffer + sizeof(RsNetworkHeader), sizeof(RsMetadataHeader));
+                        this->m_rtpCallback->on_frame((u_int8_t*)m_to + sizeof(RsNetworkHeader), decompressedSize + sizeof(RsMetadataHeader), t_presentationTime);
+                    }
+                    else
+                    {
+                        m_memPool->returnMem(m_to);
+                    }
+                    m_to = nullptr;
                 }
-                int decompressedSize = m_iCompress->decompressBuffer(m_receiveBuffer + sizeof(RsFrameHeader), header->data.frameSize - sizeof(RsMetadataHeader), m_to + sizeof(RsFrameHeader));
-                if(decompressedSize != -1)
+                else
                 {
-                    // copy metadata
-                    memcpy(m_to + sizeof(RsNetworkHeader), m_receiveBuffer + sizeof(RsNetworkHeader), sizeof(RsMetadataHeader));
-                    this->m_rtpCallback->on_frame((u_int8_t*)m_to + sizeof(RsNetworkHeader), decompressedSize + sizeof(RsMetadataHeader), t_presentationTime);
+                    dropFrame();
                 }
                 m_memPool->returnMem(m_receiveBuffer);
             }
@@ -150,15 +167,9 @@ Boolean RsSink::continuePlaying()
         return False; // sanity check (should not happen)
 
     // Request the next frame of data from our input source.  "afterGettingFrame()" will get called later, when it arrives:
-    m_receiveBuffer = m_memPool->getNextMem();
-    if(m_receiveBuffer == nullptr)
-    {
-        return false;
-    }
-
     if(m_stream.uid >= 0 && m_stream.uid < m_afterGettingFunctions.size())
     {
-        fSource->getNextFrame(m_receiveBuffer, m_bufferSize, m_afterGettingFunctions.at(m_stream.uid), this, onSourceClosure, this);
+        fSource->getNextFrame(m_receiver.next(), m_bufferSize, m_afterGettingFunctions.at(m_stream.uid), this, onSourceClosure, this);
     }
     else
     {
@@ -168,6 +179,16 @@ Boolean RsSink::continuePlaying()
     return True;
 }
 
+void RsSink::dropFrame()
+{
+    // logged once in a while, as when it happens it happens to most frames
+    if(m_droppedFrames++ % 100 == 0)
+    {
+        auto stats = m_memPool->getStats();
+        ERR << m_streamId << ": out of frame buffers (" << stats.inUse << " in use), " << m_droppedFrames << " frames dropped so far";
+    }
+}
+
 void RsSink::setCallback(rtp_callback* t_callback)
 {
     this->m_rtpCallback = t_callback;
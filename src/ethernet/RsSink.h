@@ -24,6 +24,12 @@ public:
 
     void setCallback(rtp_callback* t_callback);
 
+    // frames dropped for lack of a buffer to receive or decompress them to
+    uint64_t getDroppedFrames() const
+    {
+        return m_droppedFrames;
+    }
+
 private:
     RsSink(UsageEnvironment& t_env, MediaSubsession& t_subsession, rs2_video_stream t_stream, MemoryPool* t_mempool, char const* t_streamId);
     // called only by "createNew()"
@@ -34,6 +40,7 @@ private:
     static void afterGettingFrameUid2(void* t_clientData, unsigned t_frameSize, unsigned t_numTruncatedBytes, struct timeval t_presentationTime, unsigned t_durationInMicroseconds);
     static void afterGettingFrameUid3(void* t_clientData, unsigned t_frameSize, unsigned t_numTruncatedBytes, struct timeval t_presentationTime, unsigned t_durationInMicroseconds);
     void afterGettingFrame(unsigned t_frameSize, unsigned t_numTruncatedBytes, struct timeval t_presentationTime, unsigned t_durationInMicroseconds);
+    void dropFrame();
 
 private:
     // redefined virtual functions:
@@ -51,6 +58,8 @@ private:
     rs2_video_stream m_stream;
     std::shared_ptr<ICompression> m_iCompress;
     MemoryPool* m_memPool;
+    ReceiveBuffer m_receiver;
+    uint64_t m_droppedFrames = 0;
     std::vector<FramedSource::afterGettingFunc*> m_afterGettingFunctions;
 };
 
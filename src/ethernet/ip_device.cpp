@@ -8,6 +8,7 @@
 #include <librealsense2-net/rs_net.h>
 
 #include <chrono>
+#include <limits>
 #include <list>
 #include <thread>
 #include <iostream>
@@ -373,16 +374,16 @@ void ip_device::inject_frames_loop(std::shared_ptr<rs_rtp_stream> rtp_stream)
         {
             if(rtp_stream.get()->queue_size() != 0)
             {
-                Raw_Frame* frame = rtp_stream.get()->extract_frame();
-                rtp_stream.get()->frame_data_buff.pixels = frame->m_buffer;
+                Raw_Frame frame = rtp_stream.get()->extract_frame();
+                rtp_stream.get()->frame_data_buff.pixels = frame.m_buffer;
 
-                rtp_stream.get()->frame_data_buff.timestamp = frame->m_metadata->data.timestamp;
+                rtp_stream.get()->frame_data_buff.timestamp = frame.m_metadata->data.timestamp;
 
                 rtp_stream.get()->frame_data_buff.frame_number++;
-                rtp_stream.get()->frame_data_buff.domain = frame->m_metadata->data.timestampDomain;
+                rtp_stream.get()->frame_data_buff.domain = frame.m_metadata->data.timestampDomain;
 
                 remote_sensors[sensor_id]->sw_sensor->set_metadata(RS2_FRAME_METADATA_FRAME_TIMESTAMP, rtp_stream.get()->frame_data_buff.timestamp);
-                remote_sensors[sensor_id]->sw_sensor->set_metadata(RS2_FRAME_METADATA_ACTUAL_FPS, frame->m_metadata->data.actualFps);
+                remote_sensors[sensor_id]->sw_sensor->set_metadata(RS2_FRAME_METADATA_ACTUAL_FPS, frame.m_metadata->data.actualFps);
                 remote_sensors[sensor_id]->sw_sensor->set_metadata(RS2_FRAME_METADATA_FRAME_COUNTER, rtp_stream.get()->frame_data_buff.frame_number);
                 remote_sensors[sensor_id]->sw_sensor->set_metadata(RS2_FRAME_METADATA_FRAME_EMITTER_MODE, 1);
 
@@ -423,3 +424,10 @@ rs2_device* rs2_create_net_device(int api_version, const char* address, rs2_erro
     return sw_dev.get().get();
 }
 HANDLE_EXCEPTIONS_AND_RETURN(nullptr, api_version, address)
+
+void rs2_net_device_set_max_frame_buffers(int max_buffers, rs2_error** error) BEGIN_API_CALL
+{
+    VALIDATE_RANGE(max_buffers, 1, std::numeric_limits<int>::max());
+    rs_rtp_stream::get_memory_pool().setMaxBuffers(max_buffers);
+}
+HANDLE_EXCEPTIONS_AND_RETURN(, max_buffers)
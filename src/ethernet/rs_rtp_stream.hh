@@ -13,6 +13,7 @@
 
 const int RTP_QUEUE_MAX_SIZE = 30;
 
+// A frame received, in a buffer of the memory pool that is returned by whoever consumes the frame
 struct Raw_Frame
 {
     Raw_Frame(char* buffer, int size, struct timeval timestamp)
@@ -20,12 +21,6 @@ struct Raw_Frame
         , m_buffer(buffer + sizeof(RsMetadataHeader))
         , m_size(size)
         , m_timestamp(timestamp){};
-    Raw_Frame(const Raw_Frame&);
-    Raw_Frame& operator=(const Raw_Frame&);
-    ~Raw_Frame()
-    {
-        delete[] m_buffer;
-    };
 
     RsMetadataHeader* m_metadata;
     char* m_buffer;
@@ -60,11 +55,12 @@ public:
         return m_rs_stream.type;
     }
 
-    void insert_frame(Raw_Frame* new_raw_frame)
+    void insert_frame(const Raw_Frame& new_raw_frame)
     {
         if(queue_size() > RTP_QUEUE_MAX_SIZE)
         {
             ERR << "Queue is full. Dropping frame for: " << this->m_rs_stream.uid;
+            frame_deleter(new_raw_frame.m_buffer);
         }
         else
         {
@@ -77,10 +73,10 @@ public:
     // the key is generated by RsRTSPClient::getStreamProfileUniqueKey function
     std::map<long long int, rs2_extrinsics> extrinsics_map;
 
-    Raw_Frame* extract_frame()
+    Raw_Frame extract_frame()
     {
         std::lock_guard<std::mutex> lock(this->stream_lock);
-        Raw_Frame* frame = frames_queue.front();
+        Raw_Frame frame = frames_queue.front();
         frames_queue.pop();
         return frame;
     }
@@ -89,11 +85,14 @@ public:
     {
         while(!frames_queue.empty())
         {
-            Raw_Frame* frame = frames_queue.front();
-            get_memory_pool().returnMem((unsigned char*)frame->m_buffer - sizeof(RsFrameHeader));
+            frame_deleter(frames_queue.front().m_buffer);
             frames_queue.pop();
         }
         INF << "Frames queue cleaned for " << m_rs_stream.uid;
+
+        auto stats = get_memory_pool().getStats();
+        DBG << "Frame buffers: " << stats.allocations << " allocated, " << stats.reuses << " reused, "
+            << stats.exhaustions << " requests refused, " << stats.inUse << " in use (at most " << stats.highWaterMark << ")";
     }
 
     int queue_size()
@@ -104,8 +103,9 @@ public:
 
     static MemoryPool& get_memory_pool()
     {
-        static MemoryPool memory_pool_instance = MemoryPool();
-        return memory_pool_instance;
+        // never destroyed, as frames still held by the application at exit return their buffers to it
+        static MemoryPool* memory_pool_instance = new MemoryPool();
+        return *memory_pool_instance;
     }
 
     bool is_enabled;
@@ -124,7 +124,7 @@ private:
 
     std::mutex stream_lock;
 
-    std::queue<Raw_Frame*> frames_queue;
+    std::queue<Raw_Frame> frames_queue;
 
     std::vector<uint8_t> pixels_buff;
 };
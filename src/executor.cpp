@@ -0,0 +1,324 @@
+// License: Apache 2.0. See LICENSE file in root directory.
+// Copyright(c) 2021 Intel Corporation. All Rights Reserved.
+
+#include "executor.h"
+
+#include <librealsense2/utilities/easylogging/easyloggingpp.h>
+
+#include <algorithm>
+
+#ifdef _WIN32
+#include <windows.h>
+#elif defined( __linux__ ) && ! defined( __ANDROID__ )
+#include <pthread.h>
+#include <sched.h>
+#endif
+
+
+namespace librealsense {
+
+
+struct executor::pool
+{
+    struct worker
+    {
+        std::mutex mutex;
+        std::deque< task > tasks;
+        std::thread thread;
+    };
+
+    std::vector< std::unique_ptr< worker > > workers;
+    std::atomic< size_t > next{ 0 };
+
+    std::mutex idle_mutex;
+    std::condition_variable idle_cv;
+    size_t pending = 0;  // tasks posted and not yet picked up; guarded by idle_mutex
+    bool stopping = false;
+
+    bool try_pop( size_t index, task & t );
+    void work( size_t index );
+};
+
+
+namespace {
+
+// The worker (of any executor) running on this thread, so tasks it posts stay local to it
+thread_local void const * this_pool = nullptr;
+thread_local size_t this_worker = 0;
+
+void set_affinity( std::thread & thread, int cpu )
+{
+#ifdef _WIN32
+    if( ! SetThreadAffinityMask( thread.native_handle(), DWORD_PTR( 1 ) << cpu ) )
+        LOG_WARNING( "Failed to set executor thread affinity to CPU " << cpu );
+#elif defined( __linux__ ) && ! defined( __ANDROID__ )
+    cpu_set_t set;
+    CPU_ZERO( &set );
+    CPU_SET( cpu, &set );
+    if( pthread_setaffinity_np( thread.native_handle(), sizeof( set ), &set ) )
+        LOG_WARNING( "Failed to set executor thread affinity to CPU " << cpu );
+#else
+    LOG_WARNING( "Executor thread affinity is not supported on this platform" );
+#endif
+}
+
+void run_task( executor::task const & t )
+{
+    try
+    {
+        t();
+    }
+    catch( std::exception const & e )
+    {
+        LOG_ERROR( "Executor task exception caught: " << e.what() );
+    }
+    catch( ... )
+    {
+        LOG_ERROR( "Executor task unknown exception caught!" );
+    }
+}
+
+}  // namespace
+
+
+bool executor::pool::try_pop( size_t index, task & t )
+{
+    // Our own tasks first, then the oldest task of any other worker
+    for( size_t i = 0; i < workers.size(); ++i )
+    {
+        auto & w = *workers[( index + i ) % workers.size()];
+        std::lock_guard< std::mutex > lock( w.mutex );
+        if( ! w.tasks.empty() )
+        {
+            t = std::move( w.tasks.front() );
+            w.tasks.pop_front();
+            return true;
+        }
+    }
+    return false;
+}
+
+
+void executor::pool::work( size_t index )
+{
+    this_pool = this;
+    this_worker = index;
+
+    while( true )
+    {
+        {
+            // Tasks still pending when the executor is released are run before exiting, so
+            // whatever they hold (frames, strands) is let go of in order
+            std::unique_lock< std::mutex > lock( idle_mutex );
+            idle_cv.wait( lock, [this]() { return stopping || pending > 0; } );
+            if( ! pending )
+                return;
+            --pending;
+        }
+
+        // 'pending' promised us a task; it may have been stolen already, in which case the thief
+        // consumed someone else's promise and ours will be found elsewhere
+        task t;
+        while( ! try_pop( index, t ) )
+            std::this_thread::yield();
+        run_task( t );
+    }
+}
+
+
+executor::executor( int threads, std::vector< int > cpus )
+    : _pool( std::make_shared< pool >() )
+{
+    if( threads <= 0 )
+        threads = std::max( 1u, std::thread::hardware_concurrency() );
+
+    for( int i = 0; i < threads; ++i )
+        _pool->workers.emplace_back( new pool::worker );
+
+    // Threads are only started once all workers exist, as they steal from each other
+    for( size_t i = 0; i < _pool->workers.size(); ++i )
+    {
+        auto p = _pool;
+        _pool->workers[i]->thread = std::thread( [p, i]() { p->work( i ); } );
+        if( ! cpus.empty() )
+            set_affinity( _pool->workers[i]->thread, cpus[i % cpus.size()] );
+    }
+}
+
+
+executor::~executor()
+{
+    {
+        std::lock_guard< std::mutex > lock( _pool->idle_mutex );
+        _pool->stopping = true;
+    }
+    _pool->idle_cv.notify_all();
+
+    for( auto & w : _pool->workers )
+    {
+        // Released from one of our own tasks: that thread exits on its own once the task returns
+        if( w->thread.get_id() == std::this_thread::get_id() )
+            w->thread.detach();
+        else if( w->thread.joinable() )
+            w->thread.join();
+    }
+}
+
+
+int executor::get_thread_count() const
+{
+    return static_cast< int >( _pool->workers.size() );
+}
+
+
+bool executor::is_worker_thread() const
+{
+    return this_pool == _pool.get();
+}
+
+
+void executor::post( task t )
+{
+    auto index = this_pool == _pool.get() ? this_worker : _pool->next++ % _pool->workers.size();
+    {
+        auto & w = *_pool->workers[index];
+        std::lock_guard< std::mutex > lock( w.mutex );
+        w.tasks.push_back( std::move( t ) );
+    }
+    {
+        std::lock_guard< std::mutex > lock( _pool->idle_mutex );
+        ++_pool->pending;
+    }
+    _pool->idle_cv.notify_one();
+}
+
+
+std::shared_ptr< executor::strand > executor::make_strand( size_t capacity, int concurrency )
+{
+    return std::make_shared< strand >( shared_from_this(), capacity, concurrency );
+}
+
+
+executor::strand::strand( std::shared_ptr< executor > owner, size_t capacity, int concurrency )
+    : _owner( std::move( owner ) )
+    , _capacity( std::max< size_t >( 1, capacity ) )
+    , _concurrency( std::max( 1, concurrency ) )
+    , _dropped( 0 )
+{
+}
+
+
+void executor::strand::post( task t )
+{
+    // All the work is done in the delivery, so that it runs one at a time even on a concurrent strand
+    post_ordered( [t]() { return t; } );
+}
+
+
+void executor::strand::post_ordered( ordered_task t )
+{
+    std::unique_lock< std::mutex > lock( _mutex );
+    if( _stopped )
+        return;
+
+    _tasks.push_back( std::move( t ) );
+    if( _tasks.size() > _capacity )
+    {
+        // Like the rest of the frame queues, favor the newest frames when falling behind
+        auto dropped = std::move( _tasks.front() );
+        _tasks.pop_front();
+        ++_dropped;
+        lock.unlock();
+        return;  // 'dropped' is destroyed (and any frame it holds released) outside the lock
+    }
+
+    if( _scheduled < _concurrency )
+    {
+        ++_scheduled;
+        lock.unlock();
+        auto self = shared_from_this();
+        _owner->post( [self]() { self->run(); } );
+    }
+}
+
+
+void executor::strand::run()
+{
+    // Run a bounded number of tasks before yielding the worker, so one busy strand does not
+    // starve the others
+    const int MAX_TASKS_PER_RUN = 8;
+    for( int i = 0; i < MAX_TASKS_PER_RUN; ++i )
+    {
+        ordered_task t;
+        uint64_t seq;
+        {
+            std::lock_guard< std::mutex > lock( _mutex );
+            if( _tasks.empty() || _stopped )
+            {
+                --_scheduled;
+                _idle_cv.notify_all();
+                return;
+            }
+            t = std::move( _tasks.front() );
+            _tasks.pop_front();
+            seq = _next_started++;
+        }
+
+        // A failed task still gets its turn, so the ones after it are not held back
+        task delivery;
+        run_task( [&]() { delivery = t(); } );
+        deliver( seq, std::move( delivery ) );
+    }
+
+    // Still scheduled: continue later, behind whatever else is waiting
+    auto self = shared_from_this();
+    _owner->post( [self]() { self->run(); } );
+}
+
+
+void executor::strand::deliver( uint64_t seq, task delivery )
+{
+    std::unique_lock< std::mutex > lock( _mutex );
+    _done.emplace( seq, std::move( delivery ) );
+
+    // Whoever is delivering already will get to ours too
+    if( _delivering )
+        return;
+    _delivering = true;
+    while( ! _stopped )
+    {
+        auto it = _done.find( _next_delivered );
+        if( it == _done.end() )
+            break;
+        auto next = std::move( it->second );
+        _done.erase( it );
+        ++_next_delivered;
+        lock.unlock();
+        if( next )
+            run_task( next );
+        next = nullptr;  // released outside the lock
+        lock.lock();
+    }
+    _delivering = false;
+    _idle_cv.notify_all();
+}
+
+
+void executor::strand::stop()
+{
+    std::deque< ordered_task > pending;
+    std::map< uint64_t, task > undelivered;
+    std::unique_lock< std::mutex > lock( _mutex );
+    _stopped = true;
+    std::swap( pending, _tasks );
+    // On a worker (including from one of our own tasks), waiting could hold up the very worker
+    // the running tasks are queued on (with a single thread, always); they see '_stopped' and
+    // finish on their own
+    if( ! _owner->is_worker_thread() )
+        _idle_cv.wait( lock, [this]() { return ! _scheduled && ! _delivering; } );
+    std::swap( undelivered, _done );
+    lock.unlock();
+}
+
+
+}  // namespace librealsense
@@ -0,0 +1,99 @@
+// License: Apache 2.0. See LICENSE file in root directory.
+// Copyright(c) 2021 Intel Corporation. All Rights Reserved.
+
+#pragma once
+
+#include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+
+namespace librealsense {
+
+
+// A pool of worker threads that processing blocks can be attached to, so that independent frames
+// (different streams, different blocks along a chain) are processed on different cores.
+//
+// Each worker has its own task deque: tasks posted from a worker go to its own deque, tasks posted
+// from other threads are spread round-robin, and a worker that runs out of tasks steals the oldest
+// task of another worker before going to sleep.
+class executor : public std::enable_shared_from_this< executor >
+{
+public:
+    typedef std::function< void() > task;
+
+    // Runs the tasks posted to it in the order they were posted, on whichever worker is available.
+    // Processing blocks keep per-instance state (cached profiles, history buffers), so each block
+    // gets its own strand: its frames are processed serially and its output stays in frame order,
+    // while different blocks run in parallel.
+    //
+    // A strand made with a concurrency above 1 (for blocks that keep no such state) runs up to that
+    // many tasks at once instead. Its tasks are split in two: the work, which may run concurrently,
+    // returns a delivery, which the strand runs one at a time and in the order the tasks were posted.
+    class strand : public std::enable_shared_from_this< strand >
+    {
+    public:
+        typedef std::function< task() > ordered_task;
+
+        strand( std::shared_ptr< executor > owner, size_t capacity, int concurrency = 1 );
+
+        // Queue a task; if 'capacity' tasks are already waiting, the oldest is dropped
+        void post( task t );
+        void post_ordered( ordered_task t );
+
+        // Drop any pending tasks (and undelivered results) and wait for the ones running, if any.
+        // Called on a worker thread of the executor, it does not wait: the running tasks may need
+        // that very worker to finish.
+        void stop();
+
+        uint64_t get_dropped() const { return _dropped; }
+        int get_concurrency() const { return _concurrency; }
+
+    private:
+        void run();
+        void deliver( uint64_t seq, task delivery );
+
+        std::shared_ptr< executor > _owner;
+        size_t const _capacity;
+        int const _concurrency;
+        std::mutex _mutex;
+        std::condition_variable _idle_cv;
+        std::deque< ordered_task > _tasks;
+        int _scheduled = 0;                // runners posted to the executor
+        uint64_t _next_started = 0;        // the sequence number of the next task to start
+        uint64_t _next_delivered = 0;      // ... and of the next delivery to run
+        std::map< uint64_t, task > _done;  // deliveries waiting for the ones before them
+        bool _delivering = false;
+        bool _stopped = false;
+        std::atomic< uint64_t > _dropped;
+    };
+
+    // 'threads' of 0 uses one thread per hardware thread; if 'cpus' is not empty, workers are
+    // pinned to those CPUs in turn (where the platform supports it)
+    explicit executor( int threads = 0, std::vector< int > cpus = {} );
+    ~executor();
+
+    void post( task t );
+
+    std::shared_ptr< strand > make_strand( size_t capacity, int concurrency = 1 );
+
+    int get_thread_count() const;
+
+    // Whether the calling thread is one of our workers
+    bool is_worker_thread() const;
+
+private:
+    // Owned jointly by the executor and its threads, so the executor can be released from one of
+    // its own tasks
+    struct pool;
+    std::shared_ptr< pool > _pool;
+};
+
+
+}  // namespace librealsense
@@ -3,6 +3,7 @@
 #pragma once
 
 #include "archive.h"
+#include "frame-pool.h"
 
 namespace librealsense
 {
@@ -16,49 +17,67 @@ namespace librealsense
         std::shared_ptr<metadata_parser_map> _metadata_parsers = nullptr;
         callbacks_heap callback_inflight;
 
-        std::vector<T> freelist; // return frames here
-        std::atomic<bool> recycle_frames;
+        frame_pool<T> freelist; // return frames here
         int pending_frames = 0;
         std::recursive_mutex mutex;
+        std::mutex _allocator_mutex;
+        frame_allocator_ptr _allocator; // user-supplied, see rs2_set_frame_allocator
         std::shared_ptr<platform::time_service> _time_service;
 
         std::weak_ptr<sensor_interface> _sensor;
         std::shared_ptr<sensor_interface> get_sensor() const override { return _sensor.lock(); }
         void set_sensor(std::shared_ptr<sensor_interface> s) override { _sensor = s; }
 
+        // Buffers from a user-supplied allocator are not pooled: they go back to the user as soon as
+        // the frame is released
+        bool alloc_external(const size_t size, T& backbuffer)
+        {
+            frame_allocator_ptr allocator;
+            {
+                std::lock_guard<std::mutex> lock(_allocator_mutex);
+                allocator = _allocator;
+            }
+            if (!allocator)
+                return false;
+
+            byte* buffer = nullptr;
+            try
+            {
+                buffer = static_cast<byte*>(allocator->allocate(size));
+            }
+            catch (...)
+            {
+                LOG_ERROR("Received an exception from frame allocator!");
+            }
+            if (!buffer)
+            {
+                LOG_DEBUG("Frame allocator did not provide a buffer of " << size << " bytes, using an internal one");
+                return false;
+            }
+            backbuffer.set_external_buffer(buffer, size, std::move(allocator));
+            return true;
+        }
+
         T alloc_frame(const size_t size, const frame_additional_data& additional_data, bool requires_memory)
         {
             T backbuffer;
             //const size_t size = modes[stream].get_image_size(stream);
-            {
-                std::lock_guard<std::recursive_mutex> guard(mutex);
-
-                if (requires_memory)
-                {
-                    // Attempt to obtain a buffer of the appropriate size from the freelist
-                    for (auto it = begin(freelist); it != end(freelist); ++it)
-                    {
-                        if (it->data.size() == size)
-                        {
-                            backbuffer = std::move(*it);
-                            freelist.erase(it);
-                            break;
-                        }
-                    }
-                }
-
-                // Discard buffers that have been in the freelist for longer than 1s
-                for (auto it = begin(freelist); it != end(freelist);)
-                {
-                    if (additional_data.timestamp > it->additional_data.timestamp + 1000) it = freelist.erase(it);
-                    else ++it;
-                }
-            }
 
+            // Attempt to obtain a buffer of the appropriate size from the freelist; buffers that have
+            // been in the freelist for longer than 1s are discarded along the way
             if (requires_memory)
             {
-                backbuffer.data.resize(size, 0); // TODO: Allow users to provide a custom allocator for frame buffers
+                if (!alloc_external(size, backbuffer)
+                    && !freelist.acquire(size, additional_data.timestamp, backbuffer))
+                    backbuffer.data.resize(size);
+                // The caller overwrites the whole buffer, so neither a recycled nor a new one is cleared
+                // (frame_buffer leaves new bytes uninitialized)
             }
+            else
+            {
+                freelist.age(additional_data.timestamp);
+            }
+
             backbuffer.additional_data = additional_data;
             return backbuffer;
         }
@@ -86,13 +105,13 @@ namespace librealsense
                 std::unique_lock<std::recursive_mutex> lock(mutex);
 
                 frame->keep();
-
-                if (recycle_frames)
-                {
-                    freelist.push_back(std::move(*f));
-                }
                 lock.unlock();
 
+                if (f->has_external_buffer())
+                    f->free_external_buffer();
+                else
+                    freelist.release(std::move(*f));
+
                 if (f->is_fixed())
                     published_frames.deallocate(f);
                 else
@@ -137,6 +156,14 @@ namespace librealsense
 
         std::shared_ptr<metadata_parser_map> get_md_parsers() const override { return _metadata_parsers; };
 
+        frame_pool_stats get_pool_stats() override { return freelist.get_stats(); }
+
+        void set_allocator(frame_allocator_ptr allocator) override
+        {
+            std::lock_guard<std::mutex> lock(_allocator_mutex);
+            _allocator = std::move(allocator);
+        }
+
         friend class frame;
 
     public:
@@ -144,7 +171,7 @@ namespace librealsense
             std::shared_ptr<platform::time_service> ts,
             std::shared_ptr<metadata_parser_map> parsers)
             : max_frame_queue_size(in_max_frame_queue_size),
-            recycle_frames(true), mutex(), _time_service(ts),
+            mutex(), _time_service(ts),
             _metadata_parsers(parsers)
         {
             published_frames_count = 0;
@@ -170,7 +197,6 @@ namespace librealsense
         {
             published_frames.stop_allocation();
             callback_inflight.stop_allocation();
-            recycle_frames = false;
 
             auto callbacks_inflight = callback_inflight.get_size();
             if (callbacks_inflight > 0)
@@ -180,10 +206,10 @@ namespace librealsense
             // wait until user is done with all the stuff he chose to borrow
             callback_inflight.wait_until_empty();
 
-            {
-                std::lock_guard<std::recursive_mutex> guard(mutex);
-                freelist.clear();
-            }
+            auto stats = freelist.get_stats();
+            LOG_DEBUG("Frame pool of stream 0x" << std::hex << this << std::dec << ": " << stats.hits << " hits, "
+                << stats.misses << " misses, " << stats.evictions << " evictions, " << stats.pooled << " pooled");
+            freelist.stop();
 
             pending_frames = published_frames.get_size();
             if (pending_frames > 0)
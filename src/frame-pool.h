@@ -0,0 +1,187 @@
+// License: Apache 2.0. See LICENSE file in root directory.
+// Copyright(c) 2021 Intel Corporation. All Rights Reserved.
+
+#pragma once
+
+#include "types.h"
+
+#include <atomic>
+#include <deque>
+#include <mutex>
+#include <unordered_map>
+
+
+namespace librealsense {
+
+
+// Counters describing how well a frame pool is recycling buffers; used to size the pool per sensor
+struct frame_pool_stats
+{
+    uint64_t hits = 0;       // allocations served from a recycled buffer
+    uint64_t misses = 0;     // allocations that required a new buffer
+    uint64_t evictions = 0;  // recycled buffers discarded because they were not reused in time
+    size_t pooled = 0;       // buffers currently waiting to be reused
+
+    frame_pool_stats & operator+=( const frame_pool_stats & other )
+    {
+        hits += other.hits;
+        misses += other.misses;
+        evictions += other.evictions;
+        pooled += other.pooled;
+        return *this;
+    }
+};
+
+
+// Recycles released frames (and the buffers they own) for reuse by later allocations.
+// Frames are bucketed by the size of their data buffer, so acquiring a buffer of a given size
+// is a single hash lookup rather than a scan over every released frame. Frames that were not
+// reused within 'max_age' (in frame-timestamp units) are evicted so memory is not held forever
+// once a stream changes resolution or stops.
+template < class T >
+class frame_pool
+{
+    typedef std::deque< T > bucket;
+
+    std::mutex _mutex;
+    std::unordered_map< size_t, bucket > _buckets;
+    size_t _pooled = 0;
+    bool _enabled = true;
+    rs2_time_t _max_age;
+    rs2_time_t _last_sweep = 0;
+
+    std::atomic< uint64_t > _hits;
+    std::atomic< uint64_t > _misses;
+    std::atomic< uint64_t > _evictions;
+
+    static bool is_stale( const T & f, rs2_time_t now, rs2_time_t max_age )
+    {
+        return now > f.additional_data.timestamp + max_age;
+    }
+
+    // Drop the stale frames at the front (the oldest end) of a bucket
+    void evict_front( bucket & b, rs2_time_t now )
+    {
+        while( ! b.empty() && is_stale( b.front(), now, _max_age ) )
+        {
+            b.pop_front();
+            --_pooled;
+            ++_evictions;
+        }
+    }
+
+    // Buckets that are no longer being acquired from are only aged out here, at most once per
+    // 'max_age' so the per-frame cost stays constant
+    void sweep( rs2_time_t now )
+    {
+        if( now < _last_sweep + _max_age && now >= _last_sweep )
+            return;
+        _last_sweep = now;
+
+        for( auto it = _buckets.begin(); it != _buckets.end(); )
+        {
+            auto & b = it->second;
+            for( auto f = b.begin(); f != b.end(); )
+            {
+                if( is_stale( *f, now, _max_age ) )
+                {
+                    f = b.erase( f );
+                    --_pooled;
+                    ++_evictions;
+                }
+                else
+                    ++f;
+            }
+            if( b.empty() )
+                it = _buckets.erase( it );
+            else
+                ++it;
+        }
+    }
+
+public:
+    explicit frame_pool( rs2_time_t max_age = 1000 )
+        : _max_age( max_age )
+        , _hits( 0 )
+        , _misses( 0 )
+        , _evictions( 0 )
+    {
+    }
+
+    // Try to obtain a frame whose buffer already holds exactly 'size' bytes. 'now' is the
+    // timestamp of the frame being allocated, and is used to age out unused buffers.
+    // Returns false (and leaves 'out' untouched) if no such frame is available.
+    bool acquire( size_t size, rs2_time_t now, T & out )
+    {
+        std::lock_guard< std::mutex > lock( _mutex );
+
+        bool found = false;
+        auto it = _buckets.find( size );
+        if( it != _buckets.end() )
+        {
+            auto & b = it->second;
+            if( ! b.empty() )
+            {
+                // The most recently released buffer is the most likely to still be in cache
+                out = std::move( b.back() );
+                b.pop_back();
+                --_pooled;
+                found = true;
+            }
+            evict_front( b, now );
+        }
+        sweep( now );
+
+        if( found )
+            ++_hits;
+        else
+            ++_misses;
+        return found;
+    }
+
+    // Age out unused buffers without acquiring one
+    void age( rs2_time_t now )
+    {
+        std::lock_guard< std::mutex > lock( _mutex );
+        sweep( now );
+    }
+
+    // Return a frame to the pool; returns false if the pool has been stopped and the frame was
+    // not taken
+    bool release( T && f )
+    {
+        std::lock_guard< std::mutex > lock( _mutex );
+        if( ! _enabled )
+            return false;
+
+        _buckets[f.data.size()].push_back( std::move( f ) );
+        ++_pooled;
+        return true;
+    }
+
+    // Free all pooled buffers and stop accepting new ones
+    void stop()
+    {
+        std::lock_guard< std::mutex > lock( _mutex );
+        _enabled = false;
+        _evictions += _pooled;
+        _buckets.clear();
+        _pooled = 0;
+    }
+
+    frame_pool_stats get_stats()
+    {
+        frame_pool_stats stats;
+        stats.hits = _hits;
+        stats.misses = _misses;
+        stats.evictions = _evictions;
+        {
+            std::lock_guard< std::mutex > lock( _mutex );
+            stats.pooled = _pooled;
+        }
+        return stats;
+    }
+};
+
+
+}  // namespace librealsense
@@ -33,6 +33,10 @@ frame::frame( frame && r )
 frame & frame::operator=( frame && r )
 {
     data = move( r.data );
+    free_external_buffer();
+    std::swap( _external_data, r._external_data );
+    std::swap( _external_size, r._external_size );
+    _allocator = std::move( r._allocator );
     owner = r.owner;
     ref_count = r.ref_count.exchange( 0 );
     _kept = r._kept.exchange( false );
@@ -45,6 +49,32 @@ frame & frame::operator=( frame && r )
         metadata_parsers = std::move( r.metadata_parsers );
     return *this;
 }
+void frame::set_external_buffer( byte * buffer, size_t size, frame_allocator_ptr allocator )
+{
+    free_external_buffer();
+    _external_data = buffer;
+    _external_size = size;
+    _allocator = std::move( allocator );
+}
+
+void frame::free_external_buffer()
+{
+    if( _external_data && _allocator )
+    {
+        try
+        {
+            _allocator->deallocate( _external_data, _external_size );
+        }
+        catch( ... )
+        {
+            LOG_ERROR( "Received an exception from frame allocator!" );
+        }
+    }
+    _external_data = nullptr;
+    _external_size = 0;
+    _allocator.reset();
+}
+
 archive_interface * frame::get_owner() const
 {
     return owner.get();
@@ -152,12 +182,14 @@ bool frame::supports_frame_metadata( const rs2_frame_metadata_value & frame_meta
 
 int frame::get_frame_data_size() const
 {
+    if( _external_data )
+        return (int)_external_size;
     return (int)data.size();
 }
 
 const byte * frame::get_frame_data() const
 {
-    const byte * frame_data = data.data();
+    const byte * frame_data = _external_data ? _external_data : data.data();
 
     if( on_release.get_data() )
     {
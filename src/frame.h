@@ -8,6 +8,8 @@
 #include "core/extension.h"
 #include <atomic>
 #include <array>
+#include <memory>
+#include <vector>
 #include <math.h>
 
 namespace librealsense {
@@ -183,11 +185,43 @@ struct LRS_EXTENSION_API frame_holder
 };
 
 
+// An allocator that leaves resized elements uninitialized rather than zeroing them: frame buffers
+// are overwritten by their producer right after being allocated
+template < class T >
+class default_init_allocator : public std::allocator< T >
+{
+public:
+    template < class U >
+    struct rebind
+    {
+        typedef default_init_allocator< U > other;
+    };
+
+    default_init_allocator() = default;
+    template < class U >
+    default_init_allocator( const default_init_allocator< U > & ) noexcept
+    {
+    }
+
+    template < class U >
+    void construct( U * p ) noexcept( std::is_nothrow_default_constructible< U >::value )
+    {
+        ::new( static_cast< void * >( p ) ) U;
+    }
+    template < class U, class... Args >
+    void construct( U * p, Args &&... args )
+    {
+        ::new( static_cast< void * >( p ) ) U( std::forward< Args >( args )... );
+    }
+};
+
+typedef std::vector< byte, default_init_allocator< byte > > frame_buffer;
+
 // Define a movable but explicitly noncopyable buffer type to hold our frame data
 class LRS_EXTENSION_API frame : public frame_interface
 {
 public:
-    std::vector< byte > data;
+    frame_buffer data;
     frame_additional_data additional_data;
     std::shared_ptr< metadata_parser_map > metadata_parsers = nullptr;
     explicit frame()
@@ -203,7 +237,11 @@ public:
     frame & operator=( const frame & r ) = delete;
     frame & operator=( frame && r );
 
-    virtual ~frame() { on_release.reset(); }
+    virtual ~frame()
+    {
+        on_release.reset();
+        free_external_buffer();
+    }
     frame_header const & get_header() const override { return additional_data; }
     rs2_metadata_type get_frame_metadata( const rs2_frame_metadata_value & frame_metadata ) const override;
     bool supports_frame_metadata( const rs2_frame_metadata_value & frame_metadata ) const override;
@@ -249,6 +287,13 @@ public:
     void set_blocking( bool state ) override { additional_data.is_blocking = state; }
     bool is_blocking() const override { return additional_data.is_blocking; }
 
+    // Use a buffer obtained from a user-supplied allocator instead of 'data'. The buffer is handed
+    // back to the allocator when the frame is destroyed or free_external_buffer() is called.
+    // Without an allocator the buffer is only borrowed, and its owner must outlive the frame.
+    void set_external_buffer( byte * buffer, size_t size, frame_allocator_ptr allocator );
+    void free_external_buffer();
+    bool has_external_buffer() const { return _external_data != nullptr; }
+
 private:
     // TODO: check boost::intrusive_ptr or an alternative
     std::atomic< int > ref_count;  // the reference count is on how many times this placeholder has
@@ -259,6 +304,9 @@ private:
     bool _fixed = false;
     std::atomic_bool _kept;
     std::shared_ptr< stream_profile_interface > stream;
+    byte * _external_data = nullptr;
+    size_t _external_size = 0;
+    frame_allocator_ptr _allocator;
 };
 
 class video_frame : public frame
@@ -435,13 +483,50 @@ protected:
 
 MAP_EXTENSION( RS2_EXTENSION_DISPARITY_FRAME, librealsense::disparity_frame );
 
+// A batched motion frame (see RS2_OPTION_MOTION_SAMPLES_PER_FRAME) carries several samples of its
+// stream: their values one after the other, 'stride' bytes apart, then the timestamp of each as an
+// 8-byte aligned array of rs2_time_t. The frame's own timestamp and number are those of the last
+// sample. Other motion frames carry a single sample and no timestamp array.
 class motion_frame : public frame
 {
 public:
     motion_frame()
         : frame()
+        , _samples( 1 )
+        , _sample_stride( 0 )
+    {
+    }
+
+    int get_sample_count() const { return _samples; }
+    bool is_batched() const { return _sample_stride != 0; }
+    int get_sample_stride() const { return is_batched() ? _sample_stride : get_frame_data_size(); }
+
+    const rs2_time_t * get_sample_timestamps() const
+    {
+        if( ! is_batched() )
+            return &additional_data.timestamp;
+        return reinterpret_cast< const rs2_time_t * >( get_frame_data() + timestamps_offset( _samples, _sample_stride ) );
+    }
+
+    void assign_samples( int samples, int stride )
     {
+        _samples = samples;
+        _sample_stride = stride;
     }
+
+    static size_t timestamps_offset( int samples, int stride )
+    {
+        return ( size_t( samples ) * stride + 7 ) & ~size_t( 7 );
+    }
+
+    // The data size of a batch of 'samples' values of 'stride' bytes
+    static size_t batch_size( int samples, int stride )
+    {
+        return timestamps_offset( samples, stride ) + samples * sizeof( rs2_time_t );
+    }
+
+private:
+    int _samples, _sample_stride;
 };
 
 MAP_EXTENSION( RS2_EXTENSION_MOTION_FRAME, librealsense::motion_frame );
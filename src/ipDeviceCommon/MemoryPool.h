@@ -3,96 +3,253 @@
 
 #pragma once
 
-#include <ipDeviceCommon/RsCommon.h>
+#include "RsCommon.h"
 
+#include <algorithm>
 #include <iostream>
 #include <mutex>
-#include <queue>
+#include <new>
+#include <vector>
 
 #include "NetdevLog.h"
 
 #define POOL_SIZE 100
 
-class MemoryPool
+struct MemoryPoolStats
 {
+    uint64_t allocations = 0; // buffers allocated, once each
+    uint64_t reuses = 0;      // requests answered with a returned buffer
+    uint64_t exhaustions = 0; // requests refused because all the buffers of their size were in use
+    int inUse = 0;            // buffers handed out and not yet returned
+    int highWaterMark = 0;    // the most buffers ever in use at once
+};
 
+// Frame buffers, recycled rather than allocated for each frame: once the pool holds as many
+// buffers as are in use at once, receiving frames does not allocate. Buffers are of the smallest
+// power of two (from 64 KB) fitting the size asked, and at most t_maxBuffers of each size (see
+// setMaxBuffers) are allocated, after which requests fail until buffers are returned. Buffers are returned by their
+// address alone (as a frame deleter does): each carries its size class in a hidden header.
+class MemoryPool
+{
 public:
-    MemoryPool()
+    explicit MemoryPool(int t_maxBuffers = POOL_SIZE)
+        : m_maxBuffers(std::max(1, t_maxBuffers))
     {
-        // //alloc memory
-        // std::unique_lock<std::mutex> lk(m_mutex);
-        // for(int i = 0; i < POOL_SIZE; i++)
-        // {
-        //     unsigned char *mem = new unsigned char[sizeof(RsFrameHeader) + MAX_FRAME_SIZE]; //TODO:to use OutPacketBuffer::maxSize;
-        //     m_pool.push(mem);
-        // }
-        // lk.unlock();
+        for(auto& sizeClass : m_classes)
+        {
+            // so that returning buffers never allocates
+            sizeClass.free.reserve(m_maxBuffers);
+        }
     }
 
-    MemoryPool(const MemoryPool& obj)
+    MemoryPool(const MemoryPool&) = delete;
+    MemoryPool& operator=(const MemoryPool&) = delete;
+
+    // Buffers already allocated beyond a lowered bound are kept, but no more are allocated until
+    // the count falls below it
+    void setMaxBuffers(int t_maxBuffers)
     {
-        m_pool = obj.m_pool;
+        std::lock_guard<std::mutex> lk(m_mutex);
+        m_maxBuffers = std::max(1, t_maxBuffers);
+        for(auto& sizeClass : m_classes)
+        {
+            sizeClass.free.reserve(std::max<size_t>(m_maxBuffers, sizeClass.allocated));
+        }
     }
 
-    MemoryPool& operator=(const MemoryPool&& obj)
+    int getMaxBuffers()
     {
-        m_pool = obj.m_pool;
-        return *this;
+        std::lock_guard<std::mutex> lk(m_mutex);
+        return m_maxBuffers;
     }
 
-    unsigned char* getNextMem()
+    unsigned char* getNextMem(size_t t_size = sizeof(RsFrameHeader) + MAX_FRAME_SIZE)
     {
-        // unsigned char* mem = nullptr;
-        // std::unique_lock<std::mutex> lk(m_mutex);
-        // if(!m_pool.empty())
-        // {
-        //     mem = m_pool.front();
-        //     m_pool.pop();
-        // }
-        // else
-        // {
-        //     ERR << "getNextMem: pool is empty";
-        // }
-        // lk.unlock();
-        // return mem;
-        return new unsigned char[sizeof(RsFrameHeader) + MAX_FRAME_SIZE]; 
+        int classIndex = getClassIndex(t_size);
+        if(classIndex < 0)
+        {
+            ERR << "getNextMem: no buffers of " << t_size << " bytes";
+            return nullptr;
+        }
+
+        unsigned char* block = nullptr;
+        bool exhausted = false;
+        {
+            std::lock_guard<std::mutex> lk(m_mutex);
+            auto& sizeClass = m_classes[classIndex];
+            if(!sizeClass.free.empty())
+            {
+                block = sizeClass.free.back();
+                sizeClass.free.pop_back();
+                ++m_stats.reuses;
+            }
+            else if(sizeClass.allocated >= m_maxBuffers)
+            {
+                ++m_stats.exhaustions;
+                exhausted = true;
+            }
+            else
+            {
+                ++sizeClass.allocated;
+                ++m_stats.allocations;
+            }
+            if(!exhausted)
+            {
+                m_stats.highWaterMark = std::max(m_stats.highWaterMark, ++m_stats.inUse);
+            }
+        }
+        if(exhausted)
+        {
+            ERR << "getNextMem: pool is empty";
+            return nullptr;
+        }
+
+        if(block == nullptr)
+        {
+            block = new(std::nothrow) unsigned char[HEADER_SIZE + getClassSize(classIndex)];
+            if(block == nullptr)
+            {
+                ERR << "getNextMem: failed to allocate " << getClassSize(classIndex) << " bytes";
+                std::lock_guard<std::mutex> lk(m_mutex);
+                --m_classes[classIndex].allocated;
+                --m_stats.inUse;
+                return nullptr;
+            }
+            block[0] = (unsigned char)classIndex;
+        }
+        return block + HEADER_SIZE;
     }
 
     void returnMem(unsigned char* t_mem)
     {
-        // if(t_mem != nullptr)
-        // {
-        //     std::unique_lock<std::mutex> lk(m_mutex);
-        //     m_pool.push(t_mem);
-        //     lk.unlock();
-        // }
-        // else
-        // {
-        //     ERR << "returnMem: invalid address";
-        // }
-        delete[] t_mem;
+        if(t_mem == nullptr)
+        {
+            ERR << "returnMem: invalid address";
+            return;
+        }
+        unsigned char* block = t_mem - HEADER_SIZE;
+        int classIndex = block[0];
+        if(classIndex >= CLASS_COUNT)
+        {
+            ERR << "returnMem: invalid address";
+            return;
+        }
+
+        std::lock_guard<std::mutex> lk(m_mutex);
+        m_classes[classIndex].free.push_back(block);
+        --m_stats.inUse;
+    }
+
+    MemoryPoolStats getStats()
+    {
+        std::lock_guard<std::mutex> lk(m_mutex);
+        return m_stats;
     }
 
     ~MemoryPool()
     {
-        // std::unique_lock<std::mutex> lk(m_mutex);
-        // while(!m_pool.empty())
-        // {
-        //     unsigned char* mem = m_pool.front();
-        //     m_pool.pop();
-        //     if(mem != nullptr)
-        //     {
-        //         delete mem;
-        //     }
-        //     else
-        //     {
-        //         ERR << "~memory_pool: invalid address";
-        //     }
-        // }
-        // lk.unlock();
+        std::lock_guard<std::mutex> lk(m_mutex);
+        for(auto& sizeClass : m_classes)
+        {
+            for(auto block : sizeClass.free)
+            {
+                delete[] block;
+            }
+        }
     }
 
 private:
-    std::queue<unsigned char*> m_pool;
+    // The header keeps the data 16-byte aligned, as RsNetworkHeader expects
+    static const int HEADER_SIZE = 16;
+    static const int MIN_CLASS_SHIFT = 16;
+    static const int CLASS_COUNT = 8; // 64 KB to 8 MB
+
+    struct SizeClass
+    {
+        std::vector<unsigned char*> free; // the buffers returned, as allocated (header included)
+        int allocated = 0;
+    };
+
+    static size_t getClassSize(int t_classIndex)
+    {
+        return size_t(1) << (MIN_CLASS_SHIFT + t_classIndex);
+    }
+
+    static int getClassIndex(size_t t_size)
+    {
+        for(int i = 0; i < CLASS_COUNT; i++)
+        {
+            if(t_size <= getClassSize(i))
+            {
+                return i;
+            }
+        }
+        return -1;
+    }
+
     std::mutex m_mutex;
+    int m_maxBuffers;
+    SizeClass m_classes[CLASS_COUNT];
+    MemoryPoolStats m_stats;
+};
+
+// The buffer a stream receives its next frame into: one from the pool when there is one,
+// otherwise a buffer of the stream's own, whose frame is dropped once received. Running out of
+// pool buffers then drops frames until buffers are returned, rather than stopping the stream.
+class ReceiveBuffer
+{
+public:
+    ReceiveBuffer(MemoryPool& t_pool, size_t t_size)
+        : m_pool(t_pool)
+        , m_size(t_size)
+    {
+    }
+
+    ReceiveBuffer(const ReceiveBuffer&) = delete;
+    ReceiveBuffer& operator=(const ReceiveBuffer&) = delete;
+
+    ~ReceiveBuffer()
+    {
+        release();
+    }
+
+    // Never null
+    unsigned char* next()
+    {
+        release();
+        m_buffer = m_pool.getNextMem(m_size);
+        if(m_buffer != nullptr)
+        {
+            return m_buffer;
+        }
+        if(m_fallback.size() < m_size)
+        {
+            m_fallback.resize(m_size);
+        }
+        return m_fallback.data();
+    }
+
+    // The pool buffer the frame was received into, now the caller's to return, or null if the
+    // frame went to the stream's own buffer and is to be dropped
+    unsigned char* take()
+    {
+        auto buffer = m_buffer;
+        m_buffer = nullptr;
+        return buffer;
+    }
+
+private:
+    void release()
+    {
+        if(m_buffer != nullptr)
+        {
+            m_pool.returnMem(m_buffer);
+            m_buffer = nullptr;
+        }
+    }
+
+    MemoryPool& m_pool;
+    size_t m_size;
+    unsigned char* m_buffer = nullptr;
+    std::vector<unsigned char> m_fallback;
 };
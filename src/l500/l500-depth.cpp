@@ -115,6 +115,7 @@ namespace librealsense
         register_stream_to_extrinsic_group(*_confidence_stream, 0);
 
         auto error_control = std::make_shared<uvc_xu_option<int>>(raw_depth_sensor, ivcam2::depth_xu, L500_ERROR_REPORTING, "Error reporting");
+        error_control->mark_volatile();
 
         _polling_error_handler = std::make_shared<polling_error_handler>(1000,
             error_control,
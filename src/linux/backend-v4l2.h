@@ -370,6 +370,8 @@ namespace librealsense
             std::string get_device_location() const override { return _device_path; }
             usb_spec get_usb_specification() const override { return _device_usb_spec; }
 
+            bool holds_frame_buffers() const override { return true; }
+
         protected:
             virtual uint32_t get_cid(rs2_option option) const;
 
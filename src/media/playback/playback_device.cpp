@@ -23,6 +23,7 @@ playback_device::playback_device(std::shared_ptr<context> ctx, std::shared_ptr<d
     m_is_paused(false),
     m_sample_rate(1),
     m_real_time(true),
+    m_read_ahead(DEFAULT_READ_AHEAD),
     m_prev_timestamp(0),
     m_last_published_timestamp(0)
 {
@@ -384,6 +385,31 @@ void playback_device::set_real_time(bool real_time)
 {
     LOG_INFO("Set real time to " << ((real_time) ? "True" : "False"));
     m_real_time = real_time;
+    //Frames are only read ahead when the playback is not paced by their timestamps
+    (*m_read_thread)->invoke([this, real_time](dispatcher::cancellable_timer t)
+    {
+        m_reader->set_read_ahead(real_time ? 0 : m_read_ahead.load());
+    });
+}
+
+void playback_device::set_read_ahead(size_t bytes)
+{
+    m_read_ahead = bytes;
+    if (!m_real_time)
+    {
+        (*m_read_thread)->invoke([this, bytes](dispatcher::cancellable_timer t)
+        {
+            m_reader->set_read_ahead(bytes);
+        });
+    }
+}
+
+void playback_device::set_index_file(bool enabled)
+{
+    (*m_read_thread)->invoke([this, enabled](dispatcher::cancellable_timer t)
+    {
+        m_reader->set_index_file(enabled);
+    });
 }
 
 bool playback_device::is_real_time() const
@@ -19,6 +19,8 @@ namespace librealsense
         public info_container
     {
     public:
+        static const size_t DEFAULT_READ_AHEAD = 256 * 1024 * 1024; // Frame data read ahead of non-real-time playback
+
         playback_device(std::shared_ptr<context> context, std::shared_ptr<device_serializer::reader> serializer);
         virtual ~playback_device();
 
@@ -40,6 +42,8 @@ namespace librealsense
         void stop();
         void set_real_time(bool real_time);
         bool is_real_time() const;
+        void set_read_ahead(size_t bytes);
+        void set_index_file(bool enabled);
         const std::string& get_file_name() const;
         uint64_t get_position() const;
         signal<playback_device, rs2_playback_status> playback_status_changed;
@@ -87,6 +91,7 @@ namespace librealsense
         std::map<uint32_t, std::shared_ptr<playback_sensor>> m_active_sensors;
         std::atomic<double> m_sample_rate;
         std::atomic_bool m_real_time;
+        std::atomic<size_t> m_read_ahead;
         device_serializer::nanoseconds m_prev_timestamp;
         std::vector<std::shared_ptr<lazy<rs2_extrinsics>>> m_extrinsics_fetchers;
         std::map<int, std::pair<uint32_t, rs2_extrinsics>> m_extrinsics_map;
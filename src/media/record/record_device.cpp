@@ -10,10 +10,18 @@
 using namespace librealsense;
 
 librealsense::record_device::record_device(std::shared_ptr<librealsense::device_interface> device,
-                                      std::shared_ptr<librealsense::device_serializer::writer> serializer):
+                                      std::shared_ptr<librealsense::device_serializer::writer> serializer,
+                                      uint64_t max_cached_data_size):
     m_write_thread([](){return std::make_shared<dispatcher>(std::numeric_limits<unsigned int>::max());}),
     m_is_recording(true),
-    m_record_total_pause_duration(0)
+    m_record_total_pause_duration(0),
+    m_max_cached_data_size(max_cached_data_size),
+    m_cached_data_size(0),
+    m_dropped_frames(0),
+    m_dropping(false),
+    m_written_frames(0),
+    m_max_write_latency(0),
+    m_total_write_latency(0)
 {
     if (device == nullptr)
     {
@@ -65,6 +73,10 @@ librealsense::record_device::~record_device()
         LOG_ERROR("Error - timeout waiting for flush, possible deadlock detected");
     }
     (*m_write_thread)->stop();
+    auto stats = get_statistics();
+    LOG_INFO("Recorded " << stats.written_frames << " frames, dropped " << stats.dropped_frames
+             << ", write latency average " << stats.average_write_latency.count() / 1000 << " usec, max "
+             << stats.max_write_latency.count() / 1000 << " usec");
     //Just in case someone still holds a reference to the sensors,
     // we make sure that they will not try to record anything
     m_sensors.clear();
@@ -133,23 +145,28 @@ void librealsense::record_device::write_data(size_t sensor_index, librealsense::
         initialize_recording();
     });
 
-    //TODO: restore: uint64_t data_size = frame.frame->get_frame_data_size();
-    uint64_t cached_data_size = m_cached_data_size; //TODO: restore: (+ data_size)
-    if (cached_data_size > MAX_CACHED_DATA_SIZE)
+    // Frames wait for the write thread in memory, up to the budget. Past it they are dropped: the
+    // sensors keep streaming, and the recording resumes once the writing catches up.
+    uint64_t data_size = frame ? frame.frame->get_frame_data_size() : 0;
+    if (m_cached_data_size.fetch_add(data_size) + data_size > m_max_cached_data_size)
     {
-        LOG_WARNING("Recorder reached maximum cache size, frame dropped");
-        on_error("Recorder reached maximum cache size, frame dropped");
+        m_cached_data_size -= data_size;
+        ++m_dropped_frames;
+        if (!m_dropping.exchange(true))
+            LOG_WARNING("Recorder reached maximum cache size, dropping frames");
         return;
     }
+    m_dropping = false;
 
-    m_cached_data_size = cached_data_size;
+    auto arrival_time = std::chrono::high_resolution_clock::now();
     auto capture_time = get_capture_time();
     //TODO: remove usage of shared pointer when frame_holder is copyable
     auto frame_holder_ptr = std::make_shared<frame_holder>();
     *frame_holder_ptr = std::move(frame);
-    (*m_write_thread)->invoke([this, frame_holder_ptr, sensor_index, capture_time/*, data_size*/, on_error](dispatcher::cancellable_timer t) {
+    (*m_write_thread)->invoke([this, frame_holder_ptr, sensor_index, capture_time, data_size, arrival_time, on_error](dispatcher::cancellable_timer t) {
         if (m_is_recording == false)
         {
+            m_cached_data_size -= data_size;
             return; //Recording is paused
         }
         std::call_once(m_first_frame_flag, [&]()
@@ -171,12 +188,18 @@ void librealsense::record_device::write_data(size_t sensor_index, librealsense::
             auto stream_type = frame_holder_ptr->frame->get_stream()->get_stream_type();
             auto stream_index = static_cast<uint32_t>(frame_holder_ptr->frame->get_stream()->get_stream_index());
             m_ros_writer->write_frame({ device_index, static_cast<uint32_t>(sensor_index), stream_type, stream_index }, capture_time, std::move(*frame_holder_ptr));
-            //TODO: restore: std::lock_guard<std::mutex> locker(m_mutex);  m_cached_data_size -= data_size;
+
+            auto latency = std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::high_resolution_clock::now() - arrival_time);
+            std::lock_guard<std::mutex> locker(m_mutex);
+            ++m_written_frames;
+            m_total_write_latency += latency;
+            m_max_write_latency = std::max(m_max_write_latency, latency);
         }
         catch(std::exception& e)
         {
             on_error(to_string() << "Failed to write frame. " << e.what());
         }
+        m_cached_data_size -= data_size;
     });
 }
 
@@ -442,6 +465,33 @@ const std::string& librealsense::record_device::get_filename() const
 {
     return m_ros_writer->get_file_name();
 }
+void record_device::set_max_cached_data_size(uint64_t max_cached_data_size)
+{
+    //Takes effect from the next frame; frames already queued are still written
+    m_max_cached_data_size = max_cached_data_size;
+}
+
+void record_device::set_index_file(bool enabled)
+{
+    //On the write thread, which closes the file
+    (*m_write_thread)->invoke([this, enabled](dispatcher::cancellable_timer t)
+    {
+        m_ros_writer->set_index_file(enabled);
+    });
+}
+
+record_device::statistics record_device::get_statistics() const
+{
+    std::lock_guard<std::mutex> locker(m_mutex);
+    statistics stats;
+    stats.queued_bytes = m_cached_data_size;
+    stats.written_frames = m_written_frames;
+    stats.dropped_frames = m_dropped_frames;
+    stats.max_write_latency = m_max_write_latency;
+    stats.average_write_latency = m_written_frames ? m_total_write_latency / int64_t(m_written_frames) : std::chrono::nanoseconds(0);
+    return stats;
+}
+
 platform::backend_device_group record_device::get_device_data() const
 {
     return m_device->get_device_data();
@@ -455,7 +505,6 @@ void record_device::initialize_recording()
 {
     //Expected to be called once when recording to file actually starts
     m_capture_time_base = std::chrono::high_resolution_clock::now();
-    m_cached_data_size = 0;
     LOG_DEBUG( "Recording capture time base set to: " << m_capture_time_base.time_since_epoch().count() );
 
 }
@@ -2,6 +2,7 @@
 // Copyright(c) 2017 Intel Corporation. All Rights Reserved.
 
 #pragma once
+#include <atomic>
 #include <core/roi.h>
 #include <core/extension.h>
 #include <core/serialization.h>
@@ -20,7 +21,18 @@ namespace librealsense
     public:
         static const uint64_t MAX_CACHED_DATA_SIZE = 1920 * 1080 * 4 * 30; // ~1 sec of HD video @ 30 FPS
 
-        record_device(std::shared_ptr<device_interface> device, std::shared_ptr<device_serializer::writer> serializer);
+        // Counters of the frames going through the write queue, for monitoring the recording
+        struct statistics
+        {
+            uint64_t queued_bytes;        // Frame data waiting to be written
+            uint64_t written_frames;
+            uint64_t dropped_frames;      // Frames dropped because the queue was over budget
+            std::chrono::nanoseconds max_write_latency;     // From the frame's arrival to its write completing
+            std::chrono::nanoseconds average_write_latency;
+        };
+
+        record_device(std::shared_ptr<device_interface> device, std::shared_ptr<device_serializer::writer> serializer,
+                      uint64_t max_cached_data_size = MAX_CACHED_DATA_SIZE);
         virtual ~record_device();
 
         std::shared_ptr<context> get_context() const override;
@@ -39,6 +51,9 @@ namespace librealsense
         void pause_recording();
         void resume_recording();
         const std::string& get_filename() const;
+        statistics get_statistics() const;
+        void set_max_cached_data_size(uint64_t max_cached_data_size);
+        void set_index_file(bool enabled);
         platform::backend_device_group get_device_data() const override;
         std::pair<uint32_t, rs2_extrinsics> get_extrinsics(const stream_interface& stream) const override;
         bool is_valid() const override;
@@ -70,13 +85,19 @@ namespace librealsense
         std::chrono::high_resolution_clock::duration m_record_total_pause_duration;
         std::chrono::high_resolution_clock::time_point m_time_of_pause;
 
-        std::mutex m_mutex;
+        mutable std::mutex m_mutex;
         bool m_is_recording;
         std::once_flag m_first_frame_flag;
         int m_on_notification_token;
         int m_on_frame_token;
         int m_on_extension_change_token;
-        uint64_t m_cached_data_size;
+        std::atomic<uint64_t> m_max_cached_data_size;
+        std::atomic<uint64_t> m_cached_data_size;
+        std::atomic<uint64_t> m_dropped_frames;
+        std::atomic_bool m_dropping;
+        uint64_t m_written_frames;  // The write latencies are guarded by m_mutex
+        std::chrono::nanoseconds m_max_write_latency;
+        std::chrono::nanoseconds m_total_write_latency;
         std::once_flag m_first_call_flag;
         void initialize_recording();
         void stop_gracefully(to_string error_msg);
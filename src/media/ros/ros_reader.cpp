@@ -28,7 +28,13 @@ namespace librealsense
         m_file_path(file),
         m_context(ctx),
         m_version(0),
-        m_legacy_depth_units(0)
+        m_legacy_depth_units(0),
+        m_use_index_file(false),
+        m_read_ahead_budget(0),
+        m_read_ahead_size(0),
+        m_read_ahead_frames(0),
+        m_read_ahead_stop(false),
+        m_read_ahead_done(false)
     {
         try
         {
@@ -42,12 +48,158 @@ namespace librealsense
         }
     }
 
+    ros_reader::~ros_reader()
+    {
+        stop_read_ahead();
+    }
+
     device_snapshot ros_reader::query_device_description(const nanoseconds& time)
     {
+        std::lock_guard<std::mutex> lock(m_file_mutex);
         return read_device_description(time);
     }
 
     std::shared_ptr<serialized_data> ros_reader::read_next_data()
+    {
+        if (m_read_ahead_budget > 0 && !m_read_ahead_thread.joinable())
+        {
+            m_read_ahead_thread = std::thread([this]() { read_ahead(); });
+        }
+
+        read_ahead_item item;
+        {
+            std::unique_lock<std::mutex> lock(m_read_ahead_mutex);
+            if (m_read_ahead_thread.joinable())
+            {
+                m_read_ahead_cv.wait(lock, [this]() { return !m_read_ahead_queue.empty() || m_read_ahead_done; });
+            }
+            if (m_read_ahead_queue.empty())
+            {
+                //Not reading ahead, or it stopped at the end of the file or on an error
+                lock.unlock();
+                std::lock_guard<std::mutex> file_lock(m_file_mutex);
+                return read_next_message();
+            }
+            item = std::move(m_read_ahead_queue.front());
+            m_read_ahead_queue.pop_front();
+            m_read_ahead_size -= item.size;
+            if (item.data && (item.data->is<serialized_frame>() || item.data->is<serialized_invalid_frame>()))
+            {
+                --m_read_ahead_frames;
+            }
+        }
+        m_read_ahead_cv.notify_all();
+        if (item.error)
+        {
+            std::rethrow_exception(item.error);
+        }
+        return item.data;
+    }
+
+    void ros_reader::set_read_ahead(size_t bytes)
+    {
+        if (bytes == 0)
+        {
+            stop_read_ahead(); //Messages already read ahead are still returned first
+        }
+        std::lock_guard<std::mutex> lock(m_read_ahead_mutex);
+        m_read_ahead_budget = bytes;
+        m_read_ahead_cv.notify_all();
+    }
+
+    void ros_reader::set_index_file(bool enabled)
+    {
+        m_use_index_file = enabled;
+    }
+
+    void ros_reader::read_ahead()
+    {
+        while (true)
+        {
+            {
+                std::unique_lock<std::mutex> lock(m_read_ahead_mutex);
+                m_read_ahead_cv.wait(lock, [this]() {
+                    return m_read_ahead_stop || (m_read_ahead_size < m_read_ahead_budget && m_read_ahead_frames < MAX_READ_AHEAD_FRAMES);
+                });
+                if (m_read_ahead_stop)
+                {
+                    return;
+                }
+            }
+
+            read_ahead_item item{ nullptr, nullptr, 0 };
+            try
+            {
+                std::lock_guard<std::mutex> lock(m_file_mutex);
+                item.data = read_next_message();
+            }
+            catch (...)
+            {
+                item.error = std::current_exception();
+            }
+
+            bool frame = false;
+            if (item.data && (item.data->is<serialized_frame>() || item.data->is<serialized_invalid_frame>()))
+            {
+                frame = true;
+                auto serialized = std::static_pointer_cast<serialized_frame>(item.data);
+                if (serialized->frame)
+                {
+                    item.size = serialized->frame.frame->get_frame_data_size();
+                }
+            }
+            bool last = item.error || item.data->is<serialized_end_of_file>();
+            {
+                std::lock_guard<std::mutex> lock(m_read_ahead_mutex);
+                m_read_ahead_size += item.size;
+                m_read_ahead_frames += frame ? 1 : 0;
+                m_read_ahead_done = last;
+                m_read_ahead_queue.push_back(std::move(item));
+            }
+            m_read_ahead_cv.notify_all();
+            if (last)
+            {
+                return;
+            }
+        }
+    }
+
+    void ros_reader::stop_read_ahead()
+    {
+        if (!m_read_ahead_thread.joinable())
+        {
+            return;
+        }
+        {
+            std::lock_guard<std::mutex> lock(m_read_ahead_mutex);
+            m_read_ahead_stop = true;
+        }
+        m_read_ahead_cv.notify_all();
+        m_read_ahead_thread.join();
+        std::lock_guard<std::mutex> lock(m_read_ahead_mutex);
+        m_read_ahead_stop = false;
+        m_read_ahead_done = false;
+    }
+
+    //Drops the messages read ahead before the view changes. Returns the time of the first of them,
+    // where reading should continue from, if there was one.
+    bool ros_reader::discard_read_ahead(rs2rosinternal::Time& next_time)
+    {
+        stop_read_ahead();
+        std::lock_guard<std::mutex> lock(m_read_ahead_mutex);
+        bool unread = !m_read_ahead_queue.empty() && m_read_ahead_queue.front().data
+                      && !m_read_ahead_queue.front().data->is<serialized_end_of_file>();
+        if (unread)
+        {
+            next_time.fromNSec(m_read_ahead_queue.front().data->get_timestamp().count());
+        }
+        m_read_ahead_queue.clear();
+        m_read_ahead_size = 0;
+        m_read_ahead_frames = 0;
+        return unread;
+    }
+
+    std::shared_ptr<serialized_data> ros_reader::read_next_message()
     {
         if (m_samples_view == nullptr || m_samples_itrator == m_samples_view->end())
         {
@@ -95,6 +247,8 @@ namespace librealsense
 
     void ros_reader::seek_to_time(const nanoseconds& seek_time)
     {
+        rs2rosinternal::Time next_time;
+        discard_read_ahead(next_time);
         if (seek_time > m_total_duration)
         {
             throw invalid_value_exception(to_string() << "Requested time is out of playback length. (Requested = " << seek_time.count() << ", Duration = " << m_total_duration.count() << ")");
@@ -116,22 +270,24 @@ namespace librealsense
 
     std::vector<std::shared_ptr<serialized_data>> ros_reader::fetch_last_frames(const nanoseconds& seek_time)
     {
+        std::lock_guard<std::mutex> lock(m_file_mutex);
         std::vector<std::shared_ptr<serialized_data>> result;
-        rosbag::View view(m_file, FalseQuery());
         auto as_rostime = to_rostime(seek_time);
-        auto start_time = to_rostime(get_static_file_info_timestamp());
 
-        for (auto topic : m_enabled_streams_topics)
-        {
-            view.addQuery(m_file, rosbag::TopicQuery(topic), start_time, as_rostime);
-        }
         std::map<device_serializer::stream_identifier, rs2rosinternal::Time> last_frames;
-        for (auto&& m : view)
+        for (auto topic : m_enabled_streams_topics)
         {
-            if (m.isType<sensor_msgs::Image>() || m.isType<sensor_msgs::Imu>())
+            auto& times = get_frame_times(topic);
+            auto next = std::upper_bound(times.begin(), times.end(), as_rostime);
+            if (next == times.begin())
+            {
+                continue; //No frame of this topic before the seek time
+            }
+            auto id = ros_topic::get_stream_identifier(topic);
+            auto it = last_frames.find(id);
+            if (it == last_frames.end() || it->second < *std::prev(next))
             {
-                auto id = ros_topic::get_stream_identifier(m.getTopic());
-                last_frames[id] = m.getTime();
+                last_frames[id] = *std::prev(next);
             }
         }
         for (auto&& kvp : last_frames)
@@ -144,6 +300,28 @@ namespace librealsense
         }
         return result;
     }
+
+    const std::vector<rs2rosinternal::Time>& ros_reader::get_frame_times(const std::string& topic)
+    {
+        //The times are looked up once per topic, then each seek is a binary search
+        auto it = m_frame_times.find(topic);
+        if (it != m_frame_times.end())
+        {
+            return it->second;
+        }
+
+        auto& times = m_frame_times[topic];
+        rosbag::View view(m_file, rosbag::TopicQuery(topic), to_rostime(get_static_file_info_timestamp()));
+        for (auto&& m : view)
+        {
+            if (m.isType<sensor_msgs::Image>() || m.isType<sensor_msgs::Imu>())
+            {
+                times.push_back(m.getTime());
+            }
+        }
+        return times;
+    }
+
     nanoseconds ros_reader::query_duration() const
     {
         return m_total_duration;
@@ -151,7 +329,10 @@ namespace librealsense
 
     void ros_reader::reset()
     {
+        rs2rosinternal::Time next_time;
+        discard_read_ahead(next_time);
         m_file.close();
+        m_file.setIndexFile(m_use_index_file);
         m_file.open(m_file_path, rosbag::BagMode::Read);
         m_version = read_file_version(m_file);
         m_samples_view = nullptr;
@@ -163,6 +344,8 @@ namespace librealsense
     void ros_reader::enable_stream(const std::vector<device_serializer::stream_identifier>& stream_ids)
     {
         rs2rosinternal::Time start_time = rs2rosinternal::TIME_MIN + rs2rosinternal::Duration{ 0, 1 }; //first non 0 timestamp and afterward
+        rs2rosinternal::Time next_time;
+        bool read_ahead = discard_read_ahead(next_time);
         if (m_samples_view == nullptr) //Starting to stream
         {
             m_samples_view = std::unique_ptr<rosbag::View>(new rosbag::View(m_file, FalseQuery()));
@@ -172,7 +355,11 @@ namespace librealsense
         }
         else //Already streaming
         {
-            if (m_samples_itrator != m_samples_view->end())
+            if (read_ahead)
+            {
+                start_time = next_time;
+            }
+            else if (m_samples_itrator != m_samples_view->end())
             {
                 rosbag::MessageInstance sample_msg = *m_samples_itrator;
                 start_time = sample_msg.getTime();
@@ -206,12 +393,18 @@ namespace librealsense
 
     void ros_reader::disable_stream(const std::vector<device_serializer::stream_identifier>& stream_ids)
     {
+        rs2rosinternal::Time next_time;
+        bool read_ahead = discard_read_ahead(next_time);
         if (m_samples_view == nullptr)
         {
             return;
         }
         rs2rosinternal::Time curr_time;
-        if (m_samples_itrator == m_samples_view->end())
+        if (read_ahead)
+        {
+            curr_time = next_time;
+        }
+        else if (m_samples_itrator == m_samples_view->end())
         {
             curr_time = m_samples_view->getEndTime();
         }
@@ -407,7 +600,8 @@ namespace librealsense
     frame_holder ros_reader::create_image_from_message(const rosbag::MessageInstance &image_data) const
     {
         LOG_DEBUG("Trying to create an image frame from message");
-        auto msg = instantiate_msg<sensor_msgs::Image>(image_data);
+        // Deserialized into a frame_buffer, for the frame to adopt
+        auto msg = instantiate_msg<sensor_msgs::Image_<default_init_allocator<void>>>(image_data);
         frame_additional_data additional_data{};
         std::chrono::duration<double, std::milli> timestamp_ms(std::chrono::duration<double>(msg->header.stamp.toSec()));
         additional_data.timestamp = timestamp_ms.count();
@@ -433,8 +627,9 @@ namespace librealsense
             get_frame_metadata(m_file, info_topic, stream_id, image_data, additional_data);
         }
 
+        // Memory is only allocated for a user-supplied allocator to provide
         frame_interface* frame = m_frame_source->alloc_frame((stream_id.stream_type == RS2_STREAM_DEPTH) ? RS2_EXTENSION_DEPTH_FRAME : RS2_EXTENSION_VIDEO_FRAME,
-            msg->data.size(), additional_data, true);
+            msg->data.size(), additional_data, m_frame_source->has_allocator());
         if (frame == nullptr)
         {
             LOG_WARNING("Failed to allocate new frame");
@@ -443,13 +638,16 @@ namespace librealsense
         librealsense::video_frame* video_frame = static_cast<librealsense::video_frame*>(frame);
         video_frame->assign(msg->width, msg->height, msg->step, msg->step / msg->width * 8);
         rs2_format stream_format;
-        convert(msg->encoding, stream_format);
+        convert(std::string(msg->encoding.begin(), msg->encoding.end()), stream_format);
         //attaching a temp stream to the frame. Playback sensor should assign the real stream
         frame->set_stream(std::make_shared<video_stream_profile>(platform::stream_profile{}));
         frame->get_stream()->set_format(stream_format);
         frame->get_stream()->set_stream_index(int(stream_id.stream_index));
         frame->get_stream()->set_stream_type(stream_id.stream_type);
-        video_frame->data = std::move(msg->data);
+        if (video_frame->has_external_buffer())
+            memcpy(const_cast<byte*>(video_frame->get_frame_data()), msg->data.data(), msg->data.size());
+        else
+            video_frame->data = std::move(msg->data);
         librealsense::frame_holder fh{ video_frame };
         LOG_DEBUG("Created image frame: " << stream_id << " " << video_frame->get_width() << "x" << video_frame->get_height() << " " << stream_format);
 
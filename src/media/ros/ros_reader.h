@@ -2,6 +2,11 @@
 // Copyright(c) 2017 Intel Corporation. All Rights Reserved.
 
 #pragma once
+#include <condition_variable>
+#include <deque>
+#include <exception>
+#include <mutex>
+#include <thread>
 #include <core/serialization.h>
 #include "rosbag/view.h"
 #include "ros_file_format.h"
@@ -14,6 +19,7 @@ namespace librealsense
     {
     public:
         ros_reader(const std::string& file, const std::shared_ptr<context>& ctx);
+        ~ros_reader();
         device_snapshot query_device_description(const nanoseconds& time) override;
         std::shared_ptr<serialized_data> read_next_data() override;
         void seek_to_time(const nanoseconds& seek_time) override;
@@ -23,13 +29,22 @@ namespace librealsense
         virtual void enable_stream(const std::vector<device_serializer::stream_identifier>& stream_ids) override;
         virtual void disable_stream(const std::vector<device_serializer::stream_identifier>& stream_ids) override;
         const std::string& get_file_name() const override;
+        void set_read_ahead(size_t bytes) override;
+        void set_index_file(bool enabled) override;
 
     private:
+        // At most this many frames are read ahead, leaving the rest of the frame pool to the user
+        static const size_t MAX_READ_AHEAD_FRAMES = 8;
+
+        std::shared_ptr<serialized_data> read_next_message();
+        void read_ahead();
+        void stop_read_ahead();
+        bool discard_read_ahead(rs2rosinternal::Time& next_time);
 
         template <typename ROS_TYPE>
-        static typename ROS_TYPE::ConstPtr instantiate_msg(const rosbag::MessageInstance& msg)
+        static typename ROS_TYPE::Ptr instantiate_msg(const rosbag::MessageInstance& msg)
         {
-            typename ROS_TYPE::ConstPtr msg_instnance_ptr = msg.instantiate<ROS_TYPE>();
+            typename ROS_TYPE::Ptr msg_instnance_ptr = msg.instantiate<ROS_TYPE>();
             if (msg_instnance_ptr == nullptr)
             {
                 throw io_exception(to_string()
@@ -43,6 +58,7 @@ namespace librealsense
 
         std::shared_ptr<serialized_frame> create_frame(const rosbag::MessageInstance& msg);
         static nanoseconds get_file_duration(const rosbag::Bag& file, uint32_t version);
+        const std::vector<rs2rosinternal::Time>& get_frame_times(const std::string& topic);
         static void get_legacy_frame_metadata(const rosbag::Bag& bag,
             const device_serializer::stream_identifier& stream_id,
             const rosbag::MessageInstance &msg,
@@ -141,8 +157,30 @@ namespace librealsense
         std::unique_ptr<rosbag::View>           m_samples_view;
         rosbag::View::iterator                  m_samples_itrator;
         std::vector<std::string>                m_enabled_streams_topics;
+        std::map<std::string, std::vector<rs2rosinternal::Time>> m_frame_times;
         std::shared_ptr<context>                m_context;
         uint32_t                                m_version;
         float                                   m_legacy_depth_units;
+        bool                                    m_use_index_file;
+
+        // Reading ahead: a thread reads the next messages of the view into a queue, so the file access,
+        // decompression and deserialization overlap with the processing of the previous frames. The
+        // thread is stopped before the view changes; m_file_mutex guards the bag while it runs.
+        struct read_ahead_item
+        {
+            std::shared_ptr<serialized_data> data;
+            std::exception_ptr error;
+            size_t size;
+        };
+        size_t                                  m_read_ahead_budget;
+        std::thread                             m_read_ahead_thread;
+        std::mutex                              m_file_mutex;
+        std::mutex                              m_read_ahead_mutex;
+        std::condition_variable                 m_read_ahead_cv;
+        std::deque<read_ahead_item>             m_read_ahead_queue;
+        size_t                                  m_read_ahead_size;
+        size_t                                  m_read_ahead_frames;
+        bool                                    m_read_ahead_stop;
+        bool                                    m_read_ahead_done;
     };
 }
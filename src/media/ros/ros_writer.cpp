@@ -82,6 +82,11 @@ namespace librealsense
         return m_file_path;
     }
 
+    void ros_writer::set_index_file(bool enabled)
+    {
+        m_bag.setIndexFile(enabled);
+    }
+
     void ros_writer::write_file_version()
     {
         std_msgs::UInt32 msg;
@@ -199,37 +204,44 @@ namespace librealsense
 
     void ros_writer::write_motion_frame(const stream_identifier& stream_id, const nanoseconds& timestamp, frame_holder&& frame)
     {
-        sensor_msgs::Imu imu_msg;
         if (!frame)
         {
             throw io_exception("Null frame passed to write_motion_frame");
         }
-
-        imu_msg.header.seq = static_cast<uint32_t>(frame.frame->get_frame_number());
-        std::chrono::duration<double, std::milli> timestamp_ms(frame.frame->get_frame_timestamp());
-        imu_msg.header.stamp = rs2rosinternal::Time(std::chrono::duration<double>(timestamp_ms).count());
-        imu_msg.header.version = "1"; // the field is unused and therefore assigned for ROSbag versions control
-        auto data_ptr = reinterpret_cast<const float*>(frame.frame->get_frame_data());
-        if (stream_id.stream_type == RS2_STREAM_ACCEL)
-        {
-            imu_msg.linear_acceleration.x = data_ptr[0];
-            imu_msg.linear_acceleration.y = data_ptr[1];
-            imu_msg.linear_acceleration.z = data_ptr[2];
-        }
-
-        else if (stream_id.stream_type == RS2_STREAM_GYRO)
-        {
-            imu_msg.angular_velocity.x = data_ptr[0];
-            imu_msg.angular_velocity.y = data_ptr[1];
-            imu_msg.angular_velocity.z = data_ptr[2];
-        }
-        else
+        if (stream_id.stream_type != RS2_STREAM_ACCEL && stream_id.stream_type != RS2_STREAM_GYRO)
         {
             throw io_exception("Unsupported stream type for a motion frame");
         }
 
+        // The samples of a batched frame are recorded as separate messages, so that they play back as
+        // the frames of a single sample they would have been without batching
+        auto mf = As<motion_frame>(frame.frame);
+        const int samples = mf->get_sample_count();
+        const int stride = mf->get_sample_stride();
+        auto sample_timestamps = mf->get_sample_timestamps();
         auto topic = ros_topic::frame_data_topic(stream_id);
-        write_message(topic, timestamp, imu_msg);
+        for (int i = 0; i < samples; ++i)
+        {
+            sensor_msgs::Imu imu_msg;
+            imu_msg.header.seq = static_cast<uint32_t>(frame.frame->get_frame_number() - (samples - 1 - i));
+            std::chrono::duration<double, std::milli> timestamp_ms(sample_timestamps[i]);
+            imu_msg.header.stamp = rs2rosinternal::Time(std::chrono::duration<double>(timestamp_ms).count());
+            imu_msg.header.version = "1"; // the field is unused and therefore assigned for ROSbag versions control
+            auto data_ptr = reinterpret_cast<const float*>(frame.frame->get_frame_data() + i * stride);
+            if (stream_id.stream_type == RS2_STREAM_ACCEL)
+            {
+                imu_msg.linear_acceleration.x = data_ptr[0];
+                imu_msg.linear_acceleration.y = data_ptr[1];
+                imu_msg.linear_acceleration.z = data_ptr[2];
+            }
+            else
+            {
+                imu_msg.angular_velocity.x = data_ptr[0];
+                imu_msg.angular_velocity.y = data_ptr[1];
+                imu_msg.angular_velocity.z = data_ptr[2];
+            }
+            write_message(topic, timestamp, imu_msg);
+        }
         write_additional_frame_messages(stream_id, timestamp, frame);
     }
 
@@ -0,0 +1,179 @@
+// License: Apache 2.0. See LICENSE file in root directory.
+// Copyright(c) 2021 Intel Corporation. All Rights Reserved.
+
+#pragma once
+
+#include "core/options.h"
+
+#include <chrono>
+#include <mutex>
+
+
+namespace librealsense {
+
+
+// Counters describing how many control transfers an option cache saved
+struct option_cache_stats
+{
+    uint64_t transfers = 0;     // control transfers made: value and range queries, and sets
+    uint64_t values_saved = 0;  // value queries answered from the cache
+    uint64_t ranges_saved = 0;  // range queries answered from the cache
+};
+
+
+// Caches the values and ranges of the options of a sensor that each take a control transfer to
+// read, so that polling them does not. Ranges do not change and are kept for the lifetime of the
+// sensor. Values are kept for up to 'max_age', and written through when set. Setting any option of
+// the sensor discards the cached values of all the others, which it may have changed (setting the
+// exposure turns auto-exposure off, for example). Options whose value changes on its own, like one
+// the camera adjusts automatically or a status register, are marked volatile and always read.
+class option_cache
+{
+public:
+    typedef std::chrono::steady_clock clock;
+
+    // The cached state of one option, owned by the option and only accessed under the cache's lock
+    class entry
+    {
+        friend class option_cache;
+
+        float _value = 0;
+        clock::time_point _time;
+        uint64_t _generation = 0;  // of the cache when the value was read or written; 0 for none
+        bool _has_range = false;
+        option_range _range = {};
+        bool _volatile = false;
+
+    public:
+        void set_volatile( bool is_volatile ) { _volatile = is_volatile; }
+        bool is_volatile() const { return _volatile; }
+    };
+
+    static std::chrono::milliseconds default_max_age() { return std::chrono::milliseconds( 1000 ); }
+
+    explicit option_cache( std::chrono::milliseconds max_age = default_max_age() )
+        : _max_age( max_age )
+    {
+    }
+
+    // A max age of 0 disables the caching of values (ranges are still cached)
+    void set_max_age( std::chrono::milliseconds max_age )
+    {
+        std::lock_guard< std::mutex > lock( _mutex );
+        _max_age = max_age;
+    }
+
+    std::chrono::milliseconds get_max_age() const
+    {
+        std::lock_guard< std::mutex > lock( _mutex );
+        return _max_age;
+    }
+
+    // Every query then reads the camera, ranges included
+    void disable()
+    {
+        std::lock_guard< std::mutex > lock( _mutex );
+        _enabled = false;
+    }
+
+    // The value of the option, read by 'read' unless cached. No lock is held during the transfer: a
+    // value read while an option was being set is cached with the generation from before the set,
+    // and so is never returned.
+    template< class F > float query( entry & e, F read )
+    {
+        uint64_t generation;
+        {
+            std::lock_guard< std::mutex > lock( _mutex );
+            if( is_valid( e, clock::now() ) )
+            {
+                ++_stats.values_saved;
+                return e._value;
+            }
+            generation = _generation;
+        }
+
+        float value = read();
+
+        std::lock_guard< std::mutex > lock( _mutex );
+        ++_stats.transfers;
+        if( ! e._volatile )
+        {
+            e._value = value;
+            e._time = clock::now();
+            e._generation = generation;
+        }
+        return value;
+    }
+
+    // Sets the option through 'write', then keeps its value and discards all others
+    template< class F > void set( entry & e, float value, F write )
+    {
+        try
+        {
+            write();
+        }
+        catch( ... )
+        {
+            // The values the camera holds are not known anymore
+            invalidate();
+            throw;
+        }
+
+        std::lock_guard< std::mutex > lock( _mutex );
+        ++_stats.transfers;
+        ++_generation;
+        e._value = value;
+        e._time = clock::now();
+        e._generation = _generation;
+    }
+
+    // The range of the option, read by 'read' the first time only
+    template< class F > option_range get_range( entry & e, F read )
+    {
+        {
+            std::lock_guard< std::mutex > lock( _mutex );
+            if( _enabled && e._has_range )
+            {
+                ++_stats.ranges_saved;
+                return e._range;
+            }
+        }
+
+        auto range = read();
+
+        std::lock_guard< std::mutex > lock( _mutex );
+        ++_stats.transfers;
+        e._range = range;
+        e._has_range = true;
+        return range;
+    }
+
+    // Discards all the cached values, for when the camera may have changed them (ranges are kept)
+    void invalidate()
+    {
+        std::lock_guard< std::mutex > lock( _mutex );
+        ++_generation;
+    }
+
+    option_cache_stats get_stats() const
+    {
+        std::lock_guard< std::mutex > lock( _mutex );
+        return _stats;
+    }
+
+private:
+    bool is_valid( const entry & e, clock::time_point now ) const
+    {
+        return _enabled && ! e._volatile && e._generation == _generation && now - e._time <= _max_age
+            && _max_age.count() > 0;
+    }
+
+    mutable std::mutex _mutex;
+    std::chrono::milliseconds _max_age;
+    uint64_t _generation = 1;
+    bool _enabled = true;
+    option_cache_stats _stats;
+};
+
+
+}  // namespace librealsense
@@ -39,48 +39,65 @@ void librealsense::float_option::set(float value)
     _value = value;
 }
 
+void librealsense::uvc_pu_option::init_cache()
+{
+    // The camera adjusts these itself while in its automatic modes
+    if (val_in_range(_id, { RS2_OPTION_EXPOSURE, RS2_OPTION_GAIN, RS2_OPTION_WHITE_BALANCE }))
+        mark_volatile();
+}
+
 void librealsense::uvc_pu_option::set(float value)
 {
-    _ep.invoke_powered(
-        [this, value](platform::uvc_device& dev)
-        {
-            if (!dev.set_pu(_id, static_cast<int32_t>(value)))
-                throw invalid_value_exception(to_string() << "set_pu(id=" << std::to_string(_id) << ") failed!" << " Last Error: " << strerror(errno));
-            _record(*this);
-        });
+    auto pu_value = static_cast<int32_t>(value);
+    _ep.get_option_cache().set(_cache, static_cast<float>(pu_value), [this, pu_value]()
+    {
+        _ep.invoke_powered(
+            [this, pu_value](platform::uvc_device& dev)
+            {
+                if (!dev.set_pu(_id, pu_value))
+                    throw invalid_value_exception(to_string() << "set_pu(id=" << std::to_string(_id) << ") failed!" << " Last Error: " << strerror(errno));
+                _record(*this);
+            });
+    });
 }
 
 float librealsense::uvc_pu_option::query() const
 {
-    return static_cast<float>(_ep.invoke_powered(
-        [this](platform::uvc_device& dev)
-        {
-            int32_t value = 0;
-            if (!dev.get_pu(_id, value))
-                throw invalid_value_exception(to_string() << "get_pu(id=" << std::to_string(_id) << ") failed!" << " Last Error: " << strerror(errno));
+    return _ep.get_option_cache().query(_cache, [this]()
+    {
+        return static_cast<float>(_ep.invoke_powered(
+            [this](platform::uvc_device& dev)
+            {
+                int32_t value = 0;
+                if (!dev.get_pu(_id, value))
+                    throw invalid_value_exception(to_string() << "get_pu(id=" << std::to_string(_id) << ") failed!" << " Last Error: " << strerror(errno));
 
-            return static_cast<float>(value);
-        }));
+                return static_cast<float>(value);
+            }));
+    });
 }
 
 librealsense::option_range librealsense::uvc_pu_option::get_range() const
 {
-    auto uvc_range = _ep.invoke_powered(
-        [this](platform::uvc_device& dev)
-        {
-            return dev.get_pu_range(_id);
-        });
-
-    if (uvc_range.min.size() < sizeof(int32_t)) return option_range{0,0,1,0};
-
-    auto min = *(reinterpret_cast<int32_t*>(uvc_range.min.data()));
-    auto max = *(reinterpret_cast<int32_t*>(uvc_range.max.data()));
-    auto step = *(reinterpret_cast<int32_t*>(uvc_range.step.data()));
-    auto def = *(reinterpret_cast<int32_t*>(uvc_range.def.data()));
-    return option_range{static_cast<float>(min),
-                        static_cast<float>(max),
-                        static_cast<float>(step),
-                        static_cast<float>(def)};
+    return _ep.get_option_cache().get_range(_cache, [this]()
+    {
+        auto uvc_range = _ep.invoke_powered(
+            [this](platform::uvc_device& dev)
+            {
+                return dev.get_pu_range(_id);
+            });
+
+        if (uvc_range.min.size() < sizeof(int32_t)) return option_range{0,0,1,0};
+
+        auto min = *(reinterpret_cast<int32_t*>(uvc_range.min.data()));
+        auto max = *(reinterpret_cast<int32_t*>(uvc_range.max.data()));
+        auto step = *(reinterpret_cast<int32_t*>(uvc_range.step.data()));
+        auto def = *(reinterpret_cast<int32_t*>(uvc_range.def.data()));
+        return option_range{static_cast<float>(min),
+                            static_cast<float>(max),
+                            static_cast<float>(step),
+                            static_cast<float>(def)};
+    });
 }
 
 const char* librealsense::uvc_pu_option::get_description() const
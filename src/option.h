@@ -281,6 +281,57 @@ namespace librealsense
         using ptr = std::shared_ptr< bool_option >;
     };
 
+    // Off by default: frames the user holds on to keep the driver's buffers from being re-queued
+    class zero_copy_option : public bool_option
+    {
+    public:
+        zero_copy_option() : bool_option(false) {}
+        const char* get_description() const override
+        {
+            return "Deliver frames that reference the driver's buffers instead of a copy of them. "
+                   "Takes effect when the sensor is next opened";
+        }
+    };
+
+    // The staleness bound of a sensor's option cache, in milliseconds
+    class control_cache_max_age_option : public option_base
+    {
+    public:
+        explicit control_cache_max_age_option(option_cache& cache)
+            : option_base(option_range{ 0, 60000, 1, float(option_cache::default_max_age().count()) }),
+              _cache(cache) {}
+
+        void set(float value) override
+        {
+            if (!is_valid(value))
+                throw invalid_value_exception(to_string() << "set(...) failed! " << value << " is not a valid value");
+            _cache.set_max_age(std::chrono::milliseconds(static_cast<long long>(value)));
+            _recording_function(*this);
+        }
+        float query() const override { return static_cast<float>(_cache.get_max_age().count()); }
+        bool is_enabled() const override { return true; }
+        const char* get_description() const override
+        {
+            return "Milliseconds for which a control value read from the camera is reused instead of read again, "
+                   "0 to always read it";
+        }
+
+    private:
+        option_cache& _cache;
+    };
+
+    // 1 by default: each motion frame carries a single sample, as it always has
+    class motion_samples_per_frame_option : public float_option
+    {
+    public:
+        motion_samples_per_frame_option() : float_option(option_range{ 1, 256, 1, 1 }) {}
+        const char* get_description() const override
+        {
+            return "Number of IMU samples each motion frame carries, with the timestamp of each. "
+                   "Takes effect when the sensor is next started";
+        }
+    };
+
     class uvc_pu_option : public option
     {
     public:
@@ -298,13 +349,18 @@ namespace librealsense
         uvc_pu_option(uvc_sensor& ep, rs2_option id)
             : _ep(ep), _id(id)
         {
+            init_cache();
         }
 
         uvc_pu_option(uvc_sensor& ep, rs2_option id, const std::map<float, std::string>& description_per_value)
             : _ep(ep), _id(id), _description_per_value(description_per_value)
         {
+            init_cache();
         }
 
+        // The value is read from the camera on every query instead of being cached
+        void mark_volatile() { _cache.set_volatile(true); }
+
         const char* get_description() const override;
 
         const char* get_value_description(float val) const override
@@ -318,10 +374,13 @@ namespace librealsense
             _record = record_action;
         }
     private:
+        void init_cache();
+
         uvc_sensor& _ep;
         rs2_option _id;
         const std::map<float, std::string> _description_per_value;
         std::function<void(const option&)> _record = [](const option&) {};
+        mutable option_cache::entry _cache;
     };
 
     // XU control with exclusing access to setter/getters
@@ -331,49 +390,61 @@ namespace librealsense
     public:
         void set(float value) override
         {
-            _ep.invoke_powered(
-                [this, value](platform::uvc_device& dev)
-                {
-                    T t = static_cast<T>(value);
-                    if (!dev.set_xu(_xu, _id, reinterpret_cast<uint8_t*>(&t), sizeof(T)))
-                        throw invalid_value_exception(to_string() << "set_xu(id=" << std::to_string(_id) << ") failed!" << " Last Error: " << strerror(errno));
-                    _recording_function(*this);
-                });
+            T t = static_cast<T>(value);
+            _ep.get_option_cache().set(_cache, static_cast<float>(t), [this, &t]()
+            {
+                _ep.invoke_powered(
+                    [this, &t](platform::uvc_device& dev)
+                    {
+                        if (!dev.set_xu(_xu, _id, reinterpret_cast<uint8_t*>(&t), sizeof(T)))
+                            throw invalid_value_exception(to_string() << "set_xu(id=" << std::to_string(_id) << ") failed!" << " Last Error: " << strerror(errno));
+                        _recording_function(*this);
+                    });
+            });
         }
 
         float query() const override
         {
-            return static_cast<float>(_ep.invoke_powered(
-                [this](platform::uvc_device& dev)
-                {
-                    T t;
-                    if (!dev.get_xu(_xu, _id, reinterpret_cast<uint8_t*>(&t), sizeof(T)))
-                        throw invalid_value_exception(to_string() << "get_xu(id=" << std::to_string(_id) << ") failed!" << " Last Error: " << strerror(errno));
+            return _ep.get_option_cache().query(_cache, [this]()
+            {
+                return static_cast<float>(_ep.invoke_powered(
+                    [this](platform::uvc_device& dev)
+                    {
+                        T t;
+                        if (!dev.get_xu(_xu, _id, reinterpret_cast<uint8_t*>(&t), sizeof(T)))
+                            throw invalid_value_exception(to_string() << "get_xu(id=" << std::to_string(_id) << ") failed!" << " Last Error: " << strerror(errno));
 
-                    return static_cast<float>(t);
-                }));
+                        return static_cast<float>(t);
+                    }));
+            });
         }
 
         option_range get_range() const override
         {
-            auto uvc_range = _ep.invoke_powered(
-                [this](platform::uvc_device& dev)
-                {
-                    return dev.get_xu_range(_xu, _id, sizeof(T));
-                });
+            return _ep.get_option_cache().get_range(_cache, [this]()
+            {
+                auto uvc_range = _ep.invoke_powered(
+                    [this](platform::uvc_device& dev)
+                    {
+                        return dev.get_xu_range(_xu, _id, sizeof(T));
+                    });
 
-            if (uvc_range.min.size() < sizeof(int32_t)) return option_range{ 0,0,1,0 };
+                if (uvc_range.min.size() < sizeof(int32_t)) return option_range{ 0,0,1,0 };
 
-            auto min = *(reinterpret_cast<int32_t*>(uvc_range.min.data()));
-            auto max = *(reinterpret_cast<int32_t*>(uvc_range.max.data()));
-            auto step = *(reinterpret_cast<int32_t*>(uvc_range.step.data()));
-            auto def = *(reinterpret_cast<int32_t*>(uvc_range.def.data()));
-            return option_range{ static_cast<float>(min),
-                                static_cast<float>(max),
-                                static_cast<float>(step),
-                                static_cast<float>(def) };
+                auto min = *(reinterpret_cast<int32_t*>(uvc_range.min.data()));
+                auto max = *(reinterpret_cast<int32_t*>(uvc_range.max.data()));
+                auto step = *(reinterpret_cast<int32_t*>(uvc_range.step.data()));
+                auto def = *(reinterpret_cast<int32_t*>(uvc_range.def.data()));
+                return option_range{ static_cast<float>(min),
+                                    static_cast<float>(max),
+                                    static_cast<float>(step),
+                                    static_cast<float>(def) };
+            });
         }
 
+        // The value is read from the camera on every query instead of being cached
+        void mark_volatile() { _cache.set_volatile(true); }
+
         bool is_enabled() const override { return true; }
 
         uvc_xu_option(uvc_sensor& ep, platform::extension_unit xu, uint8_t id, std::string description)
@@ -405,6 +476,7 @@ namespace librealsense
         std::string         _desciption;
         std::function<void(const option&)> _recording_function = [](const option&) {};
         const std::map<float, std::string> _description_per_value;
+        mutable option_cache::entry _cache;
     };
 
     template<typename T>
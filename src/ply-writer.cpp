@@ -0,0 +1,252 @@
+// License: Apache 2.0. See LICENSE file in root directory.
+// Copyright(c) 2021 Intel Corporation. All Rights Reserved.
+#include "ply-writer.h"
+
+#include <librealsense2/utilities/concurrency/parallel-for.h>
+
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+#include <fstream>
+#include <sstream>
+
+#define MIN_DISTANCE 1e-6
+
+namespace librealsense {
+
+namespace {
+
+const size_t face_size = sizeof( uint8_t ) + 3 * sizeof( int );
+
+inline bool is_valid( const float3 & v )
+{
+    return std::fabs( v.x ) >= MIN_DISTANCE || std::fabs( v.y ) >= MIN_DISTANCE || std::fabs( v.z ) >= MIN_DISTANCE;
+}
+
+inline float3 flip( const float3 & v )
+{
+    return { v.x, -v.y, -v.z };
+}
+
+inline float3 cross( const float3 & a, const float3 & b )
+{
+    return { a.y * b.z - a.z * b.y, a.z * b.x - a.x * b.z, a.x * b.y - a.y * b.x };
+}
+
+// The normals of the two faces of the quad whose top-left corner is 'a': (a, d, b) and (d, a, c)
+inline void quad_normals( const float3 * vertices, int width, int a, float3 & n1, float3 & n2 )
+{
+    auto pa = flip( vertices[a] ), pb = flip( vertices[a + 1] );
+    auto pc = flip( vertices[a + width] ), pd = flip( vertices[a + width + 1] );
+    n1 = cross( pd - pa, pb - pa );
+    n2 = cross( pc - pa, pd - pa );
+}
+
+inline byte * put( byte * p, const void * value, size_t size )
+{
+    memcpy( p, value, size );
+    return p + size;
+}
+
+}  // namespace
+
+
+void ply_writer::write( const std::string & fname,
+                        const float3 * vertices,
+                        int width,
+                        int height,
+                        const float2 * texcoords,
+                        const texture * tex,
+                        const options & opts )
+{
+    const bool mesh = opts.mesh;
+    const bool normals = mesh && opts.normals;
+    const bool colors = texcoords && tex;
+    const float threshold = opts.threshold;
+    const size_t vertex_size = 3 * sizeof( float ) + ( normals ? 3 * sizeof( float ) : 0 ) + ( colors ? 3 : 0 );
+    const int count = width * height;
+
+    _index.resize( count );
+    _quads.resize( count );
+    _row_vertices.resize( height + 1 );
+    _row_faces.resize( height + 1 );
+
+    // Count the vertices and faces of each row, and mark the quads to make faces of
+    parallel_for( height, [&]( size_t first_row, size_t end_row ) {
+        for( int y = int( first_row ); y < int( end_row ); ++y )
+        {
+            auto row = vertices + y * width;
+            auto quads = _quads.data() + y * width;
+            int valid = 0, faces = 0;
+            for( int x = 0; x < width; ++x )
+            {
+                valid += is_valid( row[x] );
+
+                quads[x] = 0;
+                if( x == width - 1 || y == height - 1 )
+                    continue;
+                auto & a = row[x], & b = row[x + 1], & c = row[x + width], & d = row[x + width + 1];
+                if( a.z && b.z && c.z && d.z
+                    && std::fabs( a.z - b.z ) < threshold && std::fabs( a.z - c.z ) < threshold
+                    && std::fabs( b.z - d.z ) < threshold && std::fabs( c.z - d.z ) < threshold
+                    && is_valid( a ) && is_valid( b ) && is_valid( c ) && is_valid( d ) )
+                {
+                    quads[x] = 1;
+                    faces += 2;
+                }
+            }
+            _row_vertices[y] = valid;
+            _row_faces[y] = mesh ? faces : 0;
+        }
+    }, _threads );
+
+    // ... to offsets, so that each row can be written on its own
+    int vertex_count = 0, face_count = 0;
+    for( int y = 0; y <= height; ++y )
+    {
+        auto v = _row_vertices[y], f = _row_faces[y];
+        _row_vertices[y] = vertex_count;
+        _row_faces[y] = face_count;
+        if( y < height )
+        {
+            vertex_count += v;
+            face_count += f;
+        }
+    }
+
+    parallel_for( height, [&]( size_t first_row, size_t end_row ) {
+        for( int y = int( first_row ); y < int( end_row ); ++y )
+        {
+            int i = _row_vertices[y];
+            for( int p = y * width; p < ( y + 1 ) * width; ++p )
+                _index[p] = is_valid( vertices[p] ) ? i++ : -1;
+        }
+    }, _threads );
+
+    const uint8_t * texture_data = nullptr;
+    int tex_width = 0, tex_height = 0, tex_bpp = 0, tex_stride = 0;
+    if( colors )
+    {
+        texture_data = tex->data;
+        tex_width = tex->width;
+        tex_height = tex->height;
+        tex_bpp = tex->bpp;
+        tex_stride = tex->stride;
+    }
+
+    _body.resize( vertex_count * vertex_size + face_count * face_size );
+    auto faces_begin = _body.data() + vertex_count * vertex_size;
+
+    parallel_for( height, [&]( size_t first_row, size_t end_row ) {
+        for( int y = int( first_row ); y < int( end_row ); ++y )
+        {
+            auto out = _body.data() + _row_vertices[y] * vertex_size;
+            for( int x = 0; x < width; ++x )
+            {
+                const int p = y * width + x;
+                if( _index[p] < 0 )
+                    continue;
+
+                auto v = flip( vertices[p] );
+                out = put( out, &v, sizeof( v ) );
+
+                if( normals )
+                {
+                    // The faces around the vertex: it is the top-left corner of quad (x, y), the top
+                    // right of (x-1, y), the bottom left of (x, y-1) and the bottom right of (x-1, y-1)
+                    float3 sum = { 0, 0, 0 }, n1, n2;
+                    bool any = false;
+                    if( _quads[p] )
+                    {
+                        quad_normals( vertices, width, p, n1, n2 );
+                        sum = sum + n1 + n2;
+                        any = true;
+                    }
+                    if( x > 0 && _quads[p - 1] )
+                    {
+                        quad_normals( vertices, width, p - 1, n1, n2 );
+                        sum = sum + n1;
+                        any = true;
+                    }
+                    if( y > 0 && _quads[p - width] )
+                    {
+                        quad_normals( vertices, width, p - width, n1, n2 );
+                        sum = sum + n2;
+                        any = true;
+                    }
+                    if( x > 0 && y > 0 && _quads[p - width - 1] )
+                    {
+                        quad_normals( vertices, width, p - width - 1, n1, n2 );
+                        sum = sum + n1 + n2;
+                        any = true;
+                    }
+                    if( any )
+                        sum = sum * ( 1.f / std::sqrt( sum.x * sum.x + sum.y * sum.y + sum.z * sum.z ) );
+                    out = put( out, &sum, sizeof( sum ) );
+                }
+
+                if( colors )
+                {
+                    int tx = std::min( std::max( int( texcoords[p].x * tex_width + .5f ), 0 ), tex_width - 1 );
+                    int ty = std::min( std::max( int( texcoords[p].y * tex_height + .5f ), 0 ), tex_height - 1 );
+                    out = put( out, texture_data + tx * tex_bpp + ty * tex_stride, 3 );
+                }
+            }
+
+            if( ! mesh )
+                continue;
+            out = faces_begin + _row_faces[y] * face_size;
+            for( int x = 0; x < width; ++x )
+            {
+                const int a = y * width + x;
+                if( ! _quads[a] )
+                    continue;
+                const int b = a + 1, c = a + width, d = a + width + 1;
+                const uint8_t three = 3;
+                const int face1[] = { _index[a], _index[d], _index[b] };
+                const int face2[] = { _index[d], _index[a], _index[c] };
+                out = put( out, &three, sizeof( three ) );
+                out = put( out, face1, sizeof( face1 ) );
+                out = put( out, &three, sizeof( three ) );
+                out = put( out, face2, sizeof( face2 ) );
+            }
+        }
+    }, _threads );
+
+    std::ostringstream header;
+    header << "ply\n";
+    header << "format binary_little_endian 1.0\n";
+    header << "comment pointcloud saved from Realsense Viewer\n";
+    header << "element vertex " << vertex_count << "\n";
+    header << "property float" << sizeof( float ) * 8 << " x\n";
+    header << "property float" << sizeof( float ) * 8 << " y\n";
+    header << "property float" << sizeof( float ) * 8 << " z\n";
+    if( normals )
+    {
+        header << "property float" << sizeof( float ) * 8 << " nx\n";
+        header << "property float" << sizeof( float ) * 8 << " ny\n";
+        header << "property float" << sizeof( float ) * 8 << " nz\n";
+    }
+    if( colors )
+    {
+        header << "property uchar red\n";
+        header << "property uchar green\n";
+        header << "property uchar blue\n";
+    }
+    if( mesh )
+    {
+        header << "element face " << face_count << "\n";
+        header << "property list uchar int vertex_indices\n";
+    }
+    header << "end_header\n";
+
+    // we assume little endian architecture on your device
+    std::ofstream out( fname, std::ios_base::binary );
+    auto text = header.str();
+    out.write( text.data(), text.size() );
+    out.write( reinterpret_cast< const char * >( _body.data() ), _body.size() );
+    if( ! out )
+        throw io_exception( to_string() << "Failed to write " << fname );
+}
+
+}  // namespace librealsense
@@ -0,0 +1,65 @@
+// License: Apache 2.0. See LICENSE file in root directory.
+// Copyright(c) 2021 Intel Corporation. All Rights Reserved.
+#pragma once
+
+#include "types.h"
+
+#include <string>
+#include <vector>
+
+namespace librealsense {
+
+// Writes organized point clouds (one vertex per depth pixel) as binary little-endian PLY files:
+// the valid vertices, with their normal and color if asked for, and the triangles of the mesh
+// joining neighbouring vertices of similar depth.
+//
+// Rows are processed in parallel, into one buffer holding the file's body that is written with a
+// single call. The buffers are kept from one write to the next, so a writer reused for a sequence
+// of clouds of the same size (as when exporting a stream) does not allocate. A writer is used by
+// one thread at a time.
+class ply_writer
+{
+public:
+    struct options
+    {
+        bool mesh = true;
+        bool normals = false;     // per-vertex normals, averaged over the faces around the vertex
+        float threshold = 0.05f;  // faces are only made of vertices whose depths differ less than this
+    };
+
+    // The image the colors are taken from: the first three bytes of each pixel
+    struct texture
+    {
+        const uint8_t * data;
+        int width;
+        int height;
+        int bpp;  // bytes per pixel
+        int stride;
+    };
+
+    // The rows are split between at most 'threads' threads, 0 for as many as there are cores
+    explicit ply_writer( size_t threads = 0 )
+        : _threads( threads )
+    {
+    }
+
+    // 'texcoords' and 'colors' are optional: without them no colors are written. Vertices are
+    // written with y and z negated, as expected by PLY viewers.
+    void write( const std::string & fname,
+                const float3 * vertices,
+                int width,
+                int height,
+                const float2 * texcoords,
+                const texture * colors,
+                const options & opts );
+
+private:
+    size_t _threads;
+    std::vector< int > _index;  // each pixel's index in the vertices written, or -1 if not valid
+    std::vector< uint8_t > _quads;  // whether each pixel is the top-left corner of two faces
+    std::vector< int > _row_vertices;  // vertices and faces of each row, then their offsets
+    std::vector< int > _row_faces;
+    std::vector< byte > _body;
+};
+
+}  // namespace librealsense
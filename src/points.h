@@ -3,6 +3,7 @@
 #pragma once
 
 #include "frame.h"
+#include "ply-writer.h"
 
 namespace librealsense {
 
@@ -10,7 +11,11 @@ class points : public frame
 {
 public:
     float3 * get_vertices();
-    void export_to_ply( const std::string & fname, const frame_holder & texture );
+    // Writes the cloud through 'writer', which keeps its buffers for the next export
+    void export_to_ply( ply_writer & writer,
+                        const std::string & fname,
+                        const frame_holder & texture,
+                        const ply_writer::options & opts = ply_writer::options() );
     size_t get_vertex_count() const;
     float2 * get_texture_coordinates();
 };
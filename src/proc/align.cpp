@@ -10,54 +10,130 @@
 #include "align.h"
 #include "stream.h"
 
+#include <librealsense2/utilities/concurrency/parallel-for.h>
+
 namespace librealsense
 {
     template<int N> struct bytes { byte b[N]; };
 
+    // Projects the top-left and bottom-right corners of every valid depth pixel onto the other image,
+    // and calls map_pixel(depth_pixel_index, other_x0, other_y0, other_x1, other_y1) for the pixels
+    // whose rectangle lies entirely inside the other image
+    template<class GET_DEPTH, class MAP_PIXEL>
+    void map_pixel_corners(const rs2_intrinsics& depth_intrin, const rs2_extrinsics& depth_to_other,
+        const rs2_intrinsics& other_intrin, GET_DEPTH get_depth, MAP_PIXEL map_pixel)
+    {
+        // Iterate over the pixels of the depth image, in bands of rows
+        parallel_for(depth_intrin.height, [&](size_t first_row, size_t end_row)
+        {
+            for (int depth_y = int(first_row); depth_y < int(end_row); ++depth_y)
+            {
+                int depth_pixel_index = depth_y * depth_intrin.width;
+                for (int depth_x = 0; depth_x < depth_intrin.width; ++depth_x, ++depth_pixel_index)
+                {
+                    // Skip over depth pixels with the value of zero, we have no depth data so we will not write anything into our aligned images
+                    if (float depth = get_depth(depth_pixel_index))
+                    {
+                        // Map the top-left corner of the depth pixel onto the other image
+                        float depth_pixel[2] = { depth_x - 0.5f, depth_y - 0.5f }, depth_point[3], other_point[3], other_pixel[2];
+                        rs2_deproject_pixel_to_point(depth_point, &depth_intrin, depth_pixel, depth);
+                        rs2_transform_point_to_point(other_point, &depth_to_other, depth_point);
+                        rs2_project_point_to_pixel(other_pixel, &other_intrin, other_point);
+                        const int other_x0 = static_cast<int>(other_pixel[0] + 0.5f);
+                        const int other_y0 = static_cast<int>(other_pixel[1] + 0.5f);
+
+                        // Map the bottom-right corner of the depth pixel onto the other image
+                        depth_pixel[0] = depth_x + 0.5f; depth_pixel[1] = depth_y + 0.5f;
+                        rs2_deproject_pixel_to_point(depth_point, &depth_intrin, depth_pixel, depth);
+                        rs2_transform_point_to_point(other_point, &depth_to_other, depth_point);
+                        rs2_project_point_to_pixel(other_pixel, &other_intrin, other_point);
+                        const int other_x1 = static_cast<int>(other_pixel[0] + 0.5f);
+                        const int other_y1 = static_cast<int>(other_pixel[1] + 0.5f);
+
+                        if (other_x0 < 0 || other_y0 < 0 || other_x1 >= other_intrin.width || other_y1 >= other_intrin.height)
+                            continue;
+
+                        map_pixel(depth_pixel_index, other_x0, other_y0, other_x1, other_y1);
+                    }
+                }
+            }
+        });
+    }
+
     template<class GET_DEPTH, class TRANSFER_PIXEL>
     void align_images(const rs2_intrinsics& depth_intrin, const rs2_extrinsics& depth_to_other,
         const rs2_intrinsics& other_intrin, GET_DEPTH get_depth, TRANSFER_PIXEL transfer_pixel)
     {
-        // Iterate over the pixels of the depth image
-#pragma omp parallel for schedule(dynamic)
-        for (int depth_y = 0; depth_y < depth_intrin.height; ++depth_y)
+        map_pixel_corners(depth_intrin, depth_to_other, other_intrin, get_depth,
+            [&](int depth_pixel_index, int other_x0, int other_y0, int other_x1, int other_y1)
+        {
+            // Transfer between the depth pixels and the pixels inside the rectangle on the other image
+            for (int y = other_y0; y <= other_y1; ++y)
+            {
+                for (int x = other_x0; x <= other_x1; ++x)
+                {
+                    transfer_pixel(depth_pixel_index, y * other_intrin.width + x);
+                }
+            }
+        });
+    }
+
+    void rasterize_depth_to_other(const uint16_t* z_pixels, const rs2_intrinsics& depth,
+                                  uint16_t* dest, const rs2_intrinsics& other,
+                                  const int2* top_left, const int2* bottom_right)
+    {
+        // The range of rows of the other image each depth row writes to (x is the first, y the last)
+        std::vector<int2> rows(depth.height);
+        parallel_for(depth.height, [&](size_t first_row, size_t end_row)
         {
-            int depth_pixel_index = depth_y * depth_intrin.width;
-            for (int depth_x = 0; depth_x < depth_intrin.width; ++depth_x, ++depth_pixel_index)
+            for (int y = int(first_row); y < int(end_row); ++y)
             {
-                // Skip over depth pixels with the value of zero, we have no depth data so we will not write anything into our aligned images
-                if (float depth = get_depth(depth_pixel_index))
+                int2 range = { other.height, -1 };
+                for (int i = y * depth.width, end = i + depth.width; i < end; ++i)
                 {
-                    // Map the top-left corner of the depth pixel onto the other image
-                    float depth_pixel[2] = { depth_x - 0.5f, depth_y - 0.5f }, depth_point[3], other_point[3], other_pixel[2];
-                    rs2_deproject_pixel_to_point(depth_point, &depth_intrin, depth_pixel, depth);
-                    rs2_transform_point_to_point(other_point, &depth_to_other, depth_point);
-                    rs2_project_point_to_pixel(other_pixel, &other_intrin, other_point);
-                    const int other_x0 = static_cast<int>(other_pixel[0] + 0.5f);
-                    const int other_y0 = static_cast<int>(other_pixel[1] + 0.5f);
-
-                    // Map the bottom-right corner of the depth pixel onto the other image
-                    depth_pixel[0] = depth_x + 0.5f; depth_pixel[1] = depth_y + 0.5f;
-                    rs2_deproject_pixel_to_point(depth_point, &depth_intrin, depth_pixel, depth);
-                    rs2_transform_point_to_point(other_point, &depth_to_other, depth_point);
-                    rs2_project_point_to_pixel(other_pixel, &other_intrin, other_point);
-                    const int other_x1 = static_cast<int>(other_pixel[0] + 0.5f);
-                    const int other_y1 = static_cast<int>(other_pixel[1] + 0.5f);
-
-                    if (other_x0 < 0 || other_y0 < 0 || other_x1 >= other_intrin.width || other_y1 >= other_intrin.height)
+                    if (z_pixels[i] && top_left[i].y <= bottom_right[i].y)
+                    {
+                        range.x = std::min(range.x, std::max(top_left[i].y, 0));
+                        range.y = std::max(range.y, std::min(bottom_right[i].y, other.height - 1));
+                    }
+                }
+                rows[y] = range;
+            }
+        });
+
+        // Each band only visits the depth rows that write to it
+        const int band_height = 64;
+        const int bands = (other.height + band_height - 1) / band_height;
+        parallel_for(bands, [&](size_t first_band, size_t end_band)
+        {
+            for (int band = int(first_band); band < int(end_band); ++band)
+            {
+                const int band_first = band * band_height;
+                const int band_last = std::min(band_first + band_height, other.height) - 1;
+                for (int y = 0; y < depth.height; ++y)
+                {
+                    if (rows[y].y < band_first || rows[y].x > band_last)
                         continue;
 
-                    // Transfer between the depth pixels and the pixels inside the rectangle on the other image
-                    for (int y = other_y0; y <= other_y1; ++y)
+                    for (int i = y * depth.width, end = i + depth.width; i < end; ++i)
                     {
-                        for (int x = other_x0; x <= other_x1; ++x)
+                        // Skip over depth pixels with the value of zero, we have no depth data so we will not write anything into our aligned images
+                        const uint16_t z = z_pixels[i];
+                        if (!z)
+                            continue;
+
+                        const int x0 = std::max(top_left[i].x, 0), x1 = std::min(bottom_right[i].x, other.width - 1);
+                        const int y0 = std::max(top_left[i].y, band_first), y1 = std::min(bottom_right[i].y, band_last);
+                        for (int other_y = y0; other_y <= y1; ++other_y)
                         {
-                            transfer_pixel(depth_pixel_index, y * other_intrin.width + x);
+                            auto out = dest + other_y * other.width;
+                            for (int other_x = x0; other_x <= x1; ++other_x)
+                                out[other_x] = out[other_x] ? std::min(out[other_x], z) : z;
                         }
                     }
                 }
             }
-        }
+        });
     }
 
     align::align(rs2_stream to_stream) : align(to_stream, "Align")
@@ -79,14 +155,23 @@ namespace librealsense
         auto z_pixels = reinterpret_cast<const uint16_t*>(depth.get_data());
         auto out_z = (uint16_t *)(aligned_data);
 
-        align_images(z_intrin, z_to_other, other_intrin,
+        // The rectangles of neighboring depth pixels overlap, so rather than writing them as they are
+        // projected (and racing between threads), they are all projected first and then rasterized
+        const size_t size = z_intrin.width * z_intrin.height;
+        _pixel_top_left.assign(size, { 0, 0 });
+        _pixel_bottom_right.assign(size, { -1, -1 });
+        auto top_left = _pixel_top_left.data();
+        auto bottom_right = _pixel_bottom_right.data();
+
+        map_pixel_corners(z_intrin, z_to_other, other_intrin,
             [z_pixels, z_scale](int z_pixel_index) { return z_scale * z_pixels[z_pixel_index]; },
-            [out_z, z_pixels](int z_pixel_index, int other_pixel_index)
+            [top_left, bottom_right](int z_pixel_index, int other_x0, int other_y0, int other_x1, int other_y1)
         {
-            out_z[other_pixel_index] = out_z[other_pixel_index] ?
-                std::min((int)out_z[other_pixel_index], (int)z_pixels[z_pixel_index]) :
-                z_pixels[z_pixel_index];
+            top_left[z_pixel_index] = { other_x0, other_y0 };
+            bottom_right[z_pixel_index] = { other_x1, other_y1 };
         });
+
+        rasterize_depth_to_other(z_pixels, z_intrin, out_z, other_intrin, top_left, bottom_right);
     }
 
     template<int N, class GET_DEPTH>
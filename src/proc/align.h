@@ -12,6 +12,14 @@
 
 namespace librealsense
 {
+    // Writes the depth of every valid depth pixel into the rectangle of pixels it covers in the other
+    // image, [top_left, bottom_right] clipped to the image, keeping the nearest depth where rectangles
+    // overlap. The other image is filled in bands of rows, each band by a single thread, so no two
+    // threads ever write to the same pixel and the result does not depend on the thread count.
+    void rasterize_depth_to_other(const uint16_t* z_pixels, const rs2_intrinsics& depth,
+                                  uint16_t* dest, const rs2_intrinsics& other,
+                                  const int2* top_left, const int2* bottom_right);
+
     class LRS_EXTENSION_API align : public generic_processing_block
     {
     public:
@@ -52,5 +60,9 @@ namespace librealsense
     private:
         rs2::video_frame allocate_aligned_frame(const rs2::frame_source& source, const rs2::video_frame& from, const rs2::video_frame& to);
         void align_frames(rs2::video_frame& aligned, const rs2::video_frame& from, const rs2::video_frame& to);
+
+        // Depth pixel corners projected onto the other image, reused between frames
+        std::vector<int2> _pixel_top_left;
+        std::vector<int2> _pixel_bottom_right;
     };
 }
@@ -6,6 +6,8 @@
 #include "option.h"
 #include "image-avx.h"
 #include "image.h"
+#include "cpu-features.h"
+#include "format-converter-kernels.h"
 
 #define STB_IMAGE_STATIC
 #define STB_IMAGE_IMPLEMENTATION
@@ -18,32 +20,6 @@
 #include <tmmintrin.h> // For SSSE3 intrinsics
 #endif
 
-#if defined (ANDROID) || (defined (__linux__) && !defined (__x86_64__)) || (defined (__APPLE__) && !defined (__x86_64__))
-
-bool has_avx() { return false; }
-
-#else
-
-#ifdef _WIN32
-#include <intrin.h>
-#define cpuid(info, x)    __cpuidex(info, x, 0)
-#else
-#include <cpuid.h>
-void cpuid(int info[4], int info_type) {
-    __cpuid_count(info_type, 0, info[0], info[1], info[2], info[3]);
-}
-#endif
-
-bool has_avx()
-{
-    int info[4];
-    cpuid(info, 0);
-    cpuid(info, 0x80000000);
-    return (info[2] & ((int)1 << 28)) != 0;
-}
-
-#endif
-
 namespace librealsense 
 {
     /////////////////////////////
@@ -60,7 +36,7 @@ namespace librealsense
         return;
 #endif
 #if defined __SSSE3__ && ! defined ANDROID
-        static bool do_avx = has_avx();
+        static bool do_avx = cpu_has_avx2();
 #ifdef __AVX2__
 
         if (do_avx)
@@ -671,15 +647,8 @@ namespace librealsense
     /////////////////////////////
     void unpack_rgb_from_bgr(byte * const dest[], const byte * source, int width, int height, int actual_size)
     {
-        auto count = width * height;
-        auto in = reinterpret_cast<const uint8_t *>(source);
-        auto out = reinterpret_cast<uint8_t *>(dest[0]);
-
-        librealsense::copy(out, in, count * 3);
-        for (auto i = 0; i < count; i++)
-        {
-            std::swap(out[i * 3], out[i * 3 + 2]);
-        }
+        static auto convert = get_format_converter_kernel(RS2_FORMAT_BGR8, RS2_FORMAT_RGB8);
+        convert(dest, source, width * height);
     }
 
     void yuy2_converter::process_function(byte * const dest[], const byte * source, int width, int height, int actual_size, int input_size)
@@ -10,6 +10,10 @@
 #include "option.h"
 #include "colorizer.h"
 #include "disparity-transform.h"
+#include "proc/sse/sse-colorizer.h"
+#include "cpu-features.h"
+
+#include <algorithm>
 
 namespace librealsense
 {
@@ -141,10 +145,12 @@ namespace librealsense
     colorizer::colorizer(const char* name)
         : stream_filter_processing_block(name),
          _min(0.f), _max(6.f), _equalize(true), 
-         _target_stream_profile(), _histogram()
+         _target_stream_profile(), _histogram(),
+         _use_avx2(cpu_has_avx2())
     {
         _histogram = std::vector<int>(MAX_DEPTH, 0);
         _hist_data = _histogram.data();
+        _lut = std::vector<uint32_t>(MAX_DEPTH, 0);
         _stream_filter.stream = RS2_STREAM_DEPTH;
         _stream_filter.format = RS2_FORMAT_Z16;
 
@@ -286,8 +292,8 @@ namespace librealsense
             else if (depth_format == RS2_FORMAT_Z16)
             {
                 auto depth_data = reinterpret_cast<const uint16_t*>(depth.get_data());
-                update_histogram(_hist_data, depth_data, w, h);
-                make_rgb_data<uint16_t>(depth_data, rgb_data, w, h, coloring_function);
+                update_equalized_lut(build_histogram(depth_data, w, h));
+                apply_lut(depth_data, rgb_data, w, h);
             }
         };
 
@@ -314,13 +320,8 @@ namespace librealsense
             else if (depth_format == RS2_FORMAT_Z16)
             {
                 auto depth_data = reinterpret_cast<const uint16_t*>(depth.get_data());
-                auto min = _min;
-                auto max = _max;
-                auto coloring_function = [&, this](float data) {
-                    if (min >= max) return 0.f;
-                    return (data * _depth_units - min) / (max - min);
-                };
-                make_rgb_data<uint16_t>(depth_data, rgb_data, w, h, coloring_function);
+                update_cropped_lut();
+                apply_lut(depth_data, rgb_data, w, h);
             }
         };
 
@@ -336,4 +337,119 @@ namespace librealsense
 
         return ret;
     }
+
+    namespace
+    {
+        inline uint32_t pack_rgb(const float3& c)
+        {
+            return uint32_t((uint8_t)c.x) | uint32_t((uint8_t)c.y) << 8 | uint32_t((uint8_t)c.z) << 16;
+        }
+    }
+
+    // Same result as update_histogram(), which remains for the other users. Slices of the image are
+    // counted into their own sub-histograms, spread across threads, and then merged. The
+    // sub-histograms only span the values present in the image, so they are cheap to clear and merge.
+    // Returns the largest depth value in the image.
+    int colorizer::build_histogram(const uint16_t* depth_data, int w, int h)
+    {
+        const int size = w * h;
+        uint16_t max_depth = 0;
+        for (int i = 0; i < size; ++i)
+            max_depth = std::max(max_depth, depth_data[i]);
+
+        const int slices = 4;
+        const int bins = max_depth + 1;
+        const int slice_size = (size + slices - 1) / slices;
+        _sub_histograms.assign(size_t(slices) * bins, 0);
+        auto sub_histograms = _sub_histograms.data();
+
+#pragma omp parallel for
+        for (int s = 0; s < slices; ++s)
+        {
+            auto sub = sub_histograms + size_t(s) * bins;
+            const int end = std::min(size, (s + 1) * slice_size);
+            for (int i = s * slice_size; i < end; ++i)
+                ++sub[depth_data[i]];
+        }
+
+#pragma omp parallel for
+        for (int i = 0; i < bins; ++i)
+        {
+            int sum = 0;
+            for (int s = 0; s < slices; ++s)
+                sum += sub_histograms[size_t(s) * bins + i];
+            _hist_data[i] = sum;
+        }
+
+        // Build a cumulative histogram for the indices in [1,0xFFFF]
+        for (int i = 2; i < bins; ++i)
+            _hist_data[i] += _hist_data[i - 1];
+        std::fill(_hist_data + std::max(bins, 1), _hist_data + MAX_DEPTH, bins > 1 ? _hist_data[bins - 1] : 0);
+
+        return max_depth;
+    }
+
+    void colorizer::update_equalized_lut(int max_depth)
+    {
+        auto cm = _maps[_map_index];
+        auto pixels = (float)_hist_data[MAX_DEPTH - 1];
+
+        // Only the values present in the frame are looked up; the others are left as they are
+        _lut[0] = 0;
+#pragma omp parallel for
+        for (int d = 1; d <= max_depth; ++d)
+        {
+            auto below = d > 1 ? _hist_data[d - 1] : 0;
+            if (_hist_data[d] != below)
+                _lut[d] = pack_rgb(cm->get(_hist_data[d] / pixels));
+        }
+        _lut_cropped = false;
+    }
+
+    void colorizer::update_cropped_lut()
+    {
+        if (_lut_cropped && _lut_min == _min && _lut_max == _max
+            && _lut_depth_units == _depth_units && _lut_map_index == _map_index)
+            return;
+
+        auto cm = _maps[_map_index];
+        auto min = _min;
+        auto max = _max;
+
+        _lut[0] = 0;
+#pragma omp parallel for
+        for (int d = 1; d < MAX_DEPTH; ++d)
+        {
+            auto f = min >= max ? 0.f : ((float)d * _depth_units - min) / (max - min);
+            _lut[d] = pack_rgb(cm->get(f));
+        }
+
+        _lut_cropped = true;
+        _lut_min = min;
+        _lut_max = max;
+        _lut_depth_units = _depth_units;
+        _lut_map_index = _map_index;
+    }
+
+    void colorizer::apply_lut(const uint16_t* depth_data, uint8_t* rgb_data, int width, int height)
+    {
+        // The pixels are independent, so the image is split into chunks that are colored in parallel
+        const int size = width * height;
+        const int chunk = 16 * 1024;
+        const int chunks = (size + chunk - 1) / chunk;
+        auto lut = _lut.data();
+#pragma omp parallel for
+        for (int c = 0; c < chunks; ++c)
+        {
+            const size_t first = size_t(c) * chunk;
+            const size_t count = std::min<size_t>(chunk, size - first);
+            auto depth = depth_data + first;
+            auto rgb = rgb_data + first * 3;
+
+            size_t done = 0;
+            if (_use_avx2)
+                done = colorize_avx2(depth, count, lut, rgb);
+            colorize_scalar(depth + done, count - done, lut, rgb + done * 3);
+        }
+    }
 }
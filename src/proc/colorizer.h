@@ -123,6 +123,13 @@ namespace librealsense {
         bool should_process(const rs2::frame& frame) override;
         rs2::frame process_frame(const rs2::frame_source& source, const rs2::frame& f) override;
 
+        // Faster Z16 path: the histogram is counted in parallel, and the color of each depth value
+        // is computed once into a lookup table, rather than per pixel
+        int build_histogram(const uint16_t* depth_data, int w, int h);
+        void update_equalized_lut(int max_depth);
+        void update_cropped_lut();
+        void apply_lut(const uint16_t* depth_data, uint8_t* rgb_data, int width, int height);
+
         template<typename T, typename F>
         void make_rgb_data(const T* depth_data, uint8_t* rgb_data, int width, int height, F coloring_func)
         {
@@ -161,6 +168,16 @@ namespace librealsense {
 
         std::vector<int> _histogram;
         int* _hist_data;
+        std::vector<int> _sub_histograms;
+
+        // Z16 value -> RGB, packed with R in the low byte
+        std::vector<uint32_t> _lut;
+        // The range and map the lookup table was computed for, when not equalizing. Equalized tables
+        // depend on the histogram, and are recomputed for every frame.
+        bool _lut_cropped = false;
+        float _lut_min = 0.f, _lut_max = 0.f, _lut_depth_units = 0.f;
+        int _lut_map_index = 0;
+        bool _use_avx2;
 
         int _preset = 0;
         rs2::stream_profile _target_stream_profile;
@@ -4,6 +4,7 @@
 #include "../include/librealsense2/hpp/rs_sensor.hpp"
 #include "../include/librealsense2/hpp/rs_processing.hpp"
 
+#include <algorithm>
 #include <numeric>
 #include <cmath>
 #include "environment.h"
@@ -12,6 +13,9 @@
 #include "core/video.h"
 #include "proc/synthetic-stream.h"
 #include "proc/decimation-filter.h"
+#include "proc/sse/sse-decimation-filter.h"
+#include "cpu-features.h"
+#include <librealsense2/utilities/concurrency/parallel-for.h>
 
 
 #define PIX_SORT(a,b) { if ((a)>(b)) PIX_SWAP((a),(b)); }
@@ -210,7 +214,8 @@ namespace librealsense
         _padded_width(0),
         _padded_height(0),
         _recalc_profile(false),
-        _options_changed(false)
+        _options_changed(false),
+        _use_avx2(cpu_has_avx2())
     {
         _stream_filter.stream = RS2_STREAM_DEPTH;
         _stream_filter.format = RS2_FORMAT_Z16;
@@ -357,127 +362,141 @@ namespace librealsense
     void decimation_filter::decimate_depth(const uint16_t * frame_data_in, uint16_t * frame_data_out,
         size_t width_in, size_t height_in, size_t scale)
     {
-        // Use median filtering
-        std::vector<uint16_t> working_kernel(_kernel_size);
-        auto wk_begin = working_kernel.data();
-        auto wk_itr = wk_begin;
-        std::vector<uint16_t*> pixel_raws(scale);
-        uint16_t* block_start = const_cast<uint16_t*>(frame_data_in);
+        const int real_height = _real_height;
+        const size_t real_width = _real_width;
 
+        // Output rows are computed independently of each other, and are spread across threads
         if (scale == 2 || scale == 3)
         {
-            for (int j = 0; j < _real_height; j++)
+            // Use median filtering
+            parallel_for(real_height, [&](size_t first_row, size_t end_row)
             {
-                uint16_t *p{};
-                // Mark the beginning of each of the N lines that the filter will run upon
-                for (size_t i = 0; i < pixel_raws.size(); i++)
-                    pixel_raws[i] = block_start + (width_in*i);
-
-                for (size_t i = 0, chunk_offset = 0; i < _real_width; i++)
+                for (int j = int(first_row); j < int(end_row); ++j)
                 {
-                    wk_itr = wk_begin;
-                    // extract data the kernel to process
-                    for (size_t n = 0; n < scale; ++n)
+                    const uint16_t* block_start = frame_data_in + j * width_in * scale;
+                    uint16_t* out = frame_data_out + j * _padded_width;
+
+                    // Whole blocks of pixels are vectorized, the remaining ones are handled below
+                    size_t i = 0;
+                    if (_use_avx2)
+                        i = decimate_depth_median_avx2(block_start, width_in, scale, real_width, out);
+                    i += decimate_depth_median_sse(block_start + i * scale, width_in, scale, real_width - i, out + i);
+
+                    uint16_t working_kernel[9];
+                    for (; i < real_width; i++)
                     {
-                        p = pixel_raws[n] + chunk_offset;
-                        for (size_t m = 0; m < scale; ++m)
+                        auto wk_itr = working_kernel;
+                        // extract data the kernel to process
+                        for (size_t n = 0; n < scale; ++n)
                         {
-                            if (*(p + m))
-                                *wk_itr++ = *(p + m);
+                            const uint16_t* p = block_start + width_in * n + i * scale;
+                            for (size_t m = 0; m < scale; ++m)
+                            {
+                                if (*(p + m))
+                                    *wk_itr++ = *(p + m);
+                            }
                         }
-                    }
 
-                    // For even-size kernels pick the member one below the middle
-                    auto ks = (int)(wk_itr - wk_begin);
-                    if (ks == 0)
-                        *frame_data_out++ = 0;
-                    else
-                    {
+                        // For even-size kernels pick the member one below the middle
+                        auto ks = (int)(wk_itr - working_kernel);
                         switch (ks)
                         {
+                        case 0:
+                            out[i] = 0;
+                            break;
                         case 1:
-                            *frame_data_out++ = working_kernel[0];
+                            out[i] = working_kernel[0];
                             break;
                         case 2:
-                            *frame_data_out++ = PIX_MIN(working_kernel[0], working_kernel[1]);
+                            out[i] = PIX_MIN(working_kernel[0], working_kernel[1]);
                             break;
                         case 3:
-                            *frame_data_out++ = opt_med3<uint16_t>(working_kernel.data());
+                            out[i] = opt_med3<uint16_t>(working_kernel);
                             break;
                         case 4:
-                            *frame_data_out++ = opt_med4<uint16_t>(working_kernel.data());
+                            out[i] = opt_med4<uint16_t>(working_kernel);
                             break;
                         case 5:
-                            *frame_data_out++ = opt_med5<uint16_t>(working_kernel.data());
+                            out[i] = opt_med5<uint16_t>(working_kernel);
                             break;
                         case 6:
-                            *frame_data_out++ = opt_med6<uint16_t>(working_kernel.data());
+                            out[i] = opt_med6<uint16_t>(working_kernel);
                             break;
                         case 7:
-                            *frame_data_out++ = opt_med7<uint16_t>(working_kernel.data());
+                            out[i] = opt_med7<uint16_t>(working_kernel);
                             break;
                         case 8:
-                            *frame_data_out++ = opt_med8<uint16_t>(working_kernel.data());
+                            out[i] = opt_med8<uint16_t>(working_kernel);
                             break;
                         case 9:
-                            *frame_data_out++ = opt_med9<uint16_t>(working_kernel.data());
+                            out[i] = opt_med9<uint16_t>(working_kernel);
                             break;
                         }
                     }
 
-                    chunk_offset += scale;
+                    // Fill-in the padded colums with zeros
+                    for (size_t u = real_width; u < _padded_width; u++)
+                        out[u] = 0;
                 }
-
-                // Fill-in the padded colums with zeros
-                for (int j = _real_width; j < _padded_width; j++)
-                    *frame_data_out++ = 0;
-
-                // Skip N lines to the beginnig of the next processing segment
-                block_start += width_in * scale;
-            }
+            });
         }
         else
         {
-            for (int j = 0; j < _real_height; j++)
+            // Mean of the valid pixels: no sorting, and the sums are accumulated down the columns of
+            // a stripe of the block first, over contiguous memory, so the compiler can vectorize them
+            const size_t stripe = 256;
+            parallel_for(real_height, [&](size_t first_row, size_t end_row)
             {
-                uint16_t *p{};
-                // Mark the beginning of each of the N lines that the filter will run upon
-                for (size_t i = 0; i < pixel_raws.size(); i++)
-                    pixel_raws[i] = block_start + (width_in*i);
-
-                for (size_t i = 0, chunk_offset = 0; i < _real_width; i++)
+                for (int j = int(first_row); j < int(end_row); ++j)
                 {
-                    int sum = 0;
-                    int counter = 0;
+                    const uint16_t* block_start = frame_data_in + j * width_in * scale;
+                    uint16_t* out = frame_data_out + j * _padded_width;
 
-                    // extract data the kernel to process
-                    for (size_t n = 0; n < scale; ++n)
+                    uint32_t sums[stripe];
+                    uint16_t counters[stripe];
+                    const size_t pixels_per_stripe = stripe / scale;
+                    for (size_t first = 0; first < real_width; first += pixels_per_stripe)
                     {
-                        p = pixel_raws[n] + chunk_offset;
-                        for (size_t m = 0; m < scale; ++m)
+                        const size_t count = std::min(pixels_per_stripe, real_width - first);
+                        const size_t columns = count * scale;
+                        const uint16_t* p = block_start + first * scale;
+
+                        for (size_t c = 0; c < columns; ++c)
                         {
-                            if (*(p + m))
+                            sums[c] = 0;
+                            counters[c] = 0;
+                        }
+                        for (size_t n = 0; n < scale; ++n, p += width_in)
+                        {
+                            for (size_t c = 0; c < columns; ++c)
                             {
-                                sum += p[m];
-                                ++counter;
+                                sums[c] += p[c];
+                                counters[c] += p[c] != 0;
                             }
                         }
+
+                        for (size_t i = 0; i < count; ++i)
+                        {
+                            int sum = 0;
+                            int counter = 0;
+                            for (size_t m = 0; m < scale; ++m)
+                            {
+                                sum += sums[i * scale + m];
+                                counter += counters[i * scale + m];
+                            }
+                            out[first + i] = (counter == 0 ? 0 : sum / counter);
+                        }
                     }
 
-                    *frame_data_out++ = (counter == 0 ? 0 : sum / counter);
-                    chunk_offset += scale;
+                    // Fill-in the padded colums with zeros
+                    for (size_t u = real_width; u < _padded_width; u++)
+                        out[u] = 0;
                 }
-
-                // Fill-in the padded colums with zeros
-                for (int j = _real_width; j < _padded_width; j++)
-                    *frame_data_out++ = 0;
-
-                // Skip N lines to the beginnig of the next processing segment
-                block_start += width_in * scale;
-            }
+            });
         }
 
         // Fill-in the padded rows with zeros
+        frame_data_out += real_height * _padded_width;
         for (auto v = _real_height; v < _padded_height; ++v)
         {
             for (auto u = 0; u < _padded_width; ++u)
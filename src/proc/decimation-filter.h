@@ -41,6 +41,7 @@ namespace librealsense
         uint16_t                _padded_height;
         bool                    _recalc_profile;
         bool                    _options_changed;   // Tracking changes imposed by user
+        bool                    _use_avx2;
     };
     MAP_EXTENSION(RS2_EXTENSION_DECIMATION_FILTER, librealsense::decimation_filter);
 }
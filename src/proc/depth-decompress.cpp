@@ -2,8 +2,8 @@
 // Copyright(c) 2019 Intel Corporation. All Rights Reserved.
 
 #include <fstream>
-#include "../common/decompress-huffman.h"
 #include "proc/depth-decompress.h"
+#include "proc/huffman-decoder.h"
 #include "environment.h"
 
 namespace librealsense
@@ -17,7 +17,7 @@ namespace librealsense
 
     void depth_decompression_huffman::process_function(byte* const dest[], const byte* source, int width, int height, int actual_size, int input_size)
     {
-        if (!unhuffimage4(reinterpret_cast<uint32_t*>(const_cast<byte*>(source)), uint32_t(input_size >> 2), width << 1, height, const_cast<byte*>(*dest)))
+        if (!decompress_huffman_depth(reinterpret_cast<const uint32_t*>(source), uint32_t(input_size >> 2), width << 1, height, dest[0]))
         {
             LOG_INFO("Depth decompression failed, ts: " << static_cast<uint64_t>(environment::get_instance().get_time_service()->get_time())
                         << " , compressed size: " << input_size);
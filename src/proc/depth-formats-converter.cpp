@@ -4,6 +4,7 @@
 #include "depth-formats-converter.h"
 
 #include "stream.h"
+#include "format-converter-kernels.h"
 
 #ifdef RS2_USE_CUDA
 #include "cuda/cuda-conversion.cuh"
@@ -14,29 +15,31 @@ namespace librealsense
     void unpack_z16_y8_from_sr300_inzi(byte * const dest[], const byte * source, int width, int height, int actual_size)
     {
         auto count = width * height;
+#ifdef RS2_USE_CUDA
         auto in = reinterpret_cast<const uint16_t*>(source);
         auto out_ir = reinterpret_cast<uint8_t *>(dest[1]);
-#ifdef RS2_USE_CUDA
         rscuda::unpack_z16_y8_from_sr300_inzi_cuda(out_ir, in, count);
         in += count;
+        librealsense::copy(dest[0], in, count * 2);
 #else
-        for (int i = 0; i < count; ++i) *out_ir++ = *in++ >> 2;
+        static auto unpack = get_format_converter_kernel(RS2_FORMAT_INZI, RS2_FORMAT_Y8);
+        unpack(dest, source, count);
 #endif
-        librealsense::copy(dest[0], in, count * 2);
     }
 
     void unpack_z16_y16_from_sr300_inzi(byte * const dest[], const byte * source, int width, int height, int actual_size)
     {
         auto count = width * height;
+#ifdef RS2_USE_CUDA
         auto in = reinterpret_cast<const uint16_t*>(source);
         auto out_ir = reinterpret_cast<uint16_t*>(dest[1]);
-#ifdef RS2_USE_CUDA
         rscuda::unpack_z16_y16_from_sr300_inzi_cuda(out_ir, in, count);
         in += count;
+        librealsense::copy(dest[0], in, count * 2);
 #else
-        for (int i = 0; i < count; ++i) *out_ir++ = *in++ << 6;
+        static auto unpack = get_format_converter_kernel(RS2_FORMAT_INZI, RS2_FORMAT_Y16);
+        unpack(dest, source, count);
 #endif
-        librealsense::copy(dest[0], in, count * 2);
     }
 
     void unpack_inzi(rs2_format dst_ir_format, byte * const d[], const byte * s, int width, int height, int actual_size)
@@ -55,14 +58,17 @@ namespace librealsense
         }
     }
 
-    template<class SOURCE, class UNPACK> void unpack_pixels(byte * const dest[], int count, const SOURCE * source, UNPACK unpack, int actual_size)
+    void unpack_y16_from_y16_10(byte * const d[], const byte * s, int width, int height, int actual_size)
     {
-        auto out = reinterpret_cast<decltype(unpack(SOURCE())) *>(dest[0]);
-        for (int i = 0; i < count; ++i) *out++ = unpack(*source++);
+        static auto unpack = get_format_converter_kernel(RS2_FORMAT_INVI, RS2_FORMAT_Y16);
+        unpack(d, s, width * height);
     }
 
-    void unpack_y16_from_y16_10(byte * const d[], const byte * s, int width, int height, int actual_size) { unpack_pixels(d, width * height, reinterpret_cast<const uint16_t*>(s), [](uint16_t pixel) -> uint16_t { return pixel << 6; }, actual_size); }
-    void unpack_y8_from_y16_10(byte * const d[], const byte * s, int width, int height, int actual_size) { unpack_pixels(d, width * height, reinterpret_cast<const uint16_t*>(s), [](uint16_t pixel) -> uint8_t { return pixel >> 2; }, actual_size); }
+    void unpack_y8_from_y16_10(byte * const d[], const byte * s, int width, int height, int actual_size)
+    {
+        static auto unpack = get_format_converter_kernel(RS2_FORMAT_INVI, RS2_FORMAT_Y8);
+        unpack(d, s, width * height);
+    }
 
     void unpack_invi(rs2_format dst_format, byte * const d[], const byte * s, int width, int height, int actual_size)
     {
@@ -88,18 +94,9 @@ namespace librealsense
 
     void unpack_y10bpack(byte * const dest[], const byte * source, int width, int height, int actual_size)
     {
-        auto count = width * height / 4; // num of pixels
-        uint8_t  * from = (uint8_t*)(source);
-        uint16_t * to = (uint16_t*)(dest[0]);
-
         // Put the 10 bit into the msb of uint16_t
-        for (int i = 0; i < count; i++, from += 5) // traverse macro-pixels
-        {
-            *to++ = ((from[0] << 2) | (from[4] & 3)) << 6;
-            *to++ = ((from[1] << 2) | ((from[4] >> 2) & 3)) << 6;
-            *to++ = ((from[2] << 2) | ((from[4] >> 4) & 3)) << 6;
-            *to++ = ((from[3] << 2) | ((from[4] >> 6) & 3)) << 6;
-        }
+        static auto unpack = get_format_converter_kernel(RS2_FORMAT_W10, RS2_FORMAT_Y10BPACK);
+        unpack(dest, source, width * height);
     }
 
     void unpack_w10(rs2_format dst_format, byte * const d[], const byte * s, int width, int height, int actual_size)
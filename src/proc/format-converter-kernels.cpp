@@ -0,0 +1,260 @@
+// License: Apache 2.0. See LICENSE file in root directory.
+// Copyright(c) 2021 Intel Corporation. All Rights Reserved.
+
+#include "format-converter-kernels.h"
+#include "sse/sse-format-converters.h"
+#include "../cpu-features.h"
+
+#include <algorithm>
+#include <cstring>
+
+namespace librealsense
+{
+    namespace
+    {
+        // The scalar code converts the pixels from 'begin' on, so it also finishes what the
+        // vectorized kernels (which return how many pixels they converted) left
+        typedef void (*scalar_kernel)(uint8_t * const dest[], const uint8_t * source, size_t begin, size_t count);
+        typedef size_t (*simd_kernel)(uint8_t * const dest[], const uint8_t * source, size_t count);
+
+        template<scalar_kernel SCALAR>
+        void scalar_only(uint8_t * const dest[], const uint8_t * source, size_t count)
+        {
+            SCALAR(dest, source, 0, count);
+        }
+
+        template<simd_kernel SIMD, scalar_kernel SCALAR>
+        void simd_then_scalar(uint8_t * const dest[], const uint8_t * source, size_t count)
+        {
+            SCALAR(dest, source, SIMD(dest, source, count), count);
+        }
+
+        template<class T> T * plane(uint8_t * const dest[], int i) { return reinterpret_cast<T *>(dest[i]); }
+        template<class T> const T * pixels(const uint8_t * source) { return reinterpret_cast<const T *>(source); }
+
+        // Y8I to Y8 (left) and Y8 (right)
+        void split_y8i(uint8_t * const dest[], const uint8_t * source, size_t begin, size_t count)
+        {
+            for (size_t i = begin; i < count; ++i)
+            {
+                dest[0][i] = source[i * 2];
+                dest[1][i] = source[i * 2 + 1];
+            }
+        }
+
+        template<size_t (*KERNEL)(const uint8_t *, size_t, uint8_t *, uint8_t *)>
+        size_t split_y8i(uint8_t * const dest[], const uint8_t * source, size_t count)
+        {
+            return KERNEL(source, count, dest[0], dest[1]);
+        }
+
+        // Y16I to Y16 (left) and Y16 (right): the 10 bits of data are moved to the MSBs, which
+        // OpenGL uses
+        void split_y16i(uint8_t * const dest[], const uint8_t * source, size_t begin, size_t count)
+        {
+            auto in = pixels<uint16_t>(source);
+            auto left = plane<uint16_t>(dest, 0);
+            auto right = plane<uint16_t>(dest, 1);
+            for (size_t i = begin; i < count; ++i)
+            {
+                left[i] = uint16_t(in[i * 2] << 6);
+                right[i] = uint16_t(in[i * 2 + 1] << 6);
+            }
+        }
+
+        template<size_t (*KERNEL)(const uint16_t *, size_t, uint16_t *, uint16_t *)>
+        size_t split_y16i(uint8_t * const dest[], const uint8_t * source, size_t count)
+        {
+            return KERNEL(pixels<uint16_t>(source), count, plane<uint16_t>(dest, 0), plane<uint16_t>(dest, 1));
+        }
+
+        // Y12I to Y16 (left) and Y16 (right). The pixels are 3 bytes: the right 8 LSBs, the right
+        // 4 MSBs with the left 4 LSBs above them, then the left 8 MSBs. Values are multiplied by
+        // 64 1/16 to efficiently approximate 65535/1023 (the data is 10-bit).
+        void split_y12i(uint8_t * const dest[], const uint8_t * source, size_t begin, size_t count)
+        {
+            auto left = plane<uint16_t>(dest, 0);
+            auto right = plane<uint16_t>(dest, 1);
+            for (size_t i = begin; i < count; ++i)
+            {
+                auto p = source + i * 3;
+                int l = p[2] << 4 | p[1] >> 4;
+                int r = (p[1] & 0xf) << 8 | p[0];
+                left[i] = uint16_t(l << 6 | l >> 4);
+                right[i] = uint16_t(r << 6 | r >> 4);
+            }
+        }
+
+        template<size_t (*KERNEL)(const uint8_t *, size_t, uint16_t *, uint16_t *)>
+        size_t split_y12i(uint8_t * const dest[], const uint8_t * source, size_t count)
+        {
+            return KERNEL(source, count, plane<uint16_t>(dest, 0), plane<uint16_t>(dest, 1));
+        }
+
+        // INVI to Y8 or Y16, from 10 bits in 16
+        void y10_to_y8(uint8_t * const dest[], const uint8_t * source, size_t begin, size_t count)
+        {
+            auto in = pixels<uint16_t>(source);
+            for (size_t i = begin; i < count; ++i)
+                dest[0][i] = uint8_t(in[i] >> 2);
+        }
+
+        void y10_to_y16(uint8_t * const dest[], const uint8_t * source, size_t begin, size_t count)
+        {
+            auto in = pixels<uint16_t>(source);
+            auto out = plane<uint16_t>(dest, 0);
+            for (size_t i = begin; i < count; ++i)
+                out[i] = uint16_t(in[i] << 6);
+        }
+
+        template<size_t (*KERNEL)(const uint16_t *, size_t, uint8_t *)>
+        size_t y10_to_y8(uint8_t * const dest[], const uint8_t * source, size_t count)
+        {
+            return KERNEL(pixels<uint16_t>(source), count, dest[0]);
+        }
+
+        template<size_t (*KERNEL)(const uint16_t *, size_t, uint16_t *)>
+        size_t y10_to_y16(uint8_t * const dest[], const uint8_t * source, size_t count)
+        {
+            return KERNEL(pixels<uint16_t>(source), count, plane<uint16_t>(dest, 0));
+        }
+
+        // INZI to Z16 and Y8 or Y16: all the IR pixels, converted as INVI, then all the depth
+        // pixels, copied
+        void copy_inzi_depth(uint8_t * const dest[], const uint8_t * source, size_t begin, size_t end, size_t count)
+        {
+            memcpy(dest[0] + begin * 2, source + (count + begin) * 2, (end - begin) * 2);
+        }
+
+        template<scalar_kernel IR>
+        void unpack_inzi(uint8_t * const dest[], const uint8_t * source, size_t begin, size_t count)
+        {
+            uint8_t * const ir[] = { dest[1] };
+            IR(ir, source, begin, count);
+            copy_inzi_depth(dest, source, begin, count, count);
+        }
+
+        template<simd_kernel IR>
+        size_t unpack_inzi(uint8_t * const dest[], const uint8_t * source, size_t count)
+        {
+            uint8_t * const ir[] = { dest[1] };
+            auto done = IR(ir, source, count);
+            copy_inzi_depth(dest, source, 0, done, count);
+            return done;
+        }
+
+        // W10 to Y10BPACK: groups of 4 pixels are packed in 5 bytes, their 8 MSBs then their 2 LSBs.
+        // The 10 bits are moved to the MSBs of 16.
+        void unpack_y10bpack(uint8_t * const dest[], const uint8_t * source, size_t begin, size_t count)
+        {
+            auto out = plane<uint16_t>(dest, 0);
+            for (size_t g = begin / 4; g < count / 4; ++g)
+            {
+                auto from = source + g * 5;
+                for (int k = 0; k < 4; ++k)
+                    out[g * 4 + k] = uint16_t(((from[k] << 2) | ((from[4] >> (2 * k)) & 3)) << 6);
+            }
+        }
+
+        template<size_t (*KERNEL)(const uint8_t *, size_t, uint16_t *)>
+        size_t unpack_y10bpack(uint8_t * const dest[], const uint8_t * source, size_t count)
+        {
+            return KERNEL(source, count, plane<uint16_t>(dest, 0));
+        }
+
+        // BGR8 to RGB8
+        void bgr_to_rgb(uint8_t * const dest[], const uint8_t * source, size_t begin, size_t count)
+        {
+            for (size_t i = begin; i < count; ++i)
+            {
+                dest[0][i * 3] = source[i * 3 + 2];
+                dest[0][i * 3 + 1] = source[i * 3 + 1];
+                dest[0][i * 3 + 2] = source[i * 3];
+            }
+        }
+
+        template<size_t (*KERNEL)(const uint8_t *, size_t, uint8_t *)>
+        size_t bgr_to_rgb(uint8_t * const dest[], const uint8_t * source, size_t count)
+        {
+            return KERNEL(source, count, dest[0]);
+        }
+
+        bool cpu_supports(simd_isa isa)
+        {
+            switch (isa)
+            {
+#ifdef __SSSE3__
+            case simd_isa::ssse3: return true;
+#endif
+            case simd_isa::avx2: return cpu_has_avx2();
+            default: return isa == simd_isa::scalar;
+            }
+        }
+    }
+
+    const std::vector< format_converter_kernel_info > & get_format_converter_kernels()
+    {
+        static const std::vector< format_converter_kernel_info > kernels = {
+            { RS2_FORMAT_Y8I, RS2_FORMAT_Y8, simd_isa::scalar, scalar_only<split_y8i> },
+            { RS2_FORMAT_Y8I, RS2_FORMAT_Y8, simd_isa::ssse3, simd_then_scalar<split_y8i<split_y8i_sse>, split_y8i> },
+            { RS2_FORMAT_Y8I, RS2_FORMAT_Y8, simd_isa::avx2, simd_then_scalar<split_y8i<split_y8i_avx2>, split_y8i> },
+
+            { RS2_FORMAT_Y16I, RS2_FORMAT_Y16, simd_isa::scalar, scalar_only<split_y16i> },
+            { RS2_FORMAT_Y16I, RS2_FORMAT_Y16, simd_isa::ssse3, simd_then_scalar<split_y16i<split_y16i_sse>, split_y16i> },
+            { RS2_FORMAT_Y16I, RS2_FORMAT_Y16, simd_isa::avx2, simd_then_scalar<split_y16i<split_y16i_avx2>, split_y16i> },
+
+            { RS2_FORMAT_Y12I, RS2_FORMAT_Y16, simd_isa::scalar, scalar_only<split_y12i> },
+            { RS2_FORMAT_Y12I, RS2_FORMAT_Y16, simd_isa::ssse3, simd_then_scalar<split_y12i<split_y12i_sse>, split_y12i> },
+
+            { RS2_FORMAT_INVI, RS2_FORMAT_Y8, simd_isa::scalar, scalar_only<y10_to_y8> },
+            { RS2_FORMAT_INVI, RS2_FORMAT_Y8, simd_isa::ssse3, simd_then_scalar<y10_to_y8<y10_to_y8_sse>, y10_to_y8> },
+            { RS2_FORMAT_INVI, RS2_FORMAT_Y8, simd_isa::avx2, simd_then_scalar<y10_to_y8<y10_to_y8_avx2>, y10_to_y8> },
+
+            { RS2_FORMAT_INVI, RS2_FORMAT_Y16, simd_isa::scalar, scalar_only<y10_to_y16> },
+            { RS2_FORMAT_INVI, RS2_FORMAT_Y16, simd_isa::ssse3, simd_then_scalar<y10_to_y16<y10_to_y16_sse>, y10_to_y16> },
+            { RS2_FORMAT_INVI, RS2_FORMAT_Y16, simd_isa::avx2, simd_then_scalar<y10_to_y16<y10_to_y16_avx2>, y10_to_y16> },
+
+            { RS2_FORMAT_INZI, RS2_FORMAT_Y8, simd_isa::scalar, scalar_only<unpack_inzi<y10_to_y8>> },
+            { RS2_FORMAT_INZI, RS2_FORMAT_Y8, simd_isa::ssse3, simd_then_scalar<unpack_inzi<y10_to_y8<y10_to_y8_sse>>, unpack_inzi<y10_to_y8>> },
+            { RS2_FORMAT_INZI, RS2_FORMAT_Y8, simd_isa::avx2, simd_then_scalar<unpack_inzi<y10_to_y8<y10_to_y8_avx2>>, unpack_inzi<y10_to_y8>> },
+
+            { RS2_FORMAT_INZI, RS2_FORMAT_Y16, simd_isa::scalar, scalar_only<unpack_inzi<y10_to_y16>> },
+            { RS2_FORMAT_INZI, RS2_FORMAT_Y16, simd_isa::ssse3, simd_then_scalar<unpack_inzi<y10_to_y16<y10_to_y16_sse>>, unpack_inzi<y10_to_y16>> },
+            { RS2_FORMAT_INZI, RS2_FORMAT_Y16, simd_isa::avx2, simd_then_scalar<unpack_inzi<y10_to_y16<y10_to_y16_avx2>>, unpack_inzi<y10_to_y16>> },
+
+            { RS2_FORMAT_W10, RS2_FORMAT_Y10BPACK, simd_isa::scalar, scalar_only<unpack_y10bpack> },
+            { RS2_FORMAT_W10, RS2_FORMAT_Y10BPACK, simd_isa::ssse3, simd_then_scalar<unpack_y10bpack<unpack_y10bpack_sse>, unpack_y10bpack> },
+            { RS2_FORMAT_W10, RS2_FORMAT_Y10BPACK, simd_isa::avx2, simd_then_scalar<unpack_y10bpack<unpack_y10bpack_avx2>, unpack_y10bpack> },
+
+            { RS2_FORMAT_BGR8, RS2_FORMAT_RGB8, simd_isa::scalar, scalar_only<bgr_to_rgb> },
+            { RS2_FORMAT_BGR8, RS2_FORMAT_RGB8, simd_isa::ssse3, simd_then_scalar<bgr_to_rgb<bgr_to_rgb_sse>, bgr_to_rgb> },
+        };
+        return kernels;
+    }
+
+    format_converter_kernel get_format_converter_kernel(rs2_format source, rs2_format target)
+    {
+        // The best kernel of every pair is chosen on the first call
+        static const std::vector< format_converter_kernel_info > best = [] {
+            std::vector< format_converter_kernel_info > best;
+            for (auto && k : get_format_converter_kernels())
+            {
+                if (!cpu_supports(k.isa))
+                    continue;
+                auto it = std::find_if(best.begin(), best.end(), [&](const format_converter_kernel_info & b) {
+                    return b.source == k.source && b.target == k.target;
+                });
+                if (it == best.end())
+                    best.push_back(k);
+                else if (k.isa > it->isa)
+                    *it = k;
+            }
+            return best;
+        }();
+
+        for (auto && k : best)
+            if (k.source == source && k.target == target)
+                return k.kernel;
+        return nullptr;
+    }
+}
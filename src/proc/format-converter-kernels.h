@@ -0,0 +1,38 @@
+// License: Apache 2.0. See LICENSE file in root directory.
+// Copyright(c) 2021 Intel Corporation. All Rights Reserved.
+
+#pragma once
+
+#include <librealsense2/h/rs_sensor.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace librealsense
+{
+    // The instruction sets the kernels of the format converters are built for, from the least to
+    // the most capable. SSSE3 is what the library itself is built for on x86.
+    enum class simd_isa { scalar, ssse3, avx2 };
+
+    // Converts all the 'count' pixels of a frame of the source format into the output planes of
+    // its converter: 'dest' has two planes for the formats that interleave two streams (the IR
+    // plane comes second for INZI).
+    typedef void (*format_converter_kernel)(uint8_t * const dest[], const uint8_t * source, size_t count);
+
+    struct format_converter_kernel_info
+    {
+        rs2_format source;
+        rs2_format target;
+        simd_isa isa;
+        format_converter_kernel kernel;
+    };
+
+    // Every kernel, keyed by (source, target, isa). Each pair has a scalar kernel, the reference the
+    // others must match exactly.
+    const std::vector< format_converter_kernel_info > & get_format_converter_kernels();
+
+    // The kernel for the most capable instruction set the CPU supports, looked up once per pair;
+    // null when the pair has no kernel
+    format_converter_kernel get_format_converter_kernel(rs2_format source, rs2_format target);
+}
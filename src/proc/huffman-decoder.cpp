@@ -0,0 +1,205 @@
+// License: Apache 2.0. See LICENSE file in root directory.
+// Copyright(c) 2021 Intel Corporation. All Rights Reserved.
+
+#include "huffman-decoder.h"
+#include "../common/decompress-huffman.h"
+#include <librealsense2/utilities/concurrency/parallel-for.h>
+
+#include <algorithm>
+#include <cstring>
+#include <vector>
+
+namespace librealsense
+{
+    namespace
+    {
+        // An entry of DecompressionStateTable, the step of the state machine for one nibble in one
+        // state: bit 3 tells whether it decodes a byte, bits 24-31 hold that byte, bits 0-2 how many
+        // unchanged bytes follow it, and bits 6-14 the next state.
+        inline uint32_t nibble_step(uint32_t state, uint32_t nibble)
+        {
+            return uint32_t(DecompressionStateTable[state * 16 + nibble]);
+        }
+
+        inline uint32_t next_state(uint32_t step) { return (step >> 6) & 0x1ff; }
+        inline uint32_t decoded_byte(uint32_t step) { return (step & 0x8) ? step >> 24 : 0; }
+        inline uint32_t decoded_length(uint32_t step) { return (step & 0x8) ? 1 + (step & 0x7) : 0; }
+
+        const uint32_t states = sizeof(DecompressionStateTable) / sizeof(DecompressionStateTable[0]) / 16;
+
+        // The steps for a whole byte of compressed data in each state: the byte decoded by each of
+        // the two nibbles in bits 0-7 and 8-15, the number of bytes they output in bits 16-19 and
+        // 20-23, and the index of the next state's first entry in bits 32-63
+        std::vector<uint64_t> make_byte_steps()
+        {
+            std::vector<uint64_t> table(states * 256);
+            for (uint32_t s = 0; s < states; ++s)
+                for (uint32_t b = 0; b < 256; ++b)
+                {
+                    auto hi = nibble_step(s, b >> 4);
+                    auto lo = nibble_step(next_state(hi), b & 0xf);
+                    table[s * 256 + b] = uint64_t(decoded_byte(hi)) | uint64_t(decoded_byte(lo)) << 8
+                                       | uint64_t(decoded_length(hi)) << 16 | uint64_t(decoded_length(lo)) << 20
+                                       | uint64_t(next_state(lo) * 256) << 32;
+                }
+            return table;
+        }
+
+        const uint64_t* byte_steps()
+        {
+            static const std::vector<uint64_t> table = make_byte_steps();
+            return table.data();
+        }
+
+        // Writes the decoded byte followed by zeros; only the first 'length' bytes are kept, the
+        // others are overwritten by the next output
+        inline void write_run(uint8_t*& out, uint64_t byte, uint32_t length)
+        {
+            memcpy(out, &byte, sizeof(byte));
+            out += length;
+        }
+
+        // The end of the stream is decoded nibble by nibble the same way as unhuffimage4(), so the
+        // same data is accepted or rejected: it checks for the end of the image only in its last 32
+        // bytes, and skips part of the checks on the last compressed word.
+        class tail_decoder
+        {
+        public:
+            tail_decoder(uint8_t* out, uint8_t* image_end, uint32_t step)
+                : _out(out), _image_end(image_end), _step(step) {}
+
+            uint8_t* out() const { return _out; }
+
+            // Executes the pending step, then looks up the one for the next nibble
+            void next(uint32_t nibble, const uint8_t* bound)
+            {
+                auto following = nibble_step(next_state(_step), nibble);
+                if (_step & 0x8)
+                {
+                    put(uint8_t(_step >> 24));
+                    for (uint32_t i = 0; i < (_step & 0x7) && _out < bound; ++i)
+                        put(0);
+                }
+                _step = following;
+            }
+
+            void next_unchecked(uint32_t nibble)
+            {
+                next(nibble, _out + 8);
+            }
+
+        private:
+            // unhuffimage4() may write past the end of a corrupt image; only the position is kept then
+            void put(uint8_t byte)
+            {
+                if (_out < _image_end)
+                    *_out = byte;
+                ++_out;
+            }
+
+            uint8_t* _out;
+            uint8_t* _image_end;
+            uint32_t _step;
+        };
+
+        // Adds the byte above to each byte of the image, below the first line
+        void add_lines_above(uint8_t* image, uint32_t stride_bytes, uint32_t height)
+        {
+            const size_t strip = 256;
+            const size_t strips = (stride_bytes + strip - 1) / strip;
+            parallel_for(strips, [&](size_t first_strip, size_t end_strip)
+            {
+                auto begin = first_strip * strip;
+                auto width = std::min(end_strip * strip, size_t(stride_bytes)) - begin;
+                for (uint32_t y = 1; y < height; ++y)
+                {
+                    auto line = image + size_t(y) * stride_bytes + begin;
+                    auto above = line - stride_bytes;
+                    for (size_t x = 0; x < width; ++x)
+                        line[x] = uint8_t(line[x] + above[x]);
+                }
+            });
+        }
+    }
+
+    bool decompress_huffman_depth(const uint32_t* compressed, uint32_t compressed_length_u32s,
+                                  uint32_t stride_bytes, uint32_t height, uint8_t* image)
+    {
+        const uint32_t first_line_words = (stride_bytes + 3) >> 2;
+        if (height < 2 || compressed_length_u32s <= first_line_words)
+            return false;
+
+        memcpy(image, compressed, stride_bytes);
+        auto word = compressed + first_line_words;
+        auto lim = compressed + compressed_length_u32s;
+        auto out = image + stride_bytes;
+        auto image_end = image + size_t(stride_bytes) * height;
+
+        // A word decodes to at most 64 bytes, and the stores write up to 8 bytes past the end of the
+        // output. Words are decoded here while that stays clear of the last 32 bytes of the image,
+        // where unhuffimage4() starts checking, and the last word is left for the tail.
+        auto steps = byte_steps();
+        uint64_t state = 0;
+        auto fast_end = image_end - std::min<size_t>(image_end - out, 32 + 64 + 8);
+        while (out < fast_end && lim - word > 1)
+        {
+            uint32_t w = *word++;
+            for (int shift = 24; shift >= 0; shift -= 8)
+            {
+                auto step = steps[state + ((w >> shift) & 0xff)];
+                write_run(out, step & 0xff, (step >> 16) & 0xf);
+                write_run(out, (step >> 8) & 0xff, (step >> 20) & 0xf);
+                state = step >> 32;
+            }
+        }
+
+        // The rest as in unhuffimage4(), which has the step for the first nibble of a word looked
+        // up but not executed at the start of each iteration
+        uint32_t w = *word++;
+        tail_decoder tail(out, image_end, nibble_step(uint32_t(state / 256), w >> 28));
+        uint8_t* end = image_end - 32;
+        bool done = false;
+        while (tail.out() < end)
+        {
+            for (int shift = 24; shift >= 4; shift -= 4)
+                tail.next_unchecked((w >> shift) & 0xf);
+            if (word >= lim)
+            {
+                end += 32;
+                tail.next(w & 0xf, end);
+                tail.next(w & 0xf, end);
+                done = true;
+                break;
+            }
+            auto last = w & 0xf;
+            w = *word++;
+            tail.next_unchecked(last);
+            tail.next_unchecked(w >> 28);
+        }
+        if (!done)
+        {
+            end += 32;
+            while (tail.out() < end && word <= lim && !done)
+            {
+                for (int shift = 24; shift >= 0 && tail.out() < end; shift -= 4)
+                    tail.next((w >> shift) & 0xf, end);
+                if (tail.out() < end)
+                {
+                    if (word == lim)
+                    {
+                        tail.next(w & 0xf, end);
+                        done = true;
+                    }
+                    else
+                    {
+                        w = *word++;
+                        tail.next(w >> 28, end);
+                    }
+                }
+            }
+        }
+
+        add_lines_above(image, stride_bytes, height);
+        return word == lim && tail.out() == end;
+    }
+}
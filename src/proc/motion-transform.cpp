@@ -79,12 +79,43 @@ namespace librealsense
 
     rs2::frame motion_transform::process_frame(const rs2::frame_source& source, const rs2::frame& f)
     {
+        auto mf = dynamic_cast<motion_frame*>((frame_interface*)f.get());
+        if (mf && mf->is_batched())
+            return process_batch(source, f, *mf);
+
         auto&& ret = functional_processing_block::process_frame(source, f);
         correct_motion(&ret);
 
         return ret;
     }
 
+    // The samples are converted into a batch of the same count, the values of which are contiguous
+    // float3s. That is never bigger than the source batch, the frame of which is the same size.
+    rs2::frame motion_transform::process_batch(const rs2::frame_source& source, const rs2::frame& f, const motion_frame& batch)
+    {
+        const int samples = batch.get_sample_count();
+        const int stride = batch.get_sample_stride();
+        if (stride < int(sizeof(float3)))
+            throw invalid_value_exception(to_string() << "Motion samples of " << stride << " bytes are too small to convert");
+
+        auto&& ret = prepare_frame(source, f);
+        auto out = dynamic_cast<motion_frame*>((frame_interface*)ret.get());
+        auto dest = const_cast<byte*>(out->get_frame_data());
+        auto src = batch.get_frame_data();
+        const auto stream_type = ret.get_profile().stream_type();
+
+        for (int i = 0; i < samples; ++i)
+        {
+            byte* planes[1] = { dest + i * sizeof(float3) };
+            process_function(planes, src + i * stride, 0, 0, 0, 0);
+            correct_motion_helper(reinterpret_cast<float3*>(planes[0]), stream_type);
+        }
+        memcpy(dest + motion_frame::timestamps_offset(samples, sizeof(float3)), batch.get_sample_timestamps(), samples * sizeof(rs2_time_t));
+        out->assign_samples(samples, sizeof(float3));
+
+        return ret;
+    }
+
     void motion_transform::correct_motion_helper(float3* xyz, rs2_stream stream_type) const
     {
         // The IMU sensor orientation shall be aligned with depth sensor's coordinate system
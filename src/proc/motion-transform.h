@@ -9,6 +9,7 @@ namespace librealsense
     class enable_motion_correction;
     class mm_calib_handler;
     class functional_processing_block;
+    class motion_frame;
 
     class motion_transform : public functional_processing_block
     {
@@ -22,6 +23,7 @@ namespace librealsense
             std::shared_ptr<mm_calib_handler> mm_calib,
             std::shared_ptr<enable_motion_correction> mm_correct_opt);
         rs2::frame process_frame(const rs2::frame_source& source, const rs2::frame& f) override;
+        rs2::frame process_batch(const rs2::frame_source& source, const rs2::frame& f, const motion_frame& batch);
 
     protected:
         void correct_motion(rs2::frame* f) const;
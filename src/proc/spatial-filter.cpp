@@ -10,6 +10,8 @@
 #include "proc/synthetic-stream.h"
 #include "proc/hole-filling-filter.h"
 #include "proc/spatial-filter.h"
+#include "proc/sse/sse-spatial-filter.h"
+#include "cpu-features.h"
 
 namespace librealsense
 {
@@ -60,7 +62,8 @@ namespace librealsense
         _focal_lenght_mm(0.f),
         _stereo_baseline_mm(0.f),
         _holes_filling_mode(holes_fill_def),
-        _holes_filling_radius(0)
+        _holes_filling_radius(0),
+        _use_avx2(cpu_has_avx2())
     {
         _stream_filter.stream = RS2_STREAM_DEPTH;
         _stream_filter.format = RS2_FORMAT_Z16;
@@ -226,262 +229,166 @@ namespace librealsense
         return tgt;
     }
 
+    size_t spatial_filter::recursive_filter_vertical_simd(uint16_t * image, float alpha, uint16_t delta_z)
+    {
+        if (_use_avx2)
+            return spatial_filter_vertical_avx2(image, _width, _height, alpha, delta_z);
+        return spatial_filter_vertical_sse(image, _width, _height, alpha, delta_z);
+    }
+
+    size_t spatial_filter::recursive_filter_vertical_simd(float * image, float alpha, float delta_z)
+    {
+        if (_use_avx2)
+            return spatial_filter_vertical_avx2(image, _width, _height, alpha, delta_z);
+        return spatial_filter_vertical_sse(image, _width, _height, alpha, delta_z);
+    }
+
+    // Rows are filtered independently of each other, and are spread across threads
     void spatial_filter::recursive_filter_horizontal_fp(void * image_data, float alpha, float deltaZ)
     {
         float *image = reinterpret_cast<float*>(image_data);
+        const int height = int(_height);
+
+        parallel_for(height, [&](size_t first_row, size_t end_row)
+        {
+            for (int v = int(first_row); v < int(end_row); ++v)
+            {
+                int u;
 
-        int v, u;
-
-        for (v = 0; v < _height;) {
-            // left to right
-            float *im = image + v * _width;
-            float state = *im;
-            float previousInnovation = state;
-
-            im++;
-            float innovation = *im;
-            u = int(_width) - 1;
-            if (!(*(int*)&previousInnovation > 0))
-                goto CurrentlyInvalidLR;
-            // else fall through
-
-        CurrentlyValidLR:
-            for (;;) {
-                if (*(int*)&innovation > 0) {
-                    float delta = previousInnovation - innovation;
-                    bool smallDifference = delta < deltaZ && delta > -deltaZ;
-
-                    if (smallDifference) {
-                        float filtered = innovation * alpha + state * (1.0f - alpha);
-                        *im = state = filtered;
+                // left to right
+                float *im = image + v * _width;
+                float state = *im;
+                float previousInnovation = state;
+
+                im++;
+                float innovation = *im;
+                u = int(_width) - 1;
+                if (!(*(int*)&previousInnovation > 0))
+                    goto CurrentlyInvalidLR;
+                // else fall through
+
+            CurrentlyValidLR:
+                for (;;) {
+                    if (*(int*)&innovation > 0) {
+                        float delta = previousInnovation - innovation;
+                        bool smallDifference = delta < deltaZ && delta > -deltaZ;
+
+                        if (smallDifference) {
+                            float filtered = innovation * alpha + state * (1.0f - alpha);
+                            *im = state = filtered;
+                        }
+                        else {
+                            state = innovation;
+                        }
+                        u--;
+                        if (u <= 0)
+                            goto DoneLR;
+                        previousInnovation = innovation;
+                        im += 1;
+                        innovation = *im;
                     }
-                    else {
-                        state = innovation;
+                    else {  // switch to CurrentlyInvalid state
+                        u--;
+                        if (u <= 0)
+                            goto DoneLR;
+                        previousInnovation = innovation;
+                        im += 1;
+                        innovation = *im;
+                        goto CurrentlyInvalidLR;
                     }
-                    u--;
-                    if (u <= 0)
-                        goto DoneLR;
-                    previousInnovation = innovation;
-                    im += 1;
-                    innovation = *im;
                 }
-                else {  // switch to CurrentlyInvalid state
+
+            CurrentlyInvalidLR:
+                for (;;) {
                     u--;
                     if (u <= 0)
                         goto DoneLR;
-                    previousInnovation = innovation;
-                    im += 1;
-                    innovation = *im;
-                    goto CurrentlyInvalidLR;
-                }
-            }
-
-        CurrentlyInvalidLR:
-            for (;;) {
-                u--;
-                if (u <= 0)
-                    goto DoneLR;
-                if (*(int*)&innovation > 0) { // switch to CurrentlyValid state
-                    previousInnovation = state = innovation;
-                    im += 1;
-                    innovation = *im;
-                    goto CurrentlyValidLR;
-                }
-                else {
-                    im += 1;
-                    innovation = *im;
-                }
-            }
-        DoneLR:
-
-            // right to left
-            im = image + (v + 1) * _width - 2;  // end of row - two pixels
-            previousInnovation = state = im[1];
-            u = int(_width) - 1;
-            innovation = *im;
-            if (!(*(int*)&previousInnovation > 0))
-                goto CurrentlyInvalidRL;
-            // else fall through
-        CurrentlyValidRL:
-            for (;;) {
-                if (*(int*)&innovation > 0) {
-                    float delta = previousInnovation - innovation;
-                    bool smallDifference = delta < deltaZ && delta > -deltaZ;
-
-                    if (smallDifference) {
-                        float filtered = innovation * alpha + state * (1.0f - alpha);
-                        *im = state = filtered;
+                    if (*(int*)&innovation > 0) { // switch to CurrentlyValid state
+                        previousInnovation = state = innovation;
+                        im += 1;
+                        innovation = *im;
+                        goto CurrentlyValidLR;
                     }
                     else {
-                        state = innovation;
+                        im += 1;
+                        innovation = *im;
                     }
-                    u--;
-                    if (u <= 0)
-                        goto DoneRL;
-                    previousInnovation = innovation;
-                    im -= 1;
-                    innovation = *im;
                 }
-                else {  // switch to CurrentlyInvalid state
-                    u--;
-                    if (u <= 0)
-                        goto DoneRL;
-                    previousInnovation = innovation;
-                    im -= 1;
-                    innovation = *im;
+            DoneLR:
+
+                // right to left
+                im = image + (v + 1) * _width - 2;  // end of row - two pixels
+                previousInnovation = state = im[1];
+                u = int(_width) - 1;
+                innovation = *im;
+                if (!(*(int*)&previousInnovation > 0))
                     goto CurrentlyInvalidRL;
-                }
-            }
-
-        CurrentlyInvalidRL:
-            for (;;) {
-                u--;
-                if (u <= 0)
-                    goto DoneRL;
-                if (*(int*)&innovation > 0) { // switch to CurrentlyValid state
-                    previousInnovation = state = innovation;
-                    im -= 1;
-                    innovation = *im;
-                    goto CurrentlyValidRL;
-                }
-                else {
-                    im -= 1;
-                    innovation = *im;
-                }
-            }
-        DoneRL:
-            v++;
-        }
-    }
-
-    void spatial_filter::recursive_filter_vertical_fp(void * image_data, float alpha, float deltaZ)
-    {
-        float *image = reinterpret_cast<float*>(image_data);
-
-        int v, u;
-
-        // we'll do one column at a time, top to bottom, bottom to top, left to right,
-
-        for (u = 0; u < _width;) {
-
-            float *im = image + u;
-            float state = im[0];
-            float previousInnovation = state;
-
-            v = int(_height) - 1;
-            im += _width;
-            float innovation = *im;
-
-            if (!(*(int*)&previousInnovation > 0))
-                goto CurrentlyInvalidTB;
-            // else fall through
-
-        CurrentlyValidTB:
-            for (;;) {
-                if (*(int*)&innovation > 0) {
-                    float delta = previousInnovation - innovation;
-                    bool smallDifference = delta < deltaZ && delta > -deltaZ;
-
-                    if (smallDifference) {
-                        float filtered = innovation * alpha + state * (1.0f - alpha);
-                        *im = state = filtered;
+                // else fall through
+            CurrentlyValidRL:
+                for (;;) {
+                    if (*(int*)&innovation > 0) {
+                        float delta = previousInnovation - innovation;
+                        bool smallDifference = delta < deltaZ && delta > -deltaZ;
+
+                        if (smallDifference) {
+                            float filtered = innovation * alpha + state * (1.0f - alpha);
+                            *im = state = filtered;
+                        }
+                        else {
+                            state = innovation;
+                        }
+                        u--;
+                        if (u <= 0)
+                            goto DoneRL;
+                        previousInnovation = innovation;
+                        im -= 1;
+                        innovation = *im;
                     }
-                    else {
-                        state = innovation;
+                    else {  // switch to CurrentlyInvalid state
+                        u--;
+                        if (u <= 0)
+                            goto DoneRL;
+                        previousInnovation = innovation;
+                        im -= 1;
+                        innovation = *im;
+                        goto CurrentlyInvalidRL;
                     }
-                    v--;
-                    if (v <= 0)
-                        goto DoneTB;
-                    previousInnovation = innovation;
-                    im += _width;
-                    innovation = *im;
-                }
-                else {  // switch to CurrentlyInvalid state
-                    v--;
-                    if (v <= 0)
-                        goto DoneTB;
-                    previousInnovation = innovation;
-                    im += _width;
-                    innovation = *im;
-                    goto CurrentlyInvalidTB;
                 }
-            }
 
-        CurrentlyInvalidTB:
-            for (;;) {
-                v--;
-                if (v <= 0)
-                    goto DoneTB;
-                if (*(int*)&innovation > 0) { // switch to CurrentlyValid state
-                    previousInnovation = state = innovation;
-                    im += _width;
-                    innovation = *im;
-                    goto CurrentlyValidTB;
-                }
-                else {
-                    im += _width;
-                    innovation = *im;
-                }
-            }
-        DoneTB:
-
-            im = image + u + (_height - 2) * _width;
-            state = im[_width];
-            previousInnovation = state;
-            innovation = *im;
-            v = int(_height) - 1;
-            if (!(*(int*)&previousInnovation > 0))
-                goto CurrentlyInvalidBT;
-            // else fall through
-        CurrentlyValidBT:
-            for (;;) {
-                if (*(int*)&innovation > 0) {
-                    float delta = previousInnovation - innovation;
-                    bool smallDifference = delta < deltaZ && delta > -deltaZ;
-
-                    if (smallDifference) {
-                        float filtered = innovation * alpha + state * (1.0f - alpha);
-                        *im = state = filtered;
+            CurrentlyInvalidRL:
+                for (;;) {
+                    u--;
+                    if (u <= 0)
+                        goto DoneRL;
+                    if (*(int*)&innovation > 0) { // switch to CurrentlyValid state
+                        previousInnovation = state = innovation;
+                        im -= 1;
+                        innovation = *im;
+                        goto CurrentlyValidRL;
                     }
                     else {
-                        state = innovation;
+                        im -= 1;
+                        innovation = *im;
                     }
-                    v--;
-                    if (v <= 0)
-                        goto DoneBT;
-                    previousInnovation = innovation;
-                    im -= _width;
-                    innovation = *im;
-                }
-                else {  // switch to CurrentlyInvalid state
-                    v--;
-                    if (v <= 0)
-                        goto DoneBT;
-                    previousInnovation = innovation;
-                    im -= _width;
-                    innovation = *im;
-                    goto CurrentlyInvalidBT;
                 }
+            DoneRL:
+                ;
             }
+        });
+    }
 
-        CurrentlyInvalidBT:
-            for (;;) {
-                v--;
-                if (v <= 0)
-                    goto DoneBT;
-                if (*(int*)&innovation > 0) { // switch to CurrentlyValid state
-                    previousInnovation = state = innovation;
-                    im -= _width;
-                    innovation = *im;
-                    goto CurrentlyValidBT;
-                }
-                else {
-                    im -= _width;
-                    innovation = *im;
-                }
-            }
-        DoneBT:
-            u++;
-        }
+    void spatial_filter::recursive_filter_vertical(void * image_data, float alpha, float deltaZ)
+    {
+        auto image = reinterpret_cast<uint16_t*>(image_data);
+        const uint16_t delta_z = static_cast<uint16_t>(deltaZ);
+        const size_t first = recursive_filter_vertical_simd(image, alpha, delta_z);
+        spatial_filter_vertical_scalar(image, _width, _height, first, alpha, delta_z);
+    }
+
+    void spatial_filter::recursive_filter_vertical_fp(void * image_data, float alpha, float deltaZ)
+    {
+        auto image = reinterpret_cast<float*>(image_data);
+        const size_t first = recursive_filter_vertical_simd(image, alpha, deltaZ);
+        spatial_filter_vertical_scalar(image, _width, _height, first, alpha, deltaZ);
     }
 }
@@ -12,6 +12,7 @@
 
 #include "../include/librealsense2/hpp/rs_frame.hpp"
 #include "../include/librealsense2/hpp/rs_processing.hpp"
+#include <librealsense2/utilities/concurrency/parallel-for.h>
 
 namespace librealsense
 {
@@ -42,7 +43,7 @@ namespace librealsense
                 else
                 {
                     recursive_filter_horizontal<T>(frame_data, alpha, delta);
-                    recursive_filter_vertical<T>(frame_data, alpha, delta);
+                    recursive_filter_vertical(frame_data, alpha, delta);
                 }
             }
 
@@ -55,11 +56,10 @@ namespace librealsense
         void recursive_filter_horizontal_fp(void * image_data, float alpha, float deltaZ);
         void recursive_filter_vertical_fp(void * image_data, float alpha, float deltaZ);
 
+        // Rows are filtered independently of each other, and are spread across threads
         template <typename T>
         void  recursive_filter_horizontal(void * image_data, float alpha, float deltaZ)
         {
-            size_t v{}, u{};
-
             // Handle conversions for invalid input data
             bool fp = (std::is_floating_point<T>::value);
 
@@ -70,152 +70,97 @@ namespace librealsense
             const T delta_z = static_cast<T>(deltaZ);
 
             auto image = reinterpret_cast<T*>(image_data);
-            size_t cur_fill = 0;
+            const int height = int(_height);
 
-            for (v = 0; v < _height; v++)
+            parallel_for(height, [&](size_t first_row, size_t end_row)
             {
-                // left to right
-                T *im = image + v * _width;
-                T val0 = im[0];
-                cur_fill = 0;
-
-                for (u = 1; u < _width - 1; u++)
+                for (int v = int(first_row); v < int(end_row); ++v)
                 {
-                    T val1 = im[1];
+                    size_t u{};
+
+                    // left to right
+                    T *im = image + v * _width;
+                    T val0 = im[0];
+                    size_t cur_fill = 0;
 
-                    if (fabs(val0) >= valid_threshold)
+                    for (u = 1; u < _width - 1; u++)
                     {
-                        if (fabs(val1) >= valid_threshold)
-                        {
-                            cur_fill = 0;
-                            T diff = static_cast<T>(fabs(val1 - val0));
+                        T val1 = im[1];
 
-                            if (diff >= valid_threshold && diff <= delta_z)
+                        if (fabs(val0) >= valid_threshold)
+                        {
+                            if (fabs(val1) >= valid_threshold)
                             {
-                                float filtered = val1 * alpha + val0 * (1.0f - alpha);
-                                val1 = static_cast<T>(filtered + round);
-                                im[1] = val1;
+                                cur_fill = 0;
+                                T diff = static_cast<T>(fabs(val1 - val0));
+
+                                if (diff >= valid_threshold && diff <= delta_z)
+                                {
+                                    float filtered = val1 * alpha + val0 * (1.0f - alpha);
+                                    val1 = static_cast<T>(filtered + round);
+                                    im[1] = val1;
+                                }
                             }
-                        }
-                        else // Only the old value is valid - appy holes filling
-                        {
-                            if (_holes_filling_radius)
+                            else // Only the old value is valid - appy holes filling
                             {
-                                if (++cur_fill <_holes_filling_radius)
-                                    im[1] = val1 = val0;
+                                if (_holes_filling_radius)
+                                {
+                                    if (++cur_fill <_holes_filling_radius)
+                                        im[1] = val1 = val0;
+                                }
                             }
                         }
-                    }
-
-                    val0 = val1;
-                    im += 1;
-                }
 
-                // right to left
-                im = image + (v + 1) * _width - 2;  // end of row - two pixels
-                T val1 = im[1];
-                cur_fill = 0;
+                        val0 = val1;
+                        im += 1;
+                    }
 
-                for (u = _width - 1; u > 0; u--)
-                {
-                    T val0 = im[0];
+                    // right to left
+                    im = image + (v + 1) * _width - 2;  // end of row - two pixels
+                    T val1 = im[1];
+                    cur_fill = 0;
 
-                    if (val1 >= valid_threshold)
+                    for (u = _width - 1; u > 0; u--)
                     {
-                        if (val0 > valid_threshold)
-                        {
-                            cur_fill = 0;
-                            T diff = static_cast<T>(fabs(val1 - val0));
+                        T val0 = im[0];
 
-                            if (diff <= delta_z)
+                        if (val1 >= valid_threshold)
+                        {
+                            if (val0 > valid_threshold)
                             {
-                                float filtered = val0 * alpha + val1 * (1.0f - alpha);
-                                val0 = static_cast<T>(filtered + round);
-                                im[0] = val0;
+                                cur_fill = 0;
+                                T diff = static_cast<T>(fabs(val1 - val0));
+
+                                if (diff <= delta_z)
+                                {
+                                    float filtered = val0 * alpha + val1 * (1.0f - alpha);
+                                    val0 = static_cast<T>(filtered + round);
+                                    im[0] = val0;
+                                }
                             }
-                        }
-                        else // 'inertial' hole filling
-                        {
-                            if (_holes_filling_radius)
+                            else // 'inertial' hole filling
                             {
-                                if (++cur_fill <_holes_filling_radius)
-                                    im[0] = val0 = val1;
+                                if (_holes_filling_radius)
+                                {
+                                    if (++cur_fill <_holes_filling_radius)
+                                        im[0] = val0 = val1;
+                                }
                             }
                         }
-                    }
-
-                    val1 = val0;
-                    im -= 1;
-                }
-            }
-        }
-
-        template <typename T>
-        void recursive_filter_vertical(void * image_data, float alpha, float deltaZ)
-        {
-            size_t v{}, u{};
 
-            // Handle conversions for invalid input data
-            bool fp = (std::is_floating_point<T>::value);
-
-            // Filtering integer values requires round-up to the nearest discrete value
-            const float round = fp ? 0.f : 0.5f;
-            // define invalid range
-            const T valid_threshold = fp ? static_cast<T>(std::numeric_limits<T>::epsilon()) : static_cast<T>(1);
-            const T delta_z = static_cast<T>(deltaZ);
-
-            auto image = reinterpret_cast<T*>(image_data);
-
-            // we'll do one row at a time, top to bottom, then bottom to top
-
-            // top to bottom
-
-            T *im = image;
-            T im0{};
-            T imw{};
-            for (v = 1; v < _height; v++)
-            {
-                for (u = 0; u < _width; u++)
-                {
-                    im0 = im[0];
-                    imw = im[_width];
-
-                    //if ((fabs(im0) >= valid_threshold) && (fabs(imw) >= valid_threshold))
-                    {
-                        T diff = static_cast<T>(fabs(im0 - imw));
-                        if (diff < delta_z)
-                        {
-                            float filtered = imw * alpha + im0 * (1.f - alpha);
-                            im[_width] = static_cast<T>(filtered + round);
-                        }
-                    }
-                    im += 1;
-                }
-            }
-
-            // bottom to top
-            im = image + (_height - 2) * _width;
-            for (v = 1; v < _height; v++, im -= (_width * 2))
-            {
-                for (u = 0; u < _width; u++)
-                {
-                    im0 = im[0];
-                    imw = im[_width];
-
-                    if ((fabs(im0) >= valid_threshold) && (fabs(imw) >= valid_threshold))
-                    {
-                        T diff = static_cast<T>(fabs(im0 - imw));
-                        if (diff < delta_z)
-                        {
-                            float filtered = im0 * alpha + imw * (1.f - alpha);
-                            im[0] = static_cast<T>(filtered + round);
-                        }
+                        val1 = val0;
+                        im -= 1;
                     }
-                    im += 1;
                 }
-            }
+            });
         }
 
+        // The vertical passes, vectorized over whole blocks of columns (see sse-spatial-filter.h), with the
+        // columns left at the right edge filtered by the scalar passes
+        void recursive_filter_vertical(void * image_data, float alpha, float deltaZ);
+        size_t recursive_filter_vertical_simd(uint16_t * image, float alpha, uint16_t delta_z);
+        size_t recursive_filter_vertical_simd(float * image, float alpha, float delta_z);
+
         template<typename T>
         inline void intertial_holes_fill(T* image_data)
         {
@@ -223,44 +168,46 @@ namespace librealsense
             std::function<bool(T*)> uint_oper = [](T* ptr) { return !(*ptr); };
             auto empty = (std::is_floating_point<T>::value) ? fp_oper : uint_oper;
 
-            size_t cur_fill = 0;
+            const int height = int(_height);
 
-            T* p = image_data;
-            for (int j = 0; j < _height; ++j)
+            parallel_for(height, [&](size_t first_row, size_t end_row)
             {
-                ++p;
-                cur_fill = 0;
-
-                //Left to Right
-                for (size_t i = 1; i < _width; ++i)
+                for (int j = int(first_row); j < int(end_row); ++j)
                 {
-                    if (empty(p))
-                    {
-                        if (++cur_fill < _holes_filling_radius)
-                            *p = *(p - 1);
-                    }
-                    else
-                        cur_fill = 0;
-
+                    T* p = image_data + j * _width;
                     ++p;
-                }
+                    size_t cur_fill = 0;
 
-                --p;
-                cur_fill = 0;
-                //Right to left
-                for (size_t i = 1; i < _width; ++i)
-                {
-                    if (empty(p))
+                    //Left to Right
+                    for (size_t i = 1; i < _width; ++i)
                     {
-                        if (++cur_fill < _holes_filling_radius)
-                            *p = *(p + 1);
+                        if (empty(p))
+                        {
+                            if (++cur_fill < _holes_filling_radius)
+                                *p = *(p - 1);
+                        }
+                        else
+                            cur_fill = 0;
+
+                        ++p;
                     }
-                    else
-                        cur_fill = 0;
+
                     --p;
+                    cur_fill = 0;
+                    //Right to left
+                    for (size_t i = 1; i < _width; ++i)
+                    {
+                        if (empty(p))
+                        {
+                            if (++cur_fill < _holes_filling_radius)
+                                *p = *(p + 1);
+                        }
+                        else
+                            cur_fill = 0;
+                        --p;
+                    }
                 }
-                p += _width;
-            }
+            });
         }
 
     private:
@@ -280,6 +227,7 @@ namespace librealsense
         float                   _stereo_baseline_mm;
         uint8_t                 _holes_filling_mode;
         uint8_t                 _holes_filling_radius;
+        bool                    _use_avx2;
     };
     MAP_EXTENSION(RS2_EXTENSION_SPATIAL_FILTER, librealsense::spatial_filter);
 }
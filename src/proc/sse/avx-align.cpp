@@ -0,0 +1,103 @@
+// License: Apache 2.0. See LICENSE file in root directory.
+// Copyright(c) 2021 Intel Corporation. All Rights Reserved.
+
+#ifdef __SSSE3__
+
+#include "sse-align.h"
+
+#if defined(__AVX2__) && ! defined(ANDROID)
+#include <immintrin.h> // For AVX2 intrinsics
+#endif
+
+namespace librealsense
+{
+#if defined(__AVX2__) && ! defined(ANDROID)
+    namespace
+    {
+        // Same arithmetic as distorte_x_y<RS2_DISTORTION_MODIFIED_BROWN_CONRADY> in sse-align-texture-map.cpp
+        inline void distort_modified_brown_conrady(__m256 & x, __m256 & y, const __m256 c[5])
+        {
+            const __m256 one = _mm256_set1_ps(1);
+            const __m256 two = _mm256_set1_ps(2);
+
+            auto r2 = _mm256_add_ps(_mm256_mul_ps(x, x), _mm256_mul_ps(y, y));
+            auto r3 = _mm256_add_ps(_mm256_mul_ps(c[1], _mm256_mul_ps(r2, r2)), _mm256_mul_ps(c[4], _mm256_mul_ps(r2, _mm256_mul_ps(r2, r2))));
+            auto f = _mm256_add_ps(one, _mm256_add_ps(_mm256_mul_ps(c[0], r2), r3));
+
+            auto xf = _mm256_mul_ps(x, f);
+            auto yf = _mm256_mul_ps(y, f);
+
+            auto r4 = _mm256_mul_ps(c[3], _mm256_add_ps(r2, _mm256_mul_ps(two, _mm256_mul_ps(xf, xf))));
+            x = _mm256_add_ps(xf, _mm256_add_ps(_mm256_mul_ps(two, _mm256_mul_ps(c[2], _mm256_mul_ps(xf, yf))), r4));
+            y = _mm256_add_ps(yf, _mm256_add_ps(_mm256_mul_ps(two, _mm256_mul_ps(c[3], _mm256_mul_ps(xf, yf))), r4));
+        }
+    }
+
+    size_t get_texture_map_avx2(const uint16_t* depth, float depth_scale, size_t count,
+        const float* map_x, const float* map_y, int2* pixels,
+        const rs2_intrinsics& to, const rs2_extrinsics& from_to_other, rs2_distortion dist)
+    {
+        __m256 r[9], t[3], c[5];
+        for (int i = 0; i < 9; ++i)
+            r[i] = _mm256_set1_ps(from_to_other.rotation[i]);
+        for (int i = 0; i < 3; ++i)
+            t[i] = _mm256_set1_ps(from_to_other.translation[i]);
+        for (int i = 0; i < 5; ++i)
+            c[i] = _mm256_set1_ps(to.coeffs[i]);
+
+        const bool distort = dist == RS2_DISTORTION_MODIFIED_BROWN_CONRADY;
+        const auto scale = _mm256_set1_ps(depth_scale);
+        const auto zero = _mm256_setzero_ps();
+        const auto half = _mm256_set1_ps(0.5f);
+        const auto fx = _mm256_set1_ps(to.fx);
+        const auto fy = _mm256_set1_ps(to.fy);
+        const auto ppx = _mm256_set1_ps(to.ppx);
+        const auto ppy = _mm256_set1_ps(to.ppy);
+
+        auto res = reinterpret_cast<__m256i*>(pixels);
+        const size_t size = count - count % 8;
+        for (size_t i = 0; i < size; i += 8)
+        {
+            auto x = _mm256_loadu_ps(map_x + i);
+            auto y = _mm256_loadu_ps(map_y + i);
+            auto d = _mm_loadu_si128(reinterpret_cast<const __m128i*>(depth + i));
+
+            auto z = _mm256_mul_ps(_mm256_cvtepi32_ps(_mm256_cvtepu16_epi32(d)), scale);
+
+            auto px = _mm256_mul_ps(z, x);
+            auto py = _mm256_mul_ps(z, y);
+
+            auto p_x = _mm256_add_ps(_mm256_mul_ps(r[0], px), _mm256_add_ps(_mm256_mul_ps(r[3], py), _mm256_add_ps(_mm256_mul_ps(r[6], z), t[0])));
+            auto p_y = _mm256_add_ps(_mm256_mul_ps(r[1], px), _mm256_add_ps(_mm256_mul_ps(r[4], py), _mm256_add_ps(_mm256_mul_ps(r[7], z), t[1])));
+            auto p_z = _mm256_add_ps(_mm256_mul_ps(r[2], px), _mm256_add_ps(_mm256_mul_ps(r[5], py), _mm256_add_ps(_mm256_mul_ps(r[8], z), t[2])));
+
+            p_x = _mm256_div_ps(p_x, p_z);
+            p_y = _mm256_div_ps(p_y, p_z);
+
+            if (distort)
+                distort_modified_brown_conrady(p_x, p_y, c);
+
+            // Zero the pixel where there is no depth
+            auto valid = _mm256_cmp_ps(z, zero, _CMP_NEQ_UQ);
+            auto u = _mm256_cvtps_epi32(_mm256_and_ps(_mm256_add_ps(_mm256_add_ps(_mm256_mul_ps(p_x, fx), ppx), half), valid));
+            auto v = _mm256_cvtps_epi32(_mm256_and_ps(_mm256_add_ps(_mm256_add_ps(_mm256_mul_ps(p_y, fy), ppy), half), valid));
+
+            // Interleave into (u, v) pairs; the unpacks work within 128-bit lanes
+            auto lo = _mm256_unpacklo_epi32(u, v);  // u0 v0 u1 v1 | u4 v4 u5 v5
+            auto hi = _mm256_unpackhi_epi32(u, v);  // u2 v2 u3 v3 | u6 v6 u7 v7
+            _mm256_storeu_si256(res++, _mm256_permute2x128_si256(lo, hi, 0x20));
+            _mm256_storeu_si256(res++, _mm256_permute2x128_si256(lo, hi, 0x31));
+        }
+        return size;
+    }
+#else
+    size_t get_texture_map_avx2(const uint16_t* depth, float depth_scale, size_t count,
+        const float* map_x, const float* map_y, int2* pixels,
+        const rs2_intrinsics& to, const rs2_extrinsics& from_to_other, rs2_distortion dist)
+    {
+        return 0;
+    }
+#endif
+}
+
+#endif // __SSSE3__
@@ -0,0 +1,41 @@
+// License: Apache 2.0. See LICENSE file in root directory.
+// Copyright(c) 2021 Intel Corporation. All Rights Reserved.
+
+#include "sse-colorizer.h"
+
+#if defined(__AVX2__) && ! defined(ANDROID)
+#include <immintrin.h> // For AVX2 intrinsics
+#endif
+
+namespace librealsense
+{
+#if defined(__AVX2__) && ! defined(ANDROID)
+    size_t colorize_avx2(const uint16_t * depth, size_t count, const uint32_t * lut, uint8_t * rgb)
+    {
+        // Drop the 4th byte of every pixel, leaving 12 bytes at the bottom of each 128-bit lane, then
+        // bring the two halves together
+        const __m256i pack_rgb = _mm256_setr_epi8(
+            0, 1, 2, 4, 5, 6, 8, 9, 10, 12, 13, 14, -1, -1, -1, -1,
+            0, 1, 2, 4, 5, 6, 8, 9, 10, 12, 13, 14, -1, -1, -1, -1);
+        const __m256i join_lanes = _mm256_setr_epi32(0, 1, 2, 4, 5, 6, 3, 7);
+
+        const size_t size = count - count % 8;
+        for (size_t i = 0; i < size; i += 8)
+        {
+            auto d = _mm256_cvtepu16_epi32(_mm_loadu_si128(reinterpret_cast<const __m128i*>(depth + i)));
+            auto c = _mm256_i32gather_epi32(reinterpret_cast<const int*>(lut), d, 4);
+            c = _mm256_permutevar8x32_epi32(_mm256_shuffle_epi8(c, pack_rgb), join_lanes);
+
+            _mm_storeu_si128(reinterpret_cast<__m128i*>(rgb), _mm256_castsi256_si128(c));
+            _mm_storel_epi64(reinterpret_cast<__m128i*>(rgb + 16), _mm256_extracti128_si256(c, 1));
+            rgb += 24;
+        }
+        return size;
+    }
+#else
+    size_t colorize_avx2(const uint16_t * depth, size_t count, const uint32_t * lut, uint8_t * rgb)
+    {
+        return 0;
+    }
+#endif
+}
@@ -0,0 +1,135 @@
+// License: Apache 2.0. See LICENSE file in root directory.
+// Copyright(c) 2021 Intel Corporation. All Rights Reserved.
+
+#include "sse-decimation-filter.h"
+
+#if defined(__AVX2__) && ! defined(ANDROID)
+#include <immintrin.h> // For AVX2 intrinsics
+#endif
+
+namespace librealsense
+{
+#if defined(__AVX2__) && ! defined(ANDROID)
+    namespace
+    {
+        const size_t avx_lanes_u16 = 16;
+
+        inline void sort2(__m256i & a, __m256i & b)
+        {
+            __m256i t = _mm256_min_epu16(a, b);
+            b = _mm256_max_epu16(a, b);
+            a = t;
+        }
+
+        inline void sort_network(__m256i (&v)[4])
+        {
+            sort2(v[0], v[1]); sort2(v[2], v[3]);
+            sort2(v[0], v[2]); sort2(v[1], v[3]);
+            sort2(v[1], v[2]);
+        }
+
+        inline void sort_network(__m256i (&v)[9])
+        {
+            sort2(v[0], v[3]); sort2(v[1], v[7]); sort2(v[2], v[5]); sort2(v[4], v[8]);
+            sort2(v[0], v[7]); sort2(v[2], v[4]); sort2(v[3], v[8]); sort2(v[5], v[6]);
+            sort2(v[0], v[2]); sort2(v[1], v[3]); sort2(v[4], v[5]); sort2(v[7], v[8]);
+            sort2(v[1], v[4]); sort2(v[3], v[6]); sort2(v[5], v[7]);
+            sort2(v[0], v[1]); sort2(v[2], v[4]); sort2(v[3], v[5]); sort2(v[6], v[8]);
+            sort2(v[2], v[3]); sort2(v[4], v[5]); sort2(v[6], v[7]);
+            sort2(v[1], v[2]); sort2(v[3], v[4]); sort2(v[5], v[6]);
+        }
+
+        // Shuffle masks picking the pixels m, m + S, m + 2S... out of S consecutive 128-bit registers
+        // of a row, one mask per register. The shuffles stay within 128-bit lanes, so each half of
+        // the output pixels is gathered separately.
+        template<int S>
+        void gather_masks(__m128i (&masks)[S][S])
+        {
+            for (int m = 0; m < S; ++m)
+                for (int r = 0; r < S; ++r)
+                {
+                    alignas(16) char bytes[16];
+                    for (int i = 0; i < 8; ++i)
+                    {
+                        int idx = S * i + m;
+                        bool here = idx / 8 == r;
+                        bytes[2 * i] = here ? char(2 * (idx % 8)) : char(0x80);
+                        bytes[2 * i + 1] = here ? char(2 * (idx % 8) + 1) : char(0x80);
+                    }
+                    masks[m][r] = _mm_load_si128(reinterpret_cast<const __m128i*>(bytes));
+                }
+        }
+
+        template<int S>
+        inline __m128i gather(const __m128i * regs, const __m128i (&masks)[S])
+        {
+            __m128i p = _mm_shuffle_epi8(regs[0], masks[0]);
+            for (int r = 1; r < S; ++r)
+                p = _mm_or_si128(p, _mm_shuffle_epi8(regs[r], masks[r]));
+            return p;
+        }
+
+        template<int S>
+        size_t median(const uint16_t * in, size_t width_in, size_t width_out, uint16_t * out)
+        {
+            const int N = S * S;
+            __m128i masks[S][S];
+            gather_masks<S>(masks);
+
+            const __m256i zero = _mm256_setzero_si256();
+            const __m256i one = _mm256_set1_epi16(1);
+            const size_t blocks = width_out / avx_lanes_u16;
+            for (size_t b = 0; b < blocks; ++b)
+            {
+                __m256i v[N];
+                __m256i valid = _mm256_set1_epi16(N);
+                for (int n = 0; n < S; ++n)
+                {
+                    auto row = reinterpret_cast<const __m128i*>(in + n * width_in + b * avx_lanes_u16 * S);
+                    __m128i regs[2 * S];
+                    for (int r = 0; r < 2 * S; ++r)
+                        regs[r] = _mm_loadu_si128(row + r);
+
+                    for (int m = 0; m < S; ++m)
+                    {
+                        __m256i p = _mm256_inserti128_si256(_mm256_castsi128_si256(gather<S>(regs, masks[m])),
+                                                            gather<S>(regs + S, masks[m]), 1);
+
+                        valid = _mm256_add_epi16(valid, _mm256_cmpeq_epi16(p, zero));
+                        // Zeros wrap around to the largest value, so they sort last
+                        v[n * S + m] = _mm256_sub_epi16(p, one);
+                    }
+                }
+
+                sort_network(v);
+
+                // The median of k valid values is the ((k - 1) / 2)-th smallest. With none, the
+                // smallest is a wrapped-around zero, and unwraps back to zero.
+                __m256i res = v[0];
+                for (int k = 1; k <= (N - 1) / 2; ++k)
+                {
+                    __m256i more = _mm256_cmpgt_epi16(valid, _mm256_set1_epi16(short(2 * k)));
+                    res = _mm256_blendv_epi8(res, v[k], more);
+                }
+                _mm256_storeu_si256(reinterpret_cast<__m256i*>(out + b * avx_lanes_u16), _mm256_add_epi16(res, one));
+            }
+            return blocks * avx_lanes_u16;
+        }
+    }
+
+    size_t decimate_depth_median_avx2(const uint16_t * in, size_t width_in, size_t scale, size_t width_out, uint16_t * out)
+    {
+        switch (scale)
+        {
+        case 2: return median<2>(in, width_in, width_out, out);
+        case 3: return median<3>(in, width_in, width_out, out);
+        default: return 0;
+        }
+    }
+#else
+    size_t decimate_depth_median_avx2(const uint16_t * in, size_t width_in, size_t scale, size_t width_out, uint16_t * out)
+    {
+        return decimate_depth_median_sse(in, width_in, scale, width_out, out);
+    }
+#endif
+}
@@ -0,0 +1,142 @@
+// License: Apache 2.0. See LICENSE file in root directory.
+// Copyright(c) 2021 Intel Corporation. All Rights Reserved.
+
+#include "sse-format-converters.h"
+
+#if defined(__AVX2__) && ! defined(ANDROID)
+#include <immintrin.h> // For AVX2 intrinsics
+#endif
+
+namespace librealsense
+{
+#if defined(__AVX2__) && ! defined(ANDROID)
+    namespace
+    {
+        inline __m256i load(const void * p) { return _mm256_loadu_si256(reinterpret_cast<const __m256i*>(p)); }
+        inline void store(void * p, __m256i v) { _mm256_storeu_si256(reinterpret_cast<__m256i*>(p), v); }
+
+        // Two 128-bit loads, into the low and high lanes
+        inline __m256i load2(const void * lo, const void * hi)
+        {
+            return _mm256_inserti128_si256(_mm256_castsi128_si256(_mm_loadu_si128(reinterpret_cast<const __m128i*>(lo))),
+                                           _mm_loadu_si128(reinterpret_cast<const __m128i*>(hi)), 1);
+        }
+
+        // Shuffles stay within 128-bit lanes: after gathering the left values in the low half of
+        // each lane and the right ones in the high half, the 64-bit quarters are put back in order
+        inline void deinterleave(__m256i lr0, __m256i lr1, __m256i & left, __m256i & right)
+        {
+            lr0 = _mm256_permute4x64_epi64(lr0, 0xd8);
+            lr1 = _mm256_permute4x64_epi64(lr1, 0xd8);
+            left = _mm256_permute2x128_si256(lr0, lr1, 0x20);
+            right = _mm256_permute2x128_si256(lr0, lr1, 0x31);
+        }
+    }
+
+    size_t split_y8i_avx2(const uint8_t * in, size_t count, uint8_t * left, uint8_t * right)
+    {
+        const __m256i evens_odds = _mm256_setr_epi8(0, 2, 4, 6, 8, 10, 12, 14, 1, 3, 5, 7, 9, 11, 13, 15,
+                                                    0, 2, 4, 6, 8, 10, 12, 14, 1, 3, 5, 7, 9, 11, 13, 15);
+        const size_t blocks = count / 32;
+        for (size_t b = 0; b < blocks; ++b)
+        {
+            __m256i l, r;
+            deinterleave(_mm256_shuffle_epi8(load(in + b * 64), evens_odds),
+                         _mm256_shuffle_epi8(load(in + b * 64 + 32), evens_odds), l, r);
+            store(left + b * 32, l);
+            store(right + b * 32, r);
+        }
+        return blocks * 32;
+    }
+
+    size_t split_y16i_avx2(const uint16_t * in, size_t count, uint16_t * left, uint16_t * right)
+    {
+        const __m256i evens_odds = _mm256_setr_epi8(0, 1, 4, 5, 8, 9, 12, 13, 2, 3, 6, 7, 10, 11, 14, 15,
+                                                    0, 1, 4, 5, 8, 9, 12, 13, 2, 3, 6, 7, 10, 11, 14, 15);
+        const size_t blocks = count / 16;
+        for (size_t b = 0; b < blocks; ++b)
+        {
+            __m256i l, r;
+            deinterleave(_mm256_shuffle_epi8(load(in + b * 32), evens_odds),
+                         _mm256_shuffle_epi8(load(in + b * 32 + 16), evens_odds), l, r);
+            store(left + b * 16, _mm256_slli_epi16(l, 6));
+            store(right + b * 16, _mm256_slli_epi16(r, 6));
+        }
+        return blocks * 16;
+    }
+
+    size_t y10_to_y8_avx2(const uint16_t * in, size_t count, uint8_t * out)
+    {
+        const __m256i low_byte = _mm256_set1_epi16(0xff);
+        const size_t blocks = count / 32;
+        for (size_t b = 0; b < blocks; ++b)
+        {
+            __m256i p0 = _mm256_and_si256(_mm256_srli_epi16(load(in + b * 32), 2), low_byte);
+            __m256i p1 = _mm256_and_si256(_mm256_srli_epi16(load(in + b * 32 + 16), 2), low_byte);
+            // Packing interleaves the lanes of the two registers
+            store(out + b * 32, _mm256_permute4x64_epi64(_mm256_packus_epi16(p0, p1), 0xd8));
+        }
+        return blocks * 32;
+    }
+
+    size_t y10_to_y16_avx2(const uint16_t * in, size_t count, uint16_t * out)
+    {
+        const size_t blocks = count / 16;
+        for (size_t b = 0; b < blocks; ++b)
+            store(out + b * 16, _mm256_slli_epi16(load(in + b * 16), 6));
+        return blocks * 16;
+    }
+
+    size_t unpack_y10bpack_avx2(const uint8_t * in, size_t count, uint16_t * out)
+    {
+        // As unpack_y10bpack_sse(), with the next 16 pixels in the high lanes
+        const __m256i group01 = _mm256_setr_epi8(4, 0, 4, 1, 4, 2, 4, 3, 9, 5, 9, 6, 9, 7, 9, 8,
+                                                 4, 0, 4, 1, 4, 2, 4, 3, 9, 5, 9, 6, 9, 7, 9, 8);
+        const __m256i group23 = _mm256_setr_epi8(10, 6, 10, 7, 10, 8, 10, 9, 15, 11, 15, 12, 15, 13, 15, 14,
+                                                 10, 6, 10, 7, 10, 8, 10, 9, 15, 11, 15, 12, 15, 13, 15, 14);
+        const __m256i lsb_shift = _mm256_setr_epi16(64, 16, 4, 1, 64, 16, 4, 1, 64, 16, 4, 1, 64, 16, 4, 1);
+        const __m256i msbs = _mm256_set1_epi16(short(0xff00));
+        const __m256i lsbs = _mm256_set1_epi16(0x00c0);
+
+        const size_t blocks = count / 32;
+        for (size_t b = 0; b < blocks; ++b)
+        {
+            auto p = in + b * 40;
+            __m256i w0 = _mm256_shuffle_epi8(load2(p, p + 20), group01);
+            __m256i w1 = _mm256_shuffle_epi8(load2(p + 4, p + 24), group23);
+            __m256i l0 = _mm256_and_si256(_mm256_mullo_epi16(_mm256_andnot_si256(msbs, w0), lsb_shift), lsbs);
+            __m256i l1 = _mm256_and_si256(_mm256_mullo_epi16(_mm256_andnot_si256(msbs, w1), lsb_shift), lsbs);
+            __m256i px0 = _mm256_or_si256(_mm256_and_si256(w0, msbs), l0);  // pixels 0-7, 16-23
+            __m256i px1 = _mm256_or_si256(_mm256_and_si256(w1, msbs), l1);  // pixels 8-15, 24-31
+            store(out + b * 32, _mm256_permute2x128_si256(px0, px1, 0x20));
+            store(out + b * 32 + 16, _mm256_permute2x128_si256(px0, px1, 0x31));
+        }
+        return blocks * 32;
+    }
+#else
+    size_t split_y8i_avx2(const uint8_t * in, size_t count, uint8_t * left, uint8_t * right)
+    {
+        return split_y8i_sse(in, count, left, right);
+    }
+
+    size_t split_y16i_avx2(const uint16_t * in, size_t count, uint16_t * left, uint16_t * right)
+    {
+        return split_y16i_sse(in, count, left, right);
+    }
+
+    size_t y10_to_y8_avx2(const uint16_t * in, size_t count, uint8_t * out)
+    {
+        return y10_to_y8_sse(in, count, out);
+    }
+
+    size_t y10_to_y16_avx2(const uint16_t * in, size_t count, uint16_t * out)
+    {
+        return y10_to_y16_sse(in, count, out);
+    }
+
+    size_t unpack_y10bpack_avx2(const uint8_t * in, size_t count, uint16_t * out)
+    {
+        return unpack_y10bpack_sse(in, count, out);
+    }
+#endif
+}
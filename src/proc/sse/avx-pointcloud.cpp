@@ -0,0 +1,162 @@
+// License: Apache 2.0. See LICENSE file in root directory.
+// Copyright(c) 2021 Intel Corporation. All Rights Reserved.
+
+#include "sse-pointcloud.h"
+
+#if defined(__AVX2__) && ! defined(ANDROID)
+#include <immintrin.h> // For AVX2 intrinsics
+#endif
+
+namespace librealsense
+{
+#if defined(__AVX2__) && ! defined(ANDROID)
+    size_t deproject_depth_avx2(const uint16_t* depth, float depth_scale, size_t count,
+        const float* map_x, const float* map_y, float3* points)
+    {
+        const auto scale = _mm256_set1_ps(depth_scale);
+
+        auto res = reinterpret_cast<float*>(points);
+        const size_t size = count - count % 8;
+        for (size_t i = 0; i < size; i += 8)
+        {
+            auto x = _mm256_loadu_ps(map_x + i);
+            auto y = _mm256_loadu_ps(map_y + i);
+            auto d = _mm_loadu_si128(reinterpret_cast<const __m128i*>(depth + i));
+
+            auto z = _mm256_mul_ps(_mm256_cvtepi32_ps(_mm256_cvtepu16_epi32(d)), scale);
+            auto px = _mm256_mul_ps(z, x);
+            auto py = _mm256_mul_ps(z, y);
+
+            // Interleave into (x, y, z) the way the SSE code does, within each 128-bit lane: the low
+            // lanes hold points 0-3 and the high lanes points 4-7
+            auto x_y = _mm256_shuffle_ps(px, py, _MM_SHUFFLE(2, 0, 2, 0));
+            auto z_x = _mm256_shuffle_ps(z, px, _MM_SHUFFLE(3, 1, 2, 0));
+            auto y_z = _mm256_shuffle_ps(py, z, _MM_SHUFFLE(3, 1, 3, 1));
+
+            auto xyz1 = _mm256_shuffle_ps(x_y, z_x, _MM_SHUFFLE(2, 0, 2, 0));  // x0 y0 z0 x1 | x4 y4 z4 x5
+            auto xyz2 = _mm256_shuffle_ps(y_z, x_y, _MM_SHUFFLE(3, 1, 2, 0));  // y1 z1 x2 y2 | y5 z5 x6 y6
+            auto xyz3 = _mm256_shuffle_ps(z_x, y_z, _MM_SHUFFLE(3, 1, 3, 1));  // z2 x3 y3 z3 | z6 x7 y7 z7
+
+            _mm256_storeu_ps(res, _mm256_permute2f128_ps(xyz1, xyz2, 0x20));
+            _mm256_storeu_ps(res + 8, _mm256_permute2f128_ps(xyz3, xyz1, 0x30));
+            _mm256_storeu_ps(res + 16, _mm256_permute2f128_ps(xyz2, xyz3, 0x31));
+            res += 24;
+        }
+        return size;
+    }
+
+    size_t get_texture_map_avx2(const float3* points, size_t count,
+        const rs2_intrinsics& other, const rs2_extrinsics& extr,
+        float2* texture_map, float2* pixels)
+    {
+        __m256 r[9], t[3], c[5];
+        for (int i = 0; i < 9; ++i)
+            r[i] = _mm256_set1_ps(extr.rotation[i]);
+        for (int i = 0; i < 3; ++i)
+            t[i] = _mm256_set1_ps(extr.translation[i]);
+        for (int i = 0; i < 5; ++i)
+            c[i] = _mm256_set1_ps(other.coeffs[i]);
+
+        // The model is the same for all the points, so unlike the SSE code there is nothing to blend
+        const bool distort = other.model != RS2_DISTORTION_NONE;
+        const bool brown = other.model == RS2_DISTORTION_BROWN_CONRADY;
+        const auto fx = _mm256_set1_ps(other.fx);
+        const auto fy = _mm256_set1_ps(other.fy);
+        const auto ppx = _mm256_set1_ps(other.ppx);
+        const auto ppy = _mm256_set1_ps(other.ppy);
+        const auto w = _mm256_set1_ps(float(other.width));
+        const auto h = _mm256_set1_ps(float(other.height));
+        const auto zero = _mm256_setzero_ps();
+        const auto one = _mm256_set1_ps(1);
+        const auto two = _mm256_set1_ps(2);
+
+        auto point = reinterpret_cast<const float*>(points);
+        auto res = reinterpret_cast<float*>(texture_map);
+        auto res1 = reinterpret_cast<float*>(pixels);
+        const size_t size = count - count % 8;
+        for (size_t i = 0; i < size; i += 8)
+        {
+            auto in0 = _mm256_loadu_ps(point);
+            auto in1 = _mm256_loadu_ps(point + 8);
+            auto in2 = _mm256_loadu_ps(point + 16);
+            point += 24;
+
+            // Points 0-3 to the low lanes and 4-7 to the high ones, then gather x, y, z as the SSE
+            // code does
+            auto xyz1 = _mm256_permute2f128_ps(in0, in1, 0x30);
+            auto xyz2 = _mm256_permute2f128_ps(in0, in2, 0x21);
+            auto xyz3 = _mm256_permute2f128_ps(in1, in2, 0x30);
+
+            auto yz = _mm256_shuffle_ps(xyz1, xyz2, _MM_SHUFFLE(1, 0, 2, 1));
+            auto xy = _mm256_shuffle_ps(xyz2, xyz3, _MM_SHUFFLE(2, 1, 3, 2));
+
+            auto x = _mm256_shuffle_ps(xyz1, xy, _MM_SHUFFLE(2, 0, 3, 0));
+            auto y = _mm256_shuffle_ps(yz, xy, _MM_SHUFFLE(3, 1, 2, 0));
+            auto z = _mm256_shuffle_ps(yz, xyz3, _MM_SHUFFLE(3, 0, 3, 1));
+
+            auto p_x = _mm256_add_ps(_mm256_mul_ps(r[0], x), _mm256_add_ps(_mm256_mul_ps(r[3], y), _mm256_add_ps(_mm256_mul_ps(r[6], z), t[0])));
+            auto p_y = _mm256_add_ps(_mm256_mul_ps(r[1], x), _mm256_add_ps(_mm256_mul_ps(r[4], y), _mm256_add_ps(_mm256_mul_ps(r[7], z), t[1])));
+            auto p_z = _mm256_add_ps(_mm256_mul_ps(r[2], x), _mm256_add_ps(_mm256_mul_ps(r[5], y), _mm256_add_ps(_mm256_mul_ps(r[8], z), t[2])));
+
+            p_x = _mm256_div_ps(p_x, p_z);
+            p_y = _mm256_div_ps(p_y, p_z);
+
+            if (distort)
+            {
+                auto r2 = _mm256_add_ps(_mm256_mul_ps(p_x, p_x), _mm256_mul_ps(p_y, p_y));
+                auto r3 = _mm256_add_ps(_mm256_mul_ps(c[1], _mm256_mul_ps(r2, r2)), _mm256_mul_ps(c[4], _mm256_mul_ps(r2, _mm256_mul_ps(r2, r2))));
+                auto f = _mm256_add_ps(one, _mm256_add_ps(_mm256_mul_ps(c[0], r2), r3));
+
+                auto x_f = _mm256_mul_ps(p_x, f);
+                auto y_f = _mm256_mul_ps(p_y, f);
+
+                // The tangential distortion is applied to the radially distorted point, except in
+                // the unmodified Brown-Conrady model
+                auto x_f_dist = brown ? p_x : x_f;
+                auto y_f_dist = brown ? p_y : y_f;
+
+                auto r4 = _mm256_mul_ps(c[3], _mm256_add_ps(r2, _mm256_mul_ps(two, _mm256_mul_ps(x_f_dist, x_f_dist))));
+                p_x = _mm256_add_ps(x_f, _mm256_add_ps(_mm256_mul_ps(two, _mm256_mul_ps(c[2], _mm256_mul_ps(x_f_dist, y_f_dist))), r4));
+
+                auto r5 = _mm256_mul_ps(c[2], _mm256_add_ps(r2, _mm256_mul_ps(two, _mm256_mul_ps(y_f_dist, y_f_dist))));
+                p_y = _mm256_add_ps(y_f, _mm256_add_ps(_mm256_mul_ps(two, _mm256_mul_ps(c[3], _mm256_mul_ps(x_f_dist, y_f_dist))), r5));
+            }
+
+            // Zero the pixel where there is no depth
+            auto valid = _mm256_cmp_ps(z, zero, _CMP_NEQ_UQ);
+            p_x = _mm256_and_ps(_mm256_add_ps(_mm256_mul_ps(p_x, fx), ppx), valid);
+            p_y = _mm256_and_ps(_mm256_add_ps(_mm256_mul_ps(p_y, fy), ppy), valid);
+
+            // Interleave into (x, y) pairs; the unpacks work within 128-bit lanes
+            auto lo = _mm256_unpacklo_ps(p_x, p_y);  // x0 y0 x1 y1 | x4 y4 x5 y5
+            auto hi = _mm256_unpackhi_ps(p_x, p_y);  // x2 y2 x3 y3 | x6 y6 x7 y7
+            _mm256_storeu_ps(res1, _mm256_permute2f128_ps(lo, hi, 0x20));
+            _mm256_storeu_ps(res1 + 8, _mm256_permute2f128_ps(lo, hi, 0x31));
+            res1 += 16;
+
+            p_x = _mm256_div_ps(p_x, w);
+            p_y = _mm256_div_ps(p_y, h);
+
+            lo = _mm256_unpacklo_ps(p_x, p_y);
+            hi = _mm256_unpackhi_ps(p_x, p_y);
+            _mm256_storeu_ps(res, _mm256_permute2f128_ps(lo, hi, 0x20));
+            _mm256_storeu_ps(res + 8, _mm256_permute2f128_ps(lo, hi, 0x31));
+            res += 16;
+        }
+        return size;
+    }
+#else
+    size_t deproject_depth_avx2(const uint16_t* depth, float depth_scale, size_t count,
+        const float* map_x, const float* map_y, float3* points)
+    {
+        return 0;
+    }
+
+    size_t get_texture_map_avx2(const float3* points, size_t count,
+        const rs2_intrinsics& other, const rs2_extrinsics& extr,
+        float2* texture_map, float2* pixels)
+    {
+        return 0;
+    }
+#endif
+}
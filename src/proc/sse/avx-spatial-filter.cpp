@@ -0,0 +1,146 @@
+// License: Apache 2.0. See LICENSE file in root directory.
+// Copyright(c) 2021 Intel Corporation. All Rights Reserved.
+
+#include "sse-spatial-filter.h"
+#include <librealsense2/utilities/concurrency/parallel-for.h>
+
+#if defined(__AVX2__) && ! defined(ANDROID)
+#include <immintrin.h> // For AVX2 intrinsics
+#endif
+
+namespace librealsense
+{
+#if defined(__AVX2__) && ! defined(ANDROID)
+    namespace
+    {
+        const size_t avx_lanes_u16 = 16;
+        const size_t avx_lanes_fp = 8;
+
+        // (uint16_t)(x * alpha + y * (1 - alpha) + 0.5f), computed in float exactly as the scalar code does
+        inline __m256i blend_u16(__m256i x, __m256i y, __m256 alpha, __m256 one_minus_alpha)
+        {
+            const __m256 round = _mm256_set1_ps(0.5f);
+
+            __m256 xl = _mm256_cvtepi32_ps(_mm256_cvtepu16_epi32(_mm256_castsi256_si128(x)));
+            __m256 xh = _mm256_cvtepi32_ps(_mm256_cvtepu16_epi32(_mm256_extracti128_si256(x, 1)));
+            __m256 yl = _mm256_cvtepi32_ps(_mm256_cvtepu16_epi32(_mm256_castsi256_si128(y)));
+            __m256 yh = _mm256_cvtepi32_ps(_mm256_cvtepu16_epi32(_mm256_extracti128_si256(y, 1)));
+
+            __m256i lo = _mm256_cvttps_epi32(_mm256_add_ps(_mm256_add_ps(_mm256_mul_ps(xl, alpha), _mm256_mul_ps(yl, one_minus_alpha)), round));
+            __m256i hi = _mm256_cvttps_epi32(_mm256_add_ps(_mm256_add_ps(_mm256_mul_ps(xh, alpha), _mm256_mul_ps(yh, one_minus_alpha)), round));
+
+            // The pack works within 128-bit lanes; restore the column order afterwards
+            return _mm256_permute4x64_epi64(_mm256_packus_epi32(lo, hi), _MM_SHUFFLE(3, 1, 2, 0));
+        }
+
+        // Mask of the lanes where |a - b| < delta
+        inline __m256i close_u16(__m256i a, __m256i b, __m256i delta)
+        {
+            __m256i diff = _mm256_or_si256(_mm256_subs_epu16(a, b), _mm256_subs_epu16(b, a));
+            return _mm256_xor_si256(_mm256_cmpeq_epi16(_mm256_subs_epu16(delta, diff), _mm256_setzero_si256()), _mm256_set1_epi32(-1));
+        }
+    }
+
+    size_t spatial_filter_vertical_avx2(uint16_t * image, size_t width, size_t height, float alpha, uint16_t delta_z)
+    {
+        const int blocks = int(width / avx_lanes_u16);
+        if (height < 2)
+            return 0;
+
+        const __m256 a = _mm256_set1_ps(alpha);
+        const __m256 one_minus_a = _mm256_set1_ps(1.f - alpha);
+        const __m256i delta = _mm256_set1_epi16(short(delta_z));
+        const __m256i zero = _mm256_setzero_si256();
+
+        parallel_for(blocks, [&](size_t first_block, size_t end_block)
+        {
+            for (int b = int(first_block); b < int(end_block); ++b)
+            {
+                uint16_t * col = image + b * avx_lanes_u16;
+
+                // top to bottom: no validity check, smooth towards the (already filtered) row above
+                __m256i above = _mm256_loadu_si256((const __m256i *)col);
+                for (size_t v = 1; v < height; ++v)
+                {
+                    __m256i * p = (__m256i *)(col + v * width);
+                    __m256i cur = _mm256_loadu_si256(p);
+                    cur = _mm256_blendv_epi8(cur, blend_u16(cur, above, a, one_minus_a), close_u16(above, cur, delta));
+                    _mm256_storeu_si256(p, cur);
+                    above = cur;
+                }
+
+                // bottom to top: both pixels must be valid
+                __m256i below = above;
+                for (size_t v = height - 1; v-- > 0;)
+                {
+                    __m256i * p = (__m256i *)(col + v * width);
+                    __m256i cur = _mm256_loadu_si256(p);
+                    __m256i invalid = _mm256_or_si256(_mm256_cmpeq_epi16(cur, zero), _mm256_cmpeq_epi16(below, zero));
+                    __m256i update = _mm256_andnot_si256(invalid, close_u16(cur, below, delta));
+                    cur = _mm256_blendv_epi8(cur, blend_u16(cur, below, a, one_minus_a), update);
+                    _mm256_storeu_si256(p, cur);
+                    below = cur;
+                }
+            }
+        });
+        return blocks * avx_lanes_u16;
+    }
+
+    size_t spatial_filter_vertical_avx2(float * image, size_t width, size_t height, float alpha, float delta_z)
+    {
+        const int blocks = int(width / avx_lanes_fp);
+        if (height < 2)
+            return 0;
+
+        const __m256 a = _mm256_set1_ps(alpha);
+        const __m256 one_minus_a = _mm256_set1_ps(1.f - alpha);
+        const __m256 dz = _mm256_set1_ps(delta_z);
+        const __m256 neg_dz = _mm256_set1_ps(-delta_z);
+        const __m256i zero = _mm256_setzero_si256();
+
+        // See spatial_filter_vertical_sse
+        auto step = [&](float * p, __m256 & state, __m256 & previous)
+        {
+            __m256 innovation = _mm256_loadu_ps(p);
+            __m256 valid = _mm256_castsi256_ps(_mm256_and_si256(
+                _mm256_cmpgt_epi32(_mm256_castps_si256(innovation), zero),
+                _mm256_cmpgt_epi32(_mm256_castps_si256(previous), zero)));
+            __m256 delta = _mm256_sub_ps(previous, innovation);
+            __m256 update = _mm256_and_ps(valid, _mm256_and_ps(
+                _mm256_cmp_ps(delta, dz, _CMP_LT_OQ), _mm256_cmp_ps(delta, neg_dz, _CMP_GT_OQ)));
+            __m256 filtered = _mm256_add_ps(_mm256_mul_ps(innovation, a), _mm256_mul_ps(state, one_minus_a));
+            state = _mm256_blendv_ps(innovation, filtered, update);
+            _mm256_storeu_ps(p, state);
+            previous = innovation;
+        };
+
+        parallel_for(blocks, [&](size_t first_block, size_t end_block)
+        {
+            for (int b = int(first_block); b < int(end_block); ++b)
+            {
+                float * col = image + b * avx_lanes_fp;
+
+                __m256 state = _mm256_loadu_ps(col);
+                __m256 previous = state;
+                for (size_t v = 1; v < height; ++v)
+                    step(col + v * width, state, previous);
+
+                state = previous = _mm256_loadu_ps(col + (height - 1) * width);
+                for (size_t v = height - 1; v-- > 0;)
+                    step(col + v * width, state, previous);
+            }
+        });
+        return blocks * avx_lanes_fp;
+    }
+#else
+    size_t spatial_filter_vertical_avx2(uint16_t * image, size_t width, size_t height, float alpha, uint16_t delta_z)
+    {
+        return spatial_filter_vertical_sse(image, width, height, alpha, delta_z);
+    }
+
+    size_t spatial_filter_vertical_avx2(float * image, size_t width, size_t height, float alpha, float delta_z)
+    {
+        return spatial_filter_vertical_sse(image, width, height, alpha, delta_z);
+    }
+#endif
+}
@@ -0,0 +1,165 @@
+// License: Apache 2.0. See LICENSE file in root directory.
+// Copyright(c) 2021 Intel Corporation. All Rights Reserved.
+
+#include "sse-temporal-filter.h"
+
+#include <cstring>
+
+#if defined(__AVX2__) && ! defined(ANDROID)
+#include <immintrin.h> // For AVX2 intrinsics
+#endif
+
+namespace librealsense
+{
+#if defined(__AVX2__) && ! defined(ANDROID)
+    namespace
+    {
+        // See sse-temporal-filter.cpp
+        struct persistence_lut
+        {
+            __m128i low_bits, high_bits, bit;
+
+            explicit persistence_lut(const uint8_t persistent[32])
+            {
+                alignas(16) uint8_t lo[16], hi[16];
+                for (int i = 0; i < 16; ++i)
+                {
+                    lo[i] = persistent[2 * i];
+                    hi[i] = persistent[2 * i + 1];
+                }
+                low_bits = _mm_load_si128((const __m128i *)lo);
+                high_bits = _mm_load_si128((const __m128i *)hi);
+                bit = _mm_setr_epi8(1, 2, 4, 8, 16, 32, 64, -128, 1, 2, 4, 8, 16, 32, 64, -128);
+            }
+
+            __m128i operator()(__m128i history) const
+            {
+                const __m128i nibble = _mm_set1_epi8(0x0f);
+                __m128i high = _mm_and_si128(_mm_srli_epi16(history, 4), nibble);
+                __m128i low = _mm_and_si128(history, nibble);
+                __m128i use_high = _mm_cmpgt_epi8(low, _mm_set1_epi8(7));
+                __m128i bits = _mm_blendv_epi8(_mm_shuffle_epi8(low_bits, high), _mm_shuffle_epi8(high_bits, high), use_high);
+                __m128i b = _mm_shuffle_epi8(bit, low);
+                return _mm_cmpeq_epi8(_mm_and_si128(bits, b), b);
+            }
+        };
+
+        inline __m128i update_history(__m128i history, __m128i no_cur, __m128i agree, __m128i mask)
+        {
+            __m128i restart = _mm_andnot_si128(_mm_or_si128(no_cur, agree), mask);
+            return _mm_or_si128(_mm_or_si128(
+                _mm_and_si128(no_cur, _mm_andnot_si128(mask, history)),
+                _mm_and_si128(agree, _mm_or_si128(history, mask))),
+                restart);
+        }
+
+        // 16-bit lane masks to byte masks
+        inline __m128i narrow(__m256i m)
+        {
+            return _mm_packs_epi16(_mm256_castsi256_si128(m), _mm256_extracti128_si256(m, 1));
+        }
+
+        // 32-bit lane masks to byte masks, in the low 8 bytes
+        inline __m128i narrow(__m256 m)
+        {
+            __m256i i = _mm256_castps_si256(m);
+            __m128i w = _mm_packs_epi32(_mm256_castsi256_si128(i), _mm256_extracti128_si256(i, 1));
+            return _mm_packs_epi16(w, _mm_setzero_si128());
+        }
+    }
+
+    size_t temporal_filter_smooth_avx2(uint16_t * frame, uint16_t * last_frame, uint8_t * history, size_t count, const temporal_smooth_params & params)
+    {
+        const size_t lanes = 16;
+        const size_t n = count - count % lanes;
+
+        const persistence_lut persistent(params.persistent);
+        const __m128i mask = _mm_set1_epi8(char(params.mask));
+        const __m256i delta = _mm256_set1_epi16(short(params.delta_z));
+        const __m256 alpha = _mm256_set1_ps(params.alpha);
+        const __m256 one_minus_alpha = _mm256_set1_ps(params.one_minus_alpha);
+        const __m256i zero = _mm256_setzero_si256();
+
+        for (size_t i = 0; i < n; i += lanes)
+        {
+            __m256i cur = _mm256_loadu_si256((const __m256i *)(frame + i));
+            __m256i prev = _mm256_loadu_si256((const __m256i *)(last_frame + i));
+            __m128i hist = _mm_loadu_si128((const __m128i *)(history + i));
+
+            __m256i no_cur = _mm256_cmpeq_epi16(cur, zero);
+            __m256i no_prev = _mm256_cmpeq_epi16(prev, zero);
+            __m256i diff = _mm256_or_si256(_mm256_subs_epu16(cur, prev), _mm256_subs_epu16(prev, cur));
+            __m256i far = _mm256_cmpeq_epi16(_mm256_subs_epu16(delta, diff), zero);
+            __m256i agree = _mm256_andnot_si256(_mm256_or_si256(_mm256_or_si256(no_cur, no_prev), far), _mm256_cmpeq_epi16(zero, zero));
+
+            // (uint16_t)(alpha * cur + (1 - alpha) * prev), truncated like the scalar cast
+            __m256i lo = _mm256_cvttps_epi32(_mm256_add_ps(
+                _mm256_mul_ps(alpha, _mm256_cvtepi32_ps(_mm256_cvtepu16_epi32(_mm256_castsi256_si128(cur)))),
+                _mm256_mul_ps(one_minus_alpha, _mm256_cvtepi32_ps(_mm256_cvtepu16_epi32(_mm256_castsi256_si128(prev))))));
+            __m256i hi = _mm256_cvttps_epi32(_mm256_add_ps(
+                _mm256_mul_ps(alpha, _mm256_cvtepi32_ps(_mm256_cvtepu16_epi32(_mm256_extracti128_si256(cur, 1)))),
+                _mm256_mul_ps(one_minus_alpha, _mm256_cvtepi32_ps(_mm256_cvtepu16_epi32(_mm256_extracti128_si256(prev, 1))))));
+            __m256i filtered = _mm256_permute4x64_epi64(_mm256_packus_epi32(lo, hi), _MM_SHUFFLE(3, 1, 2, 0));
+
+            __m256i fill = _mm256_andnot_si256(no_prev, _mm256_and_si256(no_cur, _mm256_cvtepi8_epi16(persistent(hist))));
+
+            __m256i out = _mm256_blendv_epi8(_mm256_blendv_epi8(cur, prev, fill), filtered, agree);
+            __m256i last = _mm256_blendv_epi8(_mm256_blendv_epi8(cur, prev, no_cur), filtered, agree);
+
+            _mm256_storeu_si256((__m256i *)(frame + i), out);
+            _mm256_storeu_si256((__m256i *)(last_frame + i), last);
+            _mm_storeu_si128((__m128i *)(history + i), update_history(hist, narrow(no_cur), narrow(agree), mask));
+        }
+        return n;
+    }
+
+    size_t temporal_filter_smooth_avx2(float * frame, float * last_frame, uint8_t * history, size_t count, const temporal_smooth_params & params)
+    {
+        const size_t lanes = 8;
+        const size_t n = count - count % lanes;
+
+        const persistence_lut persistent(params.persistent);
+        const __m128i mask = _mm_set1_epi8(char(params.mask));
+        const __m256 delta = _mm256_set1_ps(params.delta_z);
+        const __m256 alpha = _mm256_set1_ps(params.alpha);
+        const __m256 one_minus_alpha = _mm256_set1_ps(params.one_minus_alpha);
+        const __m256 zero = _mm256_setzero_ps();
+        const __m256 sign = _mm256_set1_ps(-0.f);
+
+        for (size_t i = 0; i < n; i += lanes)
+        {
+            __m256 cur = _mm256_loadu_ps(frame + i);
+            __m256 prev = _mm256_loadu_ps(last_frame + i);
+            __m128i hist = _mm_loadl_epi64((const __m128i *)(history + i));
+
+            // As in the scalar code, 0 and -0 are missing values while NaN is not
+            __m256 no_cur = _mm256_cmp_ps(cur, zero, _CMP_EQ_OQ);
+            __m256 no_prev = _mm256_cmp_ps(prev, zero, _CMP_EQ_OQ);
+            __m256 diff = _mm256_andnot_ps(sign, _mm256_sub_ps(cur, prev));
+            __m256 agree = _mm256_andnot_ps(_mm256_or_ps(no_cur, no_prev), _mm256_cmp_ps(diff, delta, _CMP_LT_OQ));
+
+            __m256 filtered = _mm256_add_ps(_mm256_mul_ps(alpha, cur), _mm256_mul_ps(one_minus_alpha, prev));
+
+            __m256 fill = _mm256_andnot_ps(no_prev, _mm256_and_ps(no_cur, _mm256_castsi256_ps(_mm256_cvtepi8_epi32(persistent(hist)))));
+
+            __m256 out = _mm256_blendv_ps(_mm256_blendv_ps(cur, prev, fill), filtered, agree);
+            __m256 last = _mm256_blendv_ps(_mm256_blendv_ps(cur, prev, no_cur), filtered, agree);
+
+            _mm256_storeu_ps(frame + i, out);
+            _mm256_storeu_ps(last_frame + i, last);
+            _mm_storel_epi64((__m128i *)(history + i), update_history(hist, narrow(no_cur), narrow(agree), mask));
+        }
+        return n;
+    }
+#else
+    size_t temporal_filter_smooth_avx2(uint16_t * frame, uint16_t * last_frame, uint8_t * history, size_t count, const temporal_smooth_params & params)
+    {
+        return temporal_filter_smooth_sse(frame, last_frame, history, count, params);
+    }
+
+    size_t temporal_filter_smooth_avx2(float * frame, float * last_frame, uint8_t * history, size_t count, const temporal_smooth_params & params)
+    {
+        return temporal_filter_smooth_sse(frame, last_frame, history, count, params);
+    }
+#endif
+}
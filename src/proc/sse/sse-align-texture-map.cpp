@@ -0,0 +1,257 @@
+// License: Apache 2.0. See LICENSE file in root directory.
+// Copyright(c) 2019 Intel Corporation. All Rights Reserved.
+
+// The projection of depth pixels onto the other image, used by align; apart from the rest of align so
+// that it can be tested against the AVX2 code without the library
+#ifdef __SSSE3__
+
+#include "sse-align.h"
+#include <tmmintrin.h> // For SSSE3 intrinsics
+
+namespace librealsense
+{
+    namespace
+    {
+        template<rs2_distortion dist>
+        inline void distorte_x_y(const __m128 & x, const __m128 & y, __m128 * distorted_x, __m128 * distorted_y, const rs2_intrinsics& to)
+        {
+            *distorted_x = x;
+            *distorted_y = y;
+        }
+        template<>
+        inline void distorte_x_y<RS2_DISTORTION_MODIFIED_BROWN_CONRADY>(const __m128& x, const __m128& y, __m128* distorted_x, __m128* distorted_y, const rs2_intrinsics& to)
+        {
+            __m128 c[5];
+            auto one = _mm_set_ps1(1);
+            auto two = _mm_set_ps1(2);
+
+            for (int i = 0; i < 5; ++i)
+            {
+                c[i] = _mm_set_ps1(to.coeffs[i]);
+            }
+            auto r2_0 = _mm_add_ps(_mm_mul_ps(x, x), _mm_mul_ps(y, y));
+            auto r3_0 = _mm_add_ps(_mm_mul_ps(c[1], _mm_mul_ps(r2_0, r2_0)), _mm_mul_ps(c[4], _mm_mul_ps(r2_0, _mm_mul_ps(r2_0, r2_0))));
+            auto f_0 = _mm_add_ps(one, _mm_add_ps(_mm_mul_ps(c[0], r2_0), r3_0));
+
+            auto x_f0 = _mm_mul_ps(x, f_0);
+            auto y_f0 = _mm_mul_ps(y, f_0);
+
+            auto r4_0 = _mm_mul_ps(c[3], _mm_add_ps(r2_0, _mm_mul_ps(two, _mm_mul_ps(x_f0, x_f0))));
+            auto d_x0 = _mm_add_ps(x_f0, _mm_add_ps(_mm_mul_ps(two, _mm_mul_ps(c[2], _mm_mul_ps(x_f0, y_f0))), r4_0));
+
+            auto r5_0 = _mm_mul_ps(c[2], _mm_add_ps(r2_0, _mm_mul_ps(two, _mm_mul_ps(y_f0, y_f0))));
+            auto d_y0 = _mm_add_ps(y_f0, _mm_add_ps(_mm_mul_ps(two, _mm_mul_ps(c[3], _mm_mul_ps(x_f0, y_f0))), r4_0));
+
+            *distorted_x = d_x0;
+            *distorted_y = d_y0;
+        }
+
+
+        // Same arithmetic as distorte_x_y<RS2_DISTORTION_MODIFIED_BROWN_CONRADY>, one pixel at a time
+        template<rs2_distortion dist>
+        inline void distorte_x_y(float & x, float & y, const rs2_intrinsics& to)
+        {
+        }
+        template<>
+        inline void distorte_x_y<RS2_DISTORTION_MODIFIED_BROWN_CONRADY>(float & x, float & y, const rs2_intrinsics& to)
+        {
+            auto c = to.coeffs;
+            float r2 = x * x + y * y;
+            float r3 = c[1] * (r2 * r2) + c[4] * (r2 * (r2 * r2));
+            float f = 1 + (c[0] * r2 + r3);
+            float xf = x * f;
+            float yf = y * f;
+            float r4 = c[3] * (r2 + 2 * (xf * xf));
+            x = xf + (2 * (c[2] * (xf * yf)) + r4);
+            y = yf + (2 * (c[3] * (xf * yf)) + r4);
+        }
+
+        // One pixel of get_texture_map_blocks, with identical results; for the pixels that do not fill a vector
+        template<rs2_distortion dist>
+        inline int2 get_texture_pixel(uint16_t z, float depth_scale, float map_x, float map_y,
+            const rs2_intrinsics& to, const rs2_extrinsics& from_to_other)
+        {
+            if (!z)
+                return { 0, 0 };
+
+            auto r = from_to_other.rotation;
+            auto t = from_to_other.translation;
+
+            float depth = static_cast<float>(z) * depth_scale;
+            float px = depth * map_x;
+            float py = depth * map_y;
+
+            float x = r[0] * px + (r[3] * py + (r[6] * depth + t[0]));
+            float y = r[1] * px + (r[4] * py + (r[7] * depth + t[1]));
+            float p_z = r[2] * px + (r[5] * py + (r[8] * depth + t[2]));
+            x = x / p_z;
+            y = y / p_z;
+
+            distorte_x_y<dist>(x, y, to);
+
+            x = x * to.fx + to.ppx;
+            y = y * to.fy + to.ppy;
+            // Rounded (and saturated) exactly like _mm_cvtps_epi32
+            return { _mm_cvtss_si32(_mm_set_ss(x + 0.5f)), _mm_cvtss_si32(_mm_set_ss(y + 0.5f)) };
+        }
+
+        // Returns the number of pixels processed, a multiple of 8
+        template<rs2_distortion dist>
+        inline size_t get_texture_map_blocks(const uint16_t * depth,
+            float depth_scale,
+            const size_t count,
+            const float * pre_compute_x, const float * pre_compute_y,
+            int2 * pixels,
+            const rs2_intrinsics& to,
+            const rs2_extrinsics& from_to_other)
+        {
+            //mask for shuffle
+            const __m128i mask0 = _mm_set_epi8((char)0xff, (char)0xff, (char)7, (char)6, (char)0xff, (char)0xff, (char)5, (char)4,
+                (char)0xff, (char)0xff, (char)3, (char)2, (char)0xff, (char)0xff, (char)1, (char)0);
+            const __m128i mask1 = _mm_set_epi8((char)0xff, (char)0xff, (char)15, (char)14, (char)0xff, (char)0xff, (char)13, (char)12,
+                (char)0xff, (char)0xff, (char)11, (char)10, (char)0xff, (char)0xff, (char)9, (char)8);
+
+            auto scale = _mm_set_ps1(depth_scale);
+
+            auto mapx = pre_compute_x;
+            auto mapy = pre_compute_y;
+
+            auto res = reinterpret_cast<__m128i*>(pixels);
+
+            __m128 r[9];
+            __m128 t[3];
+            __m128 c[5];
+
+            for (int i = 0; i < 9; ++i)
+            {
+                r[i] = _mm_set_ps1(from_to_other.rotation[i]);
+            }
+            for (int i = 0; i < 3; ++i)
+            {
+                t[i] = _mm_set_ps1(from_to_other.translation[i]);
+            }
+            for (int i = 0; i < 5; ++i)
+            {
+                c[i] = _mm_set_ps1(to.coeffs[i]);
+            }
+            auto zero = _mm_set_ps1(0);
+            auto fx = _mm_set_ps1(to.fx);
+            auto fy = _mm_set_ps1(to.fy);
+            auto ppx = _mm_set_ps1(to.ppx);
+            auto ppy = _mm_set_ps1(to.ppy);
+
+            const size_t size = count - count % 8;
+            for (size_t i = 0; i < size; i += 8)
+            {
+                auto x0 = _mm_loadu_ps(mapx + i);
+                auto x1 = _mm_loadu_ps(mapx + i + 4);
+
+                auto y0 = _mm_loadu_ps(mapy + i);
+                auto y1 = _mm_loadu_ps(mapy + i + 4);
+
+
+                __m128i d = _mm_loadu_si128((__m128i const*)(depth + i));        //d7 d7 d6 d6 d5 d5 d4 d4 d3 d3 d2 d2 d1 d1 d0 d0
+
+                                                                                //split the depth pixel to 2 registers of 4 floats each
+                __m128i d0 = _mm_shuffle_epi8(d, mask0);        // 00 00 d3 d3 00 00 d2 d2 00 00 d1 d1 00 00 d0 d0
+                __m128i d1 = _mm_shuffle_epi8(d, mask1);        // 00 00 d7 d7 00 00 d6 d6 00 00 d5 d5 00 00 d4 d4
+
+                __m128 depth0 = _mm_cvtepi32_ps(d0); //convert depth to float
+                __m128 depth1 = _mm_cvtepi32_ps(d1); //convert depth to float
+
+                depth0 = _mm_mul_ps(depth0, scale);
+                depth1 = _mm_mul_ps(depth1, scale);
+
+                auto p0x = _mm_mul_ps(depth0, x0);
+                auto p0y = _mm_mul_ps(depth0, y0);
+
+                auto p1x = _mm_mul_ps(depth1, x1);
+                auto p1y = _mm_mul_ps(depth1, y1);
+
+                auto p_x0 = _mm_add_ps(_mm_mul_ps(r[0], p0x), _mm_add_ps(_mm_mul_ps(r[3], p0y), _mm_add_ps(_mm_mul_ps(r[6], depth0), t[0])));
+                auto p_y0 = _mm_add_ps(_mm_mul_ps(r[1], p0x), _mm_add_ps(_mm_mul_ps(r[4], p0y), _mm_add_ps(_mm_mul_ps(r[7], depth0), t[1])));
+                auto p_z0 = _mm_add_ps(_mm_mul_ps(r[2], p0x), _mm_add_ps(_mm_mul_ps(r[5], p0y), _mm_add_ps(_mm_mul_ps(r[8], depth0), t[2])));
+
+                auto p_x1 = _mm_add_ps(_mm_mul_ps(r[0], p1x), _mm_add_ps(_mm_mul_ps(r[3], p1y), _mm_add_ps(_mm_mul_ps(r[6], depth1), t[0])));
+                auto p_y1 = _mm_add_ps(_mm_mul_ps(r[1], p1x), _mm_add_ps(_mm_mul_ps(r[4], p1y), _mm_add_ps(_mm_mul_ps(r[7], depth1), t[1])));
+                auto p_z1 = _mm_add_ps(_mm_mul_ps(r[2], p1x), _mm_add_ps(_mm_mul_ps(r[5], p1y), _mm_add_ps(_mm_mul_ps(r[8], depth1), t[2])));
+
+                p_x0 = _mm_div_ps(p_x0, p_z0);
+                p_y0 = _mm_div_ps(p_y0, p_z0);
+
+                p_x1 = _mm_div_ps(p_x1, p_z1);
+                p_y1 = _mm_div_ps(p_y1, p_z1);
+
+                distorte_x_y<dist>(p_x0, p_y0, &p_x0, &p_y0, to);
+                distorte_x_y<dist>(p_x1, p_y1, &p_x1, &p_y1, to);
+
+                //zero the x and y if z is zero
+                auto cmp = _mm_cmpneq_ps(depth0, zero);
+                p_x0 = _mm_and_ps(_mm_add_ps(_mm_mul_ps(p_x0, fx), ppx), cmp);
+                p_y0 = _mm_and_ps(_mm_add_ps(_mm_mul_ps(p_y0, fy), ppy), cmp);
+
+
+                p_x1 = _mm_add_ps(_mm_mul_ps(p_x1, fx), ppx);
+                p_y1 = _mm_add_ps(_mm_mul_ps(p_y1, fy), ppy);
+
+                cmp = _mm_cmpneq_ps(depth0, zero);
+                auto half = _mm_set_ps1(0.5);
+                auto u_round0 = _mm_and_ps(_mm_add_ps(p_x0, half), cmp);
+                auto v_round0 = _mm_and_ps(_mm_add_ps(p_y0, half), cmp);
+
+                auto uuvv1_0 = _mm_shuffle_ps(u_round0, v_round0, _MM_SHUFFLE(1, 0, 1, 0));
+                auto uuvv2_0 = _mm_shuffle_ps(u_round0, v_round0, _MM_SHUFFLE(3, 2, 3, 2));
+
+                auto res1_0 = _mm_shuffle_ps(uuvv1_0, uuvv1_0, _MM_SHUFFLE(3, 1, 2, 0));
+                auto res2_0 = _mm_shuffle_ps(uuvv2_0, uuvv2_0, _MM_SHUFFLE(3, 1, 2, 0));
+
+                auto res1_int0 = _mm_cvtps_epi32(res1_0);
+                auto res2_int0 = _mm_cvtps_epi32(res2_0);
+
+                _mm_storeu_si128(&res[0], res1_int0);
+                _mm_storeu_si128(&res[1], res2_int0);
+                res += 2;
+
+                cmp = _mm_cmpneq_ps(depth1, zero);
+                auto u_round1 = _mm_and_ps(_mm_add_ps(p_x1, half), cmp);
+                auto v_round1 = _mm_and_ps(_mm_add_ps(p_y1, half), cmp);
+
+                auto uuvv1_1 = _mm_shuffle_ps(u_round1, v_round1, _MM_SHUFFLE(1, 0, 1, 0));
+                auto uuvv2_1 = _mm_shuffle_ps(u_round1, v_round1, _MM_SHUFFLE(3, 2, 3, 2));
+
+                auto res1 = _mm_shuffle_ps(uuvv1_1, uuvv1_1, _MM_SHUFFLE(3, 1, 2, 0));
+                auto res2 = _mm_shuffle_ps(uuvv2_1, uuvv2_1, _MM_SHUFFLE(3, 1, 2, 0));
+
+                auto res1_int1 = _mm_cvtps_epi32(res1);
+                auto res2_int1 = _mm_cvtps_epi32(res2);
+
+                _mm_storeu_si128(&res[0], res1_int1);
+                _mm_storeu_si128(&res[1], res2_int1);
+                res += 2;
+            }
+            return size;
+        }
+    }
+
+    void get_texture_map_sse(const uint16_t* depth, float depth_scale, size_t count,
+        const float* map_x, const float* map_y, int2* pixels,
+        const rs2_intrinsics& to, const rs2_extrinsics& from_to_other, rs2_distortion dist)
+    {
+        size_t done;
+        switch (dist)
+        {
+        case RS2_DISTORTION_MODIFIED_BROWN_CONRADY:
+            done = get_texture_map_blocks<RS2_DISTORTION_MODIFIED_BROWN_CONRADY>(depth, depth_scale, count, map_x, map_y, pixels, to, from_to_other);
+            for (; done < count; ++done)
+                pixels[done] = get_texture_pixel<RS2_DISTORTION_MODIFIED_BROWN_CONRADY>(depth[done], depth_scale, map_x[done], map_y[done], to, from_to_other);
+            break;
+        default:
+            done = get_texture_map_blocks<RS2_DISTORTION_NONE>(depth, depth_scale, count, map_x, map_y, pixels, to, from_to_other);
+            for (; done < count; ++done)
+                pixels[done] = get_texture_pixel<RS2_DISTORTION_NONE>(depth[done], depth_scale, map_x[done], map_y[done], to, from_to_other);
+            break;
+        }
+    }
+}
+
+#endif // __SSSE3__
@@ -5,68 +5,103 @@
 
 #include "proc/align.h"
 
+#include <deque>
+#include <memory>
+
 namespace librealsense
 {
+    // Projects 'count' depth pixels, scaled by 'depth_scale' and positioned by the (x, y) ray maps,
+    // onto the 'to' image and writes the rounded pixel coordinates (0, 0 where there is no depth).
+    // 'dist' is the distortion model to apply: RS2_DISTORTION_MODIFIED_BROWN_CONRADY, or none.
+    // Only whole blocks of 8 pixels are processed, from the start; returns the number of pixels
+    // processed, leaving the rest to the caller. The results are identical to those of the SSE code.
+    size_t get_texture_map_avx2(const uint16_t* depth, float depth_scale, size_t count,
+        const float* map_x, const float* map_y, int2* pixels,
+        const rs2_intrinsics& to, const rs2_extrinsics& from_to_other, rs2_distortion dist);
+
+    // The same for all 'count' pixels, with SSE and then one pixel at a time for the pixels that do not
+    // fill a vector (see sse-align-texture-map.cpp)
+    void get_texture_map_sse(const uint16_t* depth, float depth_scale, size_t count,
+        const float* map_x, const float* map_y, int2* pixels,
+        const rs2_intrinsics& to, const rs2_extrinsics& from_to_other, rs2_distortion dist);
+
+    // The rays through the top-left and bottom-right corners of every depth pixel, which only depend
+    // on the depth intrinsics
+    struct depth_rays
+    {
+        explicit depth_rays(const rs2_intrinsics& depth);
+
+        const rs2_intrinsics depth;
+        std::vector<float> x_top_left, y_top_left;
+        std::vector<float> x_bottom_right, y_bottom_right;
+
+    private:
+        void compute(std::vector<float>& map_x, std::vector<float>& map_y, float offset);
+    };
+
+    // The tables for aligning one depth stream with one other stream: the depth rays, shared with
+    // the other transforms of the same depth intrinsics, the choice of corners for the resolutions
+    // at hand, and the projected pixels. The rotation and depth scale are applied per pixel rather
+    // than folded into the rays, so the results are bit-exact with the uncached computation.
     class image_transform
     {
     public:
 
-        image_transform(const rs2_intrinsics& from,
-            float depth_scale);
-
-        inline void align_depth_to_other(const uint16_t* z_pixels,
-            uint16_t* dest, int bpp,
-            const rs2_intrinsics& depth,
+        image_transform(std::shared_ptr<const depth_rays> rays,
+            float depth_scale,
             const rs2_intrinsics& to,
             const rs2_extrinsics& from_to_other);
 
+        // Whether the tables were computed for these streams
+        bool matches(const rs2_intrinsics& from, float depth_scale,
+            const rs2_intrinsics& to, const rs2_extrinsics& from_to_other) const;
+
+        const std::shared_ptr<const depth_rays>& get_rays() const { return _rays; }
+
+        inline void align_depth_to_other(const uint16_t* z_pixels, uint16_t* dest);
+
         inline void align_other_to_depth(const uint16_t* z_pixels,
             const byte* source,
-            byte* dest, int bpp, const rs2_intrinsics& to,
-            const rs2_extrinsics& from_to_other);
-
-        void pre_compute_x_y_map_corners();
+            byte* dest, int bpp);
 
     private:
 
-        const rs2_intrinsics _depth;
-        float _depth_scale;
+        const std::shared_ptr<const depth_rays> _rays;
+        const rs2_intrinsics& _depth;
+        const float _depth_scale;
+        const rs2_intrinsics _to;
+        const rs2_extrinsics _from_to_other;
+        const bool _use_avx2;
 
-        std::vector<float> _pre_compute_map_x_top_left;
-        std::vector<float> _pre_compute_map_y_top_left;
-        std::vector<float> _pre_compute_map_x_bottom_right;
-        std::vector<float> _pre_compute_map_y_bottom_right;
+        // Depth to other: whether the bottom-right corners are projected too (when the other image
+        // has the higher resolution), rather than filling a single pixel per depth pixel
+        bool _depth_to_other_corners;
+        // Other to depth: whether each depth pixel takes the other pixel under its bottom-right
+        // corner (when the other image has the lower resolution), rather than its top-left one
+        bool _other_to_depth_bottom_right;
 
         std::vector<int2> _pixel_top_left_int;
         std::vector<int2> _pixel_bottom_right_int;
 
-        void pre_compute_x_y_map(std::vector<float>& pre_compute_map_x,
-            std::vector<float>& pre_compute_map_y,
-            float offset = 0);
+        template<rs2_distortion dist>
+        void get_texture_map(const uint16_t* z_pixels,
+            const std::vector<float>& pre_compute_x,
+            const std::vector<float>& pre_compute_y,
+            std::vector<int2>& pixels);
 
         template<rs2_distortion dist = RS2_DISTORTION_NONE>
-        inline void align_depth_to_other_sse(const uint16_t* z_pixels,
-            uint16_t* dest, const rs2_intrinsics& depth,
-            const rs2_intrinsics& to,
-            const rs2_extrinsics& from_to_other);
+        inline void align_depth_to_other_sse(const uint16_t* z_pixels, uint16_t* dest);
 
         template<rs2_distortion dist = RS2_DISTORTION_NONE>
         inline void align_other_to_depth_sse(const uint16_t* z_pixels,
             const byte* source,
-            byte* dest, int bpp, const rs2_intrinsics& to,
-            const rs2_extrinsics& from_to_other);
-
-        inline void move_depth_to_other(const uint16_t* z_pixels,
-            uint16_t* dest, const rs2_intrinsics& to,
-            const std::vector<int2>& pixel_top_left_int,
-            const std::vector<int2>& pixel_bottom_right_int);
+            byte* dest, int bpp);
 
         template<class T >
         inline void move_other_to_depth(const uint16_t* z_pixels,
             const T* source,
-            T* dest, const rs2_intrinsics& to,
-            const std::vector<int2>& pixel_top_left_int,
-            const std::vector<int2>& pixel_bottom_right_int);
+            T* dest,
+            const std::vector<int2>& pixels);
 
     };
 
@@ -83,7 +118,13 @@ namespace librealsense
         void align_other_to_z(rs2::video_frame& aligned, const rs2::video_frame& depth, const rs2::video_frame& other, float z_scale) override;
 
     private:
-        std::shared_ptr<image_transform> _stream_transform;
+        // The transform for the given streams, from the cache or made (and cached) now
+        image_transform& get_transform(const rs2_intrinsics& from, float depth_scale,
+            const rs2_intrinsics& to, const rs2_extrinsics& from_to_other);
+
+        // A few, as each frameset may align several other streams; the most recently used first
+        static const size_t MAX_CACHED_TRANSFORMS = 4;
+        std::deque<std::shared_ptr<image_transform>> _transforms;
     };
 }
 #endif // __SSSE3__
@@ -0,0 +1,21 @@
+// License: Apache 2.0. See LICENSE file in root directory.
+// Copyright(c) 2021 Intel Corporation. All Rights Reserved.
+
+// The plain lookup of the colorizer; apart from the rest of it so that it can be tested against the
+// AVX2 code without the library
+
+#include "sse-colorizer.h"
+
+namespace librealsense
+{
+    void colorize_scalar(const uint16_t * depth, size_t count, const uint32_t * lut, uint8_t * rgb)
+    {
+        for (size_t i = 0; i < count; ++i)
+        {
+            auto color = lut[depth[i]];
+            rgb[i * 3 + 0] = uint8_t(color);
+            rgb[i * 3 + 1] = uint8_t(color >> 8);
+            rgb[i * 3 + 2] = uint8_t(color >> 16);
+        }
+    }
+}
@@ -0,0 +1,19 @@
+// License: Apache 2.0. See LICENSE file in root directory.
+// Copyright(c) 2021 Intel Corporation. All Rights Reserved.
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+namespace librealsense
+{
+    // Colors 'count' depth pixels through a 65536-entry lookup table of RGB values packed with R in
+    // the low byte, writing packed RGB8 pixels. The table is read with 8-pixel gathers.
+    // Only whole blocks of 8 pixels are processed, from the start; returns the number of pixels
+    // processed, leaving the rest to the caller.
+    size_t colorize_avx2(const uint16_t * depth, size_t count, const uint32_t * lut, uint8_t * rgb);
+
+    // The same, one pixel at a time: all 'count' pixels are processed
+    void colorize_scalar(const uint16_t * depth, size_t count, const uint32_t * lut, uint8_t * rgb);
+}
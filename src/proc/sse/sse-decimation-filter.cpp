@@ -0,0 +1,137 @@
+// License: Apache 2.0. See LICENSE file in root directory.
+// Copyright(c) 2021 Intel Corporation. All Rights Reserved.
+
+#include "sse-decimation-filter.h"
+
+#ifdef __SSSE3__
+#include <tmmintrin.h> // For SSSE3 intrinsics
+#endif
+
+namespace librealsense
+{
+#ifdef __SSSE3__
+    namespace
+    {
+        const size_t sse_lanes_u16 = 8;
+
+        // There is no unsigned 16-bit min/max before SSE4.1. The values are therefore decremented,
+        // which wraps the (invalid) zeros around to the largest value so they sort last, and moved
+        // into the signed range, where the order is preserved.
+        inline __m128i to_sortable(__m128i v)
+        {
+            return _mm_xor_si128(_mm_sub_epi16(v, _mm_set1_epi16(1)), _mm_set1_epi16(short(0x8000)));
+        }
+
+        inline __m128i from_sortable(__m128i v)
+        {
+            return _mm_add_epi16(_mm_xor_si128(v, _mm_set1_epi16(short(0x8000))), _mm_set1_epi16(1));
+        }
+
+        inline void sort2(__m128i & a, __m128i & b)
+        {
+            __m128i t = _mm_min_epi16(a, b);
+            b = _mm_max_epi16(a, b);
+            a = t;
+        }
+
+        inline void sort_network(__m128i (&v)[4])
+        {
+            sort2(v[0], v[1]); sort2(v[2], v[3]);
+            sort2(v[0], v[2]); sort2(v[1], v[3]);
+            sort2(v[1], v[2]);
+        }
+
+        inline void sort_network(__m128i (&v)[9])
+        {
+            sort2(v[0], v[3]); sort2(v[1], v[7]); sort2(v[2], v[5]); sort2(v[4], v[8]);
+            sort2(v[0], v[7]); sort2(v[2], v[4]); sort2(v[3], v[8]); sort2(v[5], v[6]);
+            sort2(v[0], v[2]); sort2(v[1], v[3]); sort2(v[4], v[5]); sort2(v[7], v[8]);
+            sort2(v[1], v[4]); sort2(v[3], v[6]); sort2(v[5], v[7]);
+            sort2(v[0], v[1]); sort2(v[2], v[4]); sort2(v[3], v[5]); sort2(v[6], v[8]);
+            sort2(v[2], v[3]); sort2(v[4], v[5]); sort2(v[6], v[7]);
+            sort2(v[1], v[2]); sort2(v[3], v[4]); sort2(v[5], v[6]);
+        }
+
+        // Shuffle masks picking the pixels m, m + S, m + 2S... out of S consecutive registers of a
+        // row, one mask per register
+        template<int S>
+        void gather_masks(__m128i (&masks)[S][S])
+        {
+            for (int m = 0; m < S; ++m)
+                for (int r = 0; r < S; ++r)
+                {
+                    alignas(16) char bytes[16];
+                    for (int i = 0; i < 8; ++i)
+                    {
+                        int idx = S * i + m;
+                        bool here = idx / 8 == r;
+                        bytes[2 * i] = here ? char(2 * (idx % 8)) : char(0x80);
+                        bytes[2 * i + 1] = here ? char(2 * (idx % 8) + 1) : char(0x80);
+                    }
+                    masks[m][r] = _mm_load_si128(reinterpret_cast<const __m128i*>(bytes));
+                }
+        }
+
+        template<int S>
+        size_t median(const uint16_t * in, size_t width_in, size_t width_out, uint16_t * out)
+        {
+            const int N = S * S;
+            __m128i masks[S][S];
+            gather_masks<S>(masks);
+
+            const __m128i zero = _mm_setzero_si128();
+            const size_t blocks = width_out / sse_lanes_u16;
+            for (size_t b = 0; b < blocks; ++b)
+            {
+                __m128i v[N];
+                __m128i valid = _mm_set1_epi16(N);
+                for (int n = 0; n < S; ++n)
+                {
+                    auto row = reinterpret_cast<const __m128i*>(in + n * width_in + b * sse_lanes_u16 * S);
+                    __m128i regs[S];
+                    for (int r = 0; r < S; ++r)
+                        regs[r] = _mm_loadu_si128(row + r);
+
+                    for (int m = 0; m < S; ++m)
+                    {
+                        __m128i p = _mm_shuffle_epi8(regs[0], masks[m][0]);
+                        for (int r = 1; r < S; ++r)
+                            p = _mm_or_si128(p, _mm_shuffle_epi8(regs[r], masks[m][r]));
+
+                        valid = _mm_add_epi16(valid, _mm_cmpeq_epi16(p, zero));
+                        v[n * S + m] = to_sortable(p);
+                    }
+                }
+
+                sort_network(v);
+
+                // The median of k valid values is the ((k - 1) / 2)-th smallest. With none, the
+                // smallest is a wrapped-around zero, and unwraps back to zero.
+                __m128i res = v[0];
+                for (int k = 1; k <= (N - 1) / 2; ++k)
+                {
+                    __m128i more = _mm_cmpgt_epi16(valid, _mm_set1_epi16(short(2 * k)));
+                    res = _mm_or_si128(_mm_and_si128(more, v[k]), _mm_andnot_si128(more, res));
+                }
+                _mm_storeu_si128(reinterpret_cast<__m128i*>(out + b * sse_lanes_u16), from_sortable(res));
+            }
+            return blocks * sse_lanes_u16;
+        }
+    }
+
+    size_t decimate_depth_median_sse(const uint16_t * in, size_t width_in, size_t scale, size_t width_out, uint16_t * out)
+    {
+        switch (scale)
+        {
+        case 2: return median<2>(in, width_in, width_out, out);
+        case 3: return median<3>(in, width_in, width_out, out);
+        default: return 0;
+        }
+    }
+#else
+    size_t decimate_depth_median_sse(const uint16_t * in, size_t width_in, size_t scale, size_t width_out, uint16_t * out)
+    {
+        return 0;
+    }
+#endif
+}
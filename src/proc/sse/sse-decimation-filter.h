@@ -0,0 +1,23 @@
+// License: Apache 2.0. See LICENSE file in root directory.
+// Copyright(c) 2021 Intel Corporation. All Rights Reserved.
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+namespace librealsense
+{
+    // Vectorized median decimation of one row of output pixels, for scales 2 and 3.
+    // Each output pixel is the median of the non-zero depth values in its scale x scale patch, the
+    // lower of the two middle values when there is an even number of them, or 0 when there are none;
+    // the same as decimation_filter's scalar code. 'in' points to the first of the 'scale' input
+    // rows, 'width_out' is the number of output pixels in the row.
+    // Each SIMD lane computes one output pixel with a branch-free sorting network, zeros being
+    // sorted to the end. The kernels process whole blocks of 8 (SSE) or 16 (AVX2) output pixels,
+    // starting from the left, and return the number of pixels processed; the remaining pixels are
+    // left for the scalar code.
+
+    size_t decimate_depth_median_sse(const uint16_t * in, size_t width_in, size_t scale, size_t width_out, uint16_t * out);
+    size_t decimate_depth_median_avx2(const uint16_t * in, size_t width_in, size_t scale, size_t width_out, uint16_t * out);
+}
@@ -0,0 +1,143 @@
+// License: Apache 2.0. See LICENSE file in root directory.
+// Copyright(c) 2021 Intel Corporation. All Rights Reserved.
+
+#include "sse-format-converters.h"
+
+#ifdef __SSSE3__
+#include <tmmintrin.h> // For SSSE3 intrinsics
+#endif
+
+namespace librealsense
+{
+#ifdef __SSSE3__
+    namespace
+    {
+        inline __m128i load(const void * p) { return _mm_loadu_si128(reinterpret_cast<const __m128i*>(p)); }
+        inline void store(void * p, __m128i v) { _mm_storeu_si128(reinterpret_cast<__m128i*>(p), v); }
+    }
+
+    size_t split_y8i_sse(const uint8_t * in, size_t count, uint8_t * left, uint8_t * right)
+    {
+        const __m128i evens_odds = _mm_setr_epi8(0, 2, 4, 6, 8, 10, 12, 14, 1, 3, 5, 7, 9, 11, 13, 15);
+        const size_t blocks = count / 16;
+        for (size_t b = 0; b < blocks; ++b)
+        {
+            __m128i lr0 = _mm_shuffle_epi8(load(in + b * 32), evens_odds);
+            __m128i lr1 = _mm_shuffle_epi8(load(in + b * 32 + 16), evens_odds);
+            store(left + b * 16, _mm_unpacklo_epi64(lr0, lr1));
+            store(right + b * 16, _mm_unpackhi_epi64(lr0, lr1));
+        }
+        return blocks * 16;
+    }
+
+    size_t split_y16i_sse(const uint16_t * in, size_t count, uint16_t * left, uint16_t * right)
+    {
+        const __m128i evens_odds = _mm_setr_epi8(0, 1, 4, 5, 8, 9, 12, 13, 2, 3, 6, 7, 10, 11, 14, 15);
+        const size_t blocks = count / 8;
+        for (size_t b = 0; b < blocks; ++b)
+        {
+            __m128i lr0 = _mm_shuffle_epi8(load(in + b * 16), evens_odds);
+            __m128i lr1 = _mm_shuffle_epi8(load(in + b * 16 + 8), evens_odds);
+            store(left + b * 8, _mm_slli_epi16(_mm_unpacklo_epi64(lr0, lr1), 6));
+            store(right + b * 8, _mm_slli_epi16(_mm_unpackhi_epi64(lr0, lr1), 6));
+        }
+        return blocks * 8;
+    }
+
+    size_t split_y12i_sse(const uint8_t * in, size_t count, uint16_t * left, uint16_t * right)
+    {
+        // A pixel is 3 bytes: the right 8 LSBs, the right 4 MSBs with the left 4 LSBs above them,
+        // then the left 8 MSBs. The words made of bytes 0-1 and 1-2 of each pixel hold the right
+        // value in their 12 LSBs and the left one in their 12 MSBs.
+        // 8 pixels (24 bytes) are read as bytes 0-15 and 8-23, the first 4 from each.
+        const char z = char(0x80);
+        const __m128i right_lo = _mm_setr_epi8(0, 1, 3, 4, 6, 7, 9, 10, z, z, z, z, z, z, z, z);
+        const __m128i right_hi = _mm_setr_epi8(z, z, z, z, z, z, z, z, 4, 5, 7, 8, 10, 11, 13, 14);
+        const __m128i left_lo = _mm_setr_epi8(1, 2, 4, 5, 7, 8, 10, 11, z, z, z, z, z, z, z, z);
+        const __m128i left_hi = _mm_setr_epi8(z, z, z, z, z, z, z, z, 5, 6, 8, 9, 11, 12, 14, 15);
+        const __m128i mask12 = _mm_set1_epi16(0x0fff);
+
+        const size_t blocks = count / 8;
+        for (size_t b = 0; b < blocks; ++b)
+        {
+            __m128i p0 = load(in + b * 24);
+            __m128i p1 = load(in + b * 24 + 8);
+            __m128i r = _mm_and_si128(_mm_or_si128(_mm_shuffle_epi8(p0, right_lo), _mm_shuffle_epi8(p1, right_hi)), mask12);
+            __m128i l = _mm_srli_epi16(_mm_or_si128(_mm_shuffle_epi8(p0, left_lo), _mm_shuffle_epi8(p1, left_hi)), 4);
+
+            // 10-bit to 16-bit, as x * 64 + x / 16
+            store(left + b * 8, _mm_or_si128(_mm_slli_epi16(l, 6), _mm_srli_epi16(l, 4)));
+            store(right + b * 8, _mm_or_si128(_mm_slli_epi16(r, 6), _mm_srli_epi16(r, 4)));
+        }
+        return blocks * 8;
+    }
+
+    size_t y10_to_y8_sse(const uint16_t * in, size_t count, uint8_t * out)
+    {
+        // The low byte is kept, as by the scalar conversion, so there is nothing to saturate
+        const __m128i low_byte = _mm_set1_epi16(0xff);
+        const size_t blocks = count / 16;
+        for (size_t b = 0; b < blocks; ++b)
+        {
+            __m128i p0 = _mm_and_si128(_mm_srli_epi16(load(in + b * 16), 2), low_byte);
+            __m128i p1 = _mm_and_si128(_mm_srli_epi16(load(in + b * 16 + 8), 2), low_byte);
+            store(out + b * 16, _mm_packus_epi16(p0, p1));
+        }
+        return blocks * 16;
+    }
+
+    size_t y10_to_y16_sse(const uint16_t * in, size_t count, uint16_t * out)
+    {
+        const size_t blocks = count / 8;
+        for (size_t b = 0; b < blocks; ++b)
+            store(out + b * 8, _mm_slli_epi16(load(in + b * 8), 6));
+        return blocks * 8;
+    }
+
+    size_t unpack_y10bpack_sse(const uint8_t * in, size_t count, uint16_t * out)
+    {
+        // Each output word is first made of the byte with the pixel's 8 MSBs, above the byte with
+        // the LSBs of its group of 4; those are then moved to bits 6-7 by a multiplication (there is
+        // no per-lane shift) and masked. 16 pixels (20 bytes) are read as bytes 0-15 and 4-19.
+        const __m128i group01 = _mm_setr_epi8(4, 0, 4, 1, 4, 2, 4, 3, 9, 5, 9, 6, 9, 7, 9, 8);
+        const __m128i group23 = _mm_setr_epi8(10, 6, 10, 7, 10, 8, 10, 9, 15, 11, 15, 12, 15, 13, 15, 14);
+        const __m128i lsb_shift = _mm_setr_epi16(64, 16, 4, 1, 64, 16, 4, 1);
+        const __m128i msbs = _mm_set1_epi16(short(0xff00));
+        const __m128i lsbs = _mm_set1_epi16(0x00c0);
+
+        const size_t blocks = count / 16;
+        for (size_t b = 0; b < blocks; ++b)
+        {
+            __m128i w0 = _mm_shuffle_epi8(load(in + b * 20), group01);
+            __m128i w1 = _mm_shuffle_epi8(load(in + b * 20 + 4), group23);
+            __m128i l0 = _mm_and_si128(_mm_mullo_epi16(_mm_andnot_si128(msbs, w0), lsb_shift), lsbs);
+            __m128i l1 = _mm_and_si128(_mm_mullo_epi16(_mm_andnot_si128(msbs, w1), lsb_shift), lsbs);
+            store(out + b * 16, _mm_or_si128(_mm_and_si128(w0, msbs), l0));
+            store(out + b * 16 + 8, _mm_or_si128(_mm_and_si128(w1, msbs), l1));
+        }
+        return blocks * 16;
+    }
+
+    size_t bgr_to_rgb_sse(const uint8_t * in, size_t count, uint8_t * out)
+    {
+        // 5 pixels (15 bytes) per register. The 16th byte stored is rewritten by the next block,
+        // or by the caller after the last one, so blocks are only processed while the loads and
+        // stores stay within the image.
+        const __m128i swap = _mm_setr_epi8(2, 1, 0, 5, 4, 3, 8, 7, 6, 11, 10, 9, 14, 13, 12, 15);
+        if (count * 3 < 16)
+            return 0;
+        const size_t blocks = (count * 3 - 16) / 15 + 1;
+        for (size_t b = 0; b < blocks; ++b)
+            store(out + b * 15, _mm_shuffle_epi8(load(in + b * 15), swap));
+        return blocks * 5;
+    }
+#else
+    size_t split_y8i_sse(const uint8_t *, size_t, uint8_t *, uint8_t *) { return 0; }
+    size_t split_y16i_sse(const uint16_t *, size_t, uint16_t *, uint16_t *) { return 0; }
+    size_t split_y12i_sse(const uint8_t *, size_t, uint16_t *, uint16_t *) { return 0; }
+    size_t y10_to_y8_sse(const uint16_t *, size_t, uint8_t *) { return 0; }
+    size_t y10_to_y16_sse(const uint16_t *, size_t, uint16_t *) { return 0; }
+    size_t unpack_y10bpack_sse(const uint8_t *, size_t, uint16_t *) { return 0; }
+    size_t bgr_to_rgb_sse(const uint8_t *, size_t, uint8_t *) { return 0; }
+#endif
+}
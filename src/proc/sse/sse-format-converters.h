@@ -0,0 +1,39 @@
+// License: Apache 2.0. See LICENSE file in root directory.
+// Copyright(c) 2021 Intel Corporation. All Rights Reserved.
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+namespace librealsense
+{
+    // Vectorized pixel-format conversions, for the kernels of format-converter-kernels.h, which
+    // define the exact results (the scalar code there).
+    // The kernels process whole blocks of pixels, starting from the first, and return the number
+    // of pixels processed; the remaining pixels are left for the scalar code.
+
+    // Y8I: splits interleaved left/right 8-bit pixels
+    size_t split_y8i_sse(const uint8_t * in, size_t count, uint8_t * left, uint8_t * right);
+    size_t split_y8i_avx2(const uint8_t * in, size_t count, uint8_t * left, uint8_t * right);
+
+    // Y16I: splits interleaved left/right 10-bit pixels, moving the bits to the MSBs
+    size_t split_y16i_sse(const uint16_t * in, size_t count, uint16_t * left, uint16_t * right);
+    size_t split_y16i_avx2(const uint16_t * in, size_t count, uint16_t * left, uint16_t * right);
+
+    // Y12I: splits interleaved left/right pixels packed in 3 bytes, scaling them to 16 bits
+    size_t split_y12i_sse(const uint8_t * in, size_t count, uint16_t * left, uint16_t * right);
+
+    // 10-bit pixels in 16 bits (INVI, INZI infrared) to 8 bits, or with the bits moved to the MSBs
+    size_t y10_to_y8_sse(const uint16_t * in, size_t count, uint8_t * out);
+    size_t y10_to_y8_avx2(const uint16_t * in, size_t count, uint8_t * out);
+    size_t y10_to_y16_sse(const uint16_t * in, size_t count, uint16_t * out);
+    size_t y10_to_y16_avx2(const uint16_t * in, size_t count, uint16_t * out);
+
+    // W10: 4 pixels packed in 5 bytes (their 8 MSBs, then their 2 LSBs) to 16 bits, in the MSBs
+    size_t unpack_y10bpack_sse(const uint8_t * in, size_t count, uint16_t * out);
+    size_t unpack_y10bpack_avx2(const uint8_t * in, size_t count, uint16_t * out);
+
+    // Swaps the first and last bytes of 3-byte pixels
+    size_t bgr_to_rgb_sse(const uint8_t * in, size_t count, uint8_t * out);
+}
@@ -6,6 +6,29 @@
 
 namespace librealsense
 {
+    // Deprojects 'count' depth pixels, scaled by 'depth_scale' and positioned by the (x, y) ray maps,
+    // into packed (x, y, z) points.
+    // Only whole blocks of 8 pixels are processed, from the start; returns the number of pixels
+    // processed, leaving the rest to the caller. The results are identical to those of the SSE code.
+    size_t deproject_depth_avx2(const uint16_t* depth, float depth_scale, size_t count,
+        const float* map_x, const float* map_y, float3* points);
+
+    // Projects 'count' points onto the 'other' image, writing the pixel coordinates and the texture
+    // coordinates (the pixel normalized by the image size); both are 0 where the point has no depth.
+    // Implements the distortion models of get_texture_map_sse(), with the same results and the same
+    // block-of-8 contract as deproject_depth_avx2().
+    size_t get_texture_map_avx2(const float3* points, size_t count,
+        const rs2_intrinsics& other, const rs2_extrinsics& extr,
+        float2* texture_map, float2* pixels);
+
+    // The SSE deprojection and texture mapping, of all 'count' pixels or points: whole vectors with SSE,
+    // then one at a time (see sse-pointcloud-kernels.cpp)
+    void deproject_depth_sse(const uint16_t* depth, float depth_scale, size_t count,
+        const float* map_x, const float* map_y, float3* points);
+    void get_texture_map_sse(const float3* points, size_t count,
+        const rs2_intrinsics& other, const rs2_extrinsics& extr,
+        float2* texture_map, float2* pixels);
+
     class pointcloud_sse : public pointcloud
     {
     public:
@@ -36,6 +59,7 @@ namespace librealsense
 
         std::vector<float> _pre_compute_map_x;
         std::vector<float> _pre_compute_map_y;
+        bool _use_avx2;
 
         void pre_compute_x_y_map();
     };
@@ -0,0 +1,344 @@
+// License: Apache 2.0. See LICENSE file in root directory.
+// Copyright(c) 2021 Intel Corporation. All Rights Reserved.
+
+#include "sse-spatial-filter.h"
+#include <librealsense2/utilities/concurrency/parallel-for.h>
+
+#include <cmath>
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#define LRS_SPATIAL_SSE
+#include <emmintrin.h> // For SSE2 intrinsics
+#endif
+
+namespace librealsense
+{
+#ifdef LRS_SPATIAL_SSE
+    namespace
+    {
+        const size_t sse_lanes_u16 = 8;
+        const size_t sse_lanes_fp = 4;
+
+        inline __m128i select(__m128i mask, __m128i a, __m128i b)
+        {
+            return _mm_or_si128(_mm_and_si128(mask, a), _mm_andnot_si128(mask, b));
+        }
+
+        inline __m128 select(__m128 mask, __m128 a, __m128 b)
+        {
+            return _mm_or_ps(_mm_and_ps(mask, a), _mm_andnot_ps(mask, b));
+        }
+
+        // (uint16_t)(x * alpha + y * (1 - alpha) + 0.5f), computed in float exactly as the scalar code does
+        inline __m128i blend_u16(__m128i x, __m128i y, __m128 alpha, __m128 one_minus_alpha)
+        {
+            const __m128i zero = _mm_setzero_si128();
+            const __m128 round = _mm_set1_ps(0.5f);
+
+            __m128 xl = _mm_cvtepi32_ps(_mm_unpacklo_epi16(x, zero));
+            __m128 xh = _mm_cvtepi32_ps(_mm_unpackhi_epi16(x, zero));
+            __m128 yl = _mm_cvtepi32_ps(_mm_unpacklo_epi16(y, zero));
+            __m128 yh = _mm_cvtepi32_ps(_mm_unpackhi_epi16(y, zero));
+
+            __m128i lo = _mm_cvttps_epi32(_mm_add_ps(_mm_add_ps(_mm_mul_ps(xl, alpha), _mm_mul_ps(yl, one_minus_alpha)), round));
+            __m128i hi = _mm_cvttps_epi32(_mm_add_ps(_mm_add_ps(_mm_mul_ps(xh, alpha), _mm_mul_ps(yh, one_minus_alpha)), round));
+
+            // No unsigned 32->16 pack before SSE4.1: shift into signed range, pack, shift back
+            const __m128i bias32 = _mm_set1_epi32(0x8000);
+            const __m128i bias16 = _mm_set1_epi16(short(0x8000));
+            return _mm_xor_si128(_mm_packs_epi32(_mm_sub_epi32(lo, bias32), _mm_sub_epi32(hi, bias32)), bias16);
+        }
+
+        // Mask of the lanes where |a - b| < delta
+        inline __m128i close_u16(__m128i a, __m128i b, __m128i delta)
+        {
+            __m128i diff = _mm_or_si128(_mm_subs_epu16(a, b), _mm_subs_epu16(b, a));
+            return _mm_xor_si128(_mm_cmpeq_epi16(_mm_subs_epu16(delta, diff), _mm_setzero_si128()), _mm_set1_epi32(-1));
+        }
+    }
+
+    size_t spatial_filter_vertical_sse(uint16_t * image, size_t width, size_t height, float alpha, uint16_t delta_z)
+    {
+        const int blocks = int(width / sse_lanes_u16);
+        if (height < 2)
+            return 0;
+
+        const __m128 a = _mm_set1_ps(alpha);
+        const __m128 one_minus_a = _mm_set1_ps(1.f - alpha);
+        const __m128i delta = _mm_set1_epi16(short(delta_z));
+        const __m128i zero = _mm_setzero_si128();
+
+        parallel_for(blocks, [&](size_t first_block, size_t end_block)
+        {
+            for (int b = int(first_block); b < int(end_block); ++b)
+            {
+                uint16_t * col = image + b * sse_lanes_u16;
+
+                // top to bottom: no validity check, smooth towards the (already filtered) row above
+                __m128i above = _mm_loadu_si128((const __m128i *)col);
+                for (size_t v = 1; v < height; ++v)
+                {
+                    __m128i * p = (__m128i *)(col + v * width);
+                    __m128i cur = _mm_loadu_si128(p);
+                    cur = select(close_u16(above, cur, delta), blend_u16(cur, above, a, one_minus_a), cur);
+                    _mm_storeu_si128(p, cur);
+                    above = cur;
+                }
+
+                // bottom to top: both pixels must be valid
+                __m128i below = above;
+                for (size_t v = height - 1; v-- > 0;)
+                {
+                    __m128i * p = (__m128i *)(col + v * width);
+                    __m128i cur = _mm_loadu_si128(p);
+                    __m128i invalid = _mm_or_si128(_mm_cmpeq_epi16(cur, zero), _mm_cmpeq_epi16(below, zero));
+                    __m128i update = _mm_andnot_si128(invalid, close_u16(cur, below, delta));
+                    cur = select(update, blend_u16(cur, below, a, one_minus_a), cur);
+                    _mm_storeu_si128(p, cur);
+                    below = cur;
+                }
+            }
+        });
+        return blocks * sse_lanes_u16;
+    }
+
+    size_t spatial_filter_vertical_sse(float * image, size_t width, size_t height, float alpha, float delta_z)
+    {
+        const int blocks = int(width / sse_lanes_fp);
+        if (height < 2)
+            return 0;
+
+        const __m128 a = _mm_set1_ps(alpha);
+        const __m128 one_minus_a = _mm_set1_ps(1.f - alpha);
+        const __m128 dz = _mm_set1_ps(delta_z);
+        const __m128 neg_dz = _mm_set1_ps(-delta_z);
+        const __m128i zero = _mm_setzero_si128();
+
+        // Each lane runs the scalar state machine: a pixel is valid when its bit pattern is positive,
+        // and it is smoothed only when it and the previous (unfiltered) pixel are valid and close
+        auto step = [&](float * p, __m128 & state, __m128 & previous)
+        {
+            __m128 innovation = _mm_loadu_ps(p);
+            __m128 valid = _mm_castsi128_ps(_mm_and_si128(
+                _mm_cmpgt_epi32(_mm_castps_si128(innovation), zero),
+                _mm_cmpgt_epi32(_mm_castps_si128(previous), zero)));
+            __m128 delta = _mm_sub_ps(previous, innovation);
+            __m128 update = _mm_and_ps(valid, _mm_and_ps(_mm_cmplt_ps(delta, dz), _mm_cmpgt_ps(delta, neg_dz)));
+            __m128 filtered = _mm_add_ps(_mm_mul_ps(innovation, a), _mm_mul_ps(state, one_minus_a));
+            state = select(update, filtered, innovation);
+            _mm_storeu_ps(p, state);
+            previous = innovation;
+        };
+
+        parallel_for(blocks, [&](size_t first_block, size_t end_block)
+        {
+            for (int b = int(first_block); b < int(end_block); ++b)
+            {
+                float * col = image + b * sse_lanes_fp;
+
+                __m128 state = _mm_loadu_ps(col);
+                __m128 previous = state;
+                for (size_t v = 1; v < height; ++v)
+                    step(col + v * width, state, previous);
+
+                state = previous = _mm_loadu_ps(col + (height - 1) * width);
+                for (size_t v = height - 1; v-- > 0;)
+                    step(col + v * width, state, previous);
+            }
+        });
+        return blocks * sse_lanes_fp;
+    }
+#else
+    size_t spatial_filter_vertical_sse(uint16_t *, size_t, size_t, float, uint16_t) { return 0; }
+    size_t spatial_filter_vertical_sse(float *, size_t, size_t, float, float) { return 0; }
+#endif
+
+    void spatial_filter_vertical_scalar(uint16_t * image, size_t width, size_t height, size_t first, float alpha, uint16_t delta_z)
+    {
+        size_t v{}, u{};
+
+        // Filtering integer values requires round-up to the nearest discrete value
+        const float round = 0.5f;
+        // define invalid range
+        const uint16_t valid_threshold = 1;
+
+        // we'll do one row at a time, top to bottom, then bottom to top
+
+        // top to bottom
+
+        uint16_t *im = image;
+        uint16_t im0{};
+        uint16_t imw{};
+        for (v = 1; v < height; v++)
+        {
+            im = image + (v - 1) * width + first;
+            for (u = first; u < width; u++)
+            {
+                im0 = im[0];
+                imw = im[width];
+
+                //if ((fabs(im0) >= valid_threshold) && (fabs(imw) >= valid_threshold))
+                {
+                    uint16_t diff = static_cast<uint16_t>(fabs(im0 - imw));
+                    if (diff < delta_z)
+                    {
+                        float filtered = imw * alpha + im0 * (1.f - alpha);
+                        im[width] = static_cast<uint16_t>(filtered + round);
+                    }
+                }
+                im += 1;
+            }
+        }
+
+        // bottom to top
+        for (v = 1; v < height; v++)
+        {
+            im = image + (height - 1 - v) * width + first;
+            for (u = first; u < width; u++)
+            {
+                im0 = im[0];
+                imw = im[width];
+
+                if ((fabs(im0) >= valid_threshold) && (fabs(imw) >= valid_threshold))
+                {
+                    uint16_t diff = static_cast<uint16_t>(fabs(im0 - imw));
+                    if (diff < delta_z)
+                    {
+                        float filtered = im0 * alpha + imw * (1.f - alpha);
+                        im[0] = static_cast<uint16_t>(filtered + round);
+                    }
+                }
+                im += 1;
+            }
+        }
+    }
+
+    void spatial_filter_vertical_scalar(float * image, size_t width, size_t height, size_t first, float alpha, float delta_z)
+    {
+        int v, u;
+
+        // we'll do one column at a time, top to bottom, bottom to top, left to right
+
+        for (u = int(first); u < int(width);) {
+
+            float *im = image + u;
+            float state = im[0];
+            float previousInnovation = state;
+
+            v = int(height) - 1;
+            im += width;
+            float innovation = *im;
+
+            if (!(*(int*)&previousInnovation > 0))
+                goto CurrentlyInvalidTB;
+            // else fall through
+
+        CurrentlyValidTB:
+            for (;;) {
+                if (*(int*)&innovation > 0) {
+                    float delta = previousInnovation - innovation;
+                    bool smallDifference = delta < delta_z && delta > -delta_z;
+
+                    if (smallDifference) {
+                        float filtered = innovation * alpha + state * (1.0f - alpha);
+                        *im = state = filtered;
+                    }
+                    else {
+                        state = innovation;
+                    }
+                    v--;
+                    if (v <= 0)
+                        goto DoneTB;
+                    previousInnovation = innovation;
+                    im += width;
+                    innovation = *im;
+                }
+                else {  // switch to CurrentlyInvalid state
+                    v--;
+                    if (v <= 0)
+                        goto DoneTB;
+                    previousInnovation = innovation;
+                    im += width;
+                    innovation = *im;
+                    goto CurrentlyInvalidTB;
+                }
+            }
+
+        CurrentlyInvalidTB:
+            for (;;) {
+                v--;
+                if (v <= 0)
+                    goto DoneTB;
+                if (*(int*)&innovation > 0) { // switch to CurrentlyValid state
+                    previousInnovation = state = innovation;
+                    im += width;
+                    innovation = *im;
+                    goto CurrentlyValidTB;
+                }
+                else {
+                    im += width;
+                    innovation = *im;
+                }
+            }
+        DoneTB:
+
+            im = image + u + (height - 2) * width;
+            state = im[width];
+            previousInnovation = state;
+            innovation = *im;
+            v = int(height) - 1;
+            if (!(*(int*)&previousInnovation > 0))
+                goto CurrentlyInvalidBT;
+            // else fall through
+        CurrentlyValidBT:
+            for (;;) {
+                if (*(int*)&innovation > 0) {
+                    float delta = previousInnovation - innovation;
+                    bool smallDifference = delta < delta_z && delta > -delta_z;
+
+                    if (smallDifference) {
+                        float filtered = innovation * alpha + state * (1.0f - alpha);
+                        *im = state = filtered;
+                    }
+                    else {
+                        state = innovation;
+                    }
+                    v--;
+                    if (v <= 0)
+                        goto DoneBT;
+                    previousInnovation = innovation;
+                    im -= width;
+                    innovation = *im;
+                }
+                else {  // switch to CurrentlyInvalid state
+                    v--;
+                    if (v <= 0)
+                        goto DoneBT;
+                    previousInnovation = innovation;
+                    im -= width;
+                    innovation = *im;
+                    goto CurrentlyInvalidBT;
+                }
+            }
+
+        CurrentlyInvalidBT:
+            for (;;) {
+                v--;
+                if (v <= 0)
+                    goto DoneBT;
+                if (*(int*)&innovation > 0) { // switch to CurrentlyValid state
+                    previousInnovation = state = innovation;
+                    im -= width;
+                    innovation = *im;
+                    goto CurrentlyValidBT;
+                }
+                else {
+                    im -= width;
+                    innovation = *im;
+                }
+            }
+        DoneBT:
+            u++;
+        }
+    }
+}
@@ -0,0 +1,27 @@
+// License: Apache 2.0. See LICENSE file in root directory.
+// Copyright(c) 2021 Intel Corporation. All Rights Reserved.
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+namespace librealsense
+{
+    // Vectorized vertical (top-to-bottom, then bottom-to-top) recursive passes of the spatial filter.
+    // The vertical passes are independent per column, so each SIMD lane carries one column down the
+    // image, with a block of 8 (SSE) or 16 (AVX2) columns being walked at a time.
+    // The results are bit-exact with spatial_filter's scalar passes. The kernels only process whole
+    // blocks of columns, starting from the left, and return the number of columns processed; the
+    // remaining columns are left for the scalar code.
+
+    size_t spatial_filter_vertical_sse(uint16_t * image, size_t width, size_t height, float alpha, uint16_t delta_z);
+    size_t spatial_filter_vertical_sse(float * image, size_t width, size_t height, float alpha, float delta_z);
+
+    size_t spatial_filter_vertical_avx2(uint16_t * image, size_t width, size_t height, float alpha, uint16_t delta_z);
+    size_t spatial_filter_vertical_avx2(float * image, size_t width, size_t height, float alpha, float delta_z);
+
+    // The scalar vertical passes, over the columns from 'first' on: the columns left by the kernels above
+    void spatial_filter_vertical_scalar(uint16_t * image, size_t width, size_t height, size_t first, float alpha, uint16_t delta_z);
+    void spatial_filter_vertical_scalar(float * image, size_t width, size_t height, size_t first, float alpha, float delta_z);
+}
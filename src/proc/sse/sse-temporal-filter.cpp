@@ -0,0 +1,237 @@
+// License: Apache 2.0. See LICENSE file in root directory.
+// Copyright(c) 2021 Intel Corporation. All Rights Reserved.
+
+#include "sse-temporal-filter.h"
+
+#include <cmath>
+#include <cstring>
+
+#ifdef __SSSE3__
+#include <tmmintrin.h> // For SSSE3 intrinsics
+#endif
+
+namespace librealsense
+{
+#ifdef __SSSE3__
+    namespace
+    {
+        inline __m128i select(__m128i mask, __m128i a, __m128i b)
+        {
+            return _mm_or_si128(_mm_and_si128(mask, a), _mm_andnot_si128(mask, b));
+        }
+
+        inline __m128 select(__m128 mask, __m128 a, __m128 b)
+        {
+            return _mm_or_ps(_mm_and_ps(mask, a), _mm_andnot_ps(mask, b));
+        }
+
+        // Looks up the persistence of 16 history bytes at once: the high nibble selects (via a shuffle)
+        // the 16 bits of 'persistent' covering that nibble, and the low nibble selects one of those bits
+        struct persistence_lut
+        {
+            __m128i low_bits, high_bits, bit;
+
+            explicit persistence_lut(const uint8_t persistent[32])
+            {
+                alignas(16) uint8_t lo[16], hi[16];
+                for (int i = 0; i < 16; ++i)
+                {
+                    lo[i] = persistent[2 * i];
+                    hi[i] = persistent[2 * i + 1];
+                }
+                low_bits = _mm_load_si128((const __m128i *)lo);
+                high_bits = _mm_load_si128((const __m128i *)hi);
+                bit = _mm_setr_epi8(1, 2, 4, 8, 16, 32, 64, -128, 1, 2, 4, 8, 16, 32, 64, -128);
+            }
+
+            // 0xff for each history byte that is persistent
+            __m128i operator()(__m128i history) const
+            {
+                const __m128i nibble = _mm_set1_epi8(0x0f);
+                __m128i high = _mm_and_si128(_mm_srli_epi16(history, 4), nibble);
+                __m128i low = _mm_and_si128(history, nibble);
+                __m128i use_high = _mm_cmpgt_epi8(low, _mm_set1_epi8(7));
+                __m128i bits = select(use_high, _mm_shuffle_epi8(high_bits, high), _mm_shuffle_epi8(low_bits, high));
+                __m128i b = _mm_shuffle_epi8(bit, low);
+                return _mm_cmpeq_epi8(_mm_and_si128(bits, b), b);
+            }
+        };
+
+        // The new history bytes: the current bit is cleared where there is no current value, set
+        // where old and new values agree, and the history restarts wherever a new value is taken as is
+        inline __m128i update_history(__m128i history, __m128i no_cur, __m128i agree, __m128i mask)
+        {
+            __m128i restart = _mm_andnot_si128(_mm_or_si128(no_cur, agree), mask);
+            return _mm_or_si128(_mm_or_si128(
+                _mm_and_si128(no_cur, _mm_andnot_si128(mask, history)),
+                _mm_and_si128(agree, _mm_or_si128(history, mask))),
+                restart);
+        }
+    }
+
+    size_t temporal_filter_smooth_sse(uint16_t * frame, uint16_t * last_frame, uint8_t * history, size_t count, const temporal_smooth_params & params)
+    {
+        const size_t lanes = 8;
+        const size_t n = count - count % lanes;
+
+        const persistence_lut persistent(params.persistent);
+        const __m128i mask = _mm_set1_epi8(char(params.mask));
+        const __m128i delta = _mm_set1_epi16(short(params.delta_z));
+        const __m128 alpha = _mm_set1_ps(params.alpha);
+        const __m128 one_minus_alpha = _mm_set1_ps(params.one_minus_alpha);
+        const __m128i zero = _mm_setzero_si128();
+        const __m128i bias32 = _mm_set1_epi32(0x8000);
+        const __m128i bias16 = _mm_set1_epi16(short(0x8000));
+
+        for (size_t i = 0; i < n; i += lanes)
+        {
+            __m128i cur = _mm_loadu_si128((const __m128i *)(frame + i));
+            __m128i prev = _mm_loadu_si128((const __m128i *)(last_frame + i));
+            __m128i hist = _mm_loadl_epi64((const __m128i *)(history + i));
+
+            __m128i no_cur = _mm_cmpeq_epi16(cur, zero);
+            __m128i no_prev = _mm_cmpeq_epi16(prev, zero);
+            __m128i diff = _mm_or_si128(_mm_subs_epu16(cur, prev), _mm_subs_epu16(prev, cur));
+            __m128i far = _mm_cmpeq_epi16(_mm_subs_epu16(delta, diff), zero);
+            __m128i agree = _mm_andnot_si128(_mm_or_si128(_mm_or_si128(no_cur, no_prev), far), _mm_cmpeq_epi16(zero, zero));
+
+            // (uint16_t)(alpha * cur + (1 - alpha) * prev), truncated like the scalar cast
+            __m128i lo = _mm_cvttps_epi32(_mm_add_ps(
+                _mm_mul_ps(alpha, _mm_cvtepi32_ps(_mm_unpacklo_epi16(cur, zero))),
+                _mm_mul_ps(one_minus_alpha, _mm_cvtepi32_ps(_mm_unpacklo_epi16(prev, zero)))));
+            __m128i hi = _mm_cvttps_epi32(_mm_add_ps(
+                _mm_mul_ps(alpha, _mm_cvtepi32_ps(_mm_unpackhi_epi16(cur, zero))),
+                _mm_mul_ps(one_minus_alpha, _mm_cvtepi32_ps(_mm_unpackhi_epi16(prev, zero)))));
+            __m128i filtered = _mm_xor_si128(_mm_packs_epi32(_mm_sub_epi32(lo, bias32), _mm_sub_epi32(hi, bias32)), bias16);
+
+            // Holes are filled from the last frame if its value has been persistent enough
+            __m128i persistent8 = persistent(hist);
+            __m128i fill = _mm_andnot_si128(no_prev, _mm_and_si128(no_cur, _mm_unpacklo_epi8(persistent8, persistent8)));
+
+            __m128i out = select(agree, filtered, select(fill, prev, cur));
+            __m128i last = select(agree, filtered, select(no_cur, prev, cur));
+
+            _mm_storeu_si128((__m128i *)(frame + i), out);
+            _mm_storeu_si128((__m128i *)(last_frame + i), last);
+            _mm_storel_epi64((__m128i *)(history + i),
+                update_history(hist, _mm_packs_epi16(no_cur, zero), _mm_packs_epi16(agree, zero), mask));
+        }
+        return n;
+    }
+
+    size_t temporal_filter_smooth_sse(float * frame, float * last_frame, uint8_t * history, size_t count, const temporal_smooth_params & params)
+    {
+        const size_t lanes = 4;
+        const size_t n = count - count % lanes;
+
+        const persistence_lut persistent(params.persistent);
+        const __m128i mask = _mm_set1_epi8(char(params.mask));
+        const __m128 delta = _mm_set1_ps(params.delta_z);
+        const __m128 alpha = _mm_set1_ps(params.alpha);
+        const __m128 one_minus_alpha = _mm_set1_ps(params.one_minus_alpha);
+        const __m128 zero = _mm_setzero_ps();
+        const __m128 sign = _mm_set1_ps(-0.f);
+
+        for (size_t i = 0; i < n; i += lanes)
+        {
+            __m128 cur = _mm_loadu_ps(frame + i);
+            __m128 prev = _mm_loadu_ps(last_frame + i);
+            int32_t h;
+            memcpy(&h, history + i, sizeof(h));
+            __m128i hist = _mm_cvtsi32_si128(h);
+
+            // As in the scalar code, 0 and -0 are missing values while NaN is not
+            __m128 no_cur = _mm_cmpeq_ps(cur, zero);
+            __m128 no_prev = _mm_cmpeq_ps(prev, zero);
+            __m128 diff = _mm_andnot_ps(sign, _mm_sub_ps(cur, prev));
+            __m128 agree = _mm_andnot_ps(_mm_or_ps(no_cur, no_prev), _mm_cmplt_ps(diff, delta));
+
+            __m128 filtered = _mm_add_ps(_mm_mul_ps(alpha, cur), _mm_mul_ps(one_minus_alpha, prev));
+
+            __m128i persistent8 = persistent(hist);
+            persistent8 = _mm_unpacklo_epi8(persistent8, persistent8);
+            __m128 fill = _mm_andnot_ps(no_prev, _mm_and_ps(no_cur, _mm_castsi128_ps(_mm_unpacklo_epi16(persistent8, persistent8))));
+
+            __m128 out = select(agree, filtered, select(fill, prev, cur));
+            __m128 last = select(agree, filtered, select(no_cur, prev, cur));
+
+            _mm_storeu_ps(frame + i, out);
+            _mm_storeu_ps(last_frame + i, last);
+
+            __m128i no_cur8 = _mm_packs_epi16(_mm_packs_epi32(_mm_castps_si128(no_cur), _mm_setzero_si128()), _mm_setzero_si128());
+            __m128i agree8 = _mm_packs_epi16(_mm_packs_epi32(_mm_castps_si128(agree), _mm_setzero_si128()), _mm_setzero_si128());
+            h = _mm_cvtsi128_si32(update_history(hist, no_cur8, agree8, mask));
+            memcpy(history + i, &h, sizeof(h));
+        }
+        return n;
+    }
+#else
+    size_t temporal_filter_smooth_sse(uint16_t *, uint16_t *, uint8_t *, size_t, const temporal_smooth_params &) { return 0; }
+    size_t temporal_filter_smooth_sse(float *, float *, uint8_t *, size_t, const temporal_smooth_params &) { return 0; }
+#endif
+
+    namespace
+    {
+        template<typename T>
+        void smooth_scalar(T * frame, T * last_frame, uint8_t * history, size_t count, const temporal_smooth_params & params)
+        {
+            T delta_z = static_cast<T>(params.delta_z);
+            unsigned char mask = params.mask;
+
+            for (size_t i = 0; i < count; i++)
+            {
+                T cur_val = frame[i];
+                T prev_val = last_frame[i];
+
+                if (cur_val)
+                {
+                    if (!prev_val)
+                    {
+                        last_frame[i] = cur_val;
+                        history[i] = mask;
+                    }
+                    else
+                    {  // old and new val
+                        T diff = static_cast<T>(fabs(cur_val - prev_val));
+
+                        if (diff < delta_z)
+                        {  // old and new val agree
+                            history[i] |= mask;
+                            float filtered = params.alpha * cur_val + params.one_minus_alpha * prev_val;
+                            T result = static_cast<T>(filtered);
+                            frame[i] = result;
+                            last_frame[i] = result;
+                        }
+                        else
+                        {
+                            last_frame[i] = cur_val;
+                            history[i] = mask;
+                        }
+                    }
+                }
+                else
+                {  // no cur_val
+                    if (prev_val)
+                    { // only case we can help
+                        unsigned char hist = history[i];
+                        if (params.persistent[hist / 8] & (1 << (hist % 8)))
+                        { // we have had enough samples lately
+                            frame[i] = prev_val;
+                        }
+                    }
+                    history[i] &= ~mask;
+                }
+            }
+        }
+    }
+
+    void temporal_filter_smooth_scalar(uint16_t * frame, uint16_t * last_frame, uint8_t * history, size_t count, const temporal_smooth_params & params)
+    {
+        smooth_scalar(frame, last_frame, history, count, params);
+    }
+
+    void temporal_filter_smooth_scalar(float * frame, float * last_frame, uint8_t * history, size_t count, const temporal_smooth_params & params)
+    {
+        smooth_scalar(frame, last_frame, history, count, params);
+    }
+}
@@ -0,0 +1,38 @@
+// License: Apache 2.0. See LICENSE file in root directory.
+// Copyright(c) 2021 Intel Corporation. All Rights Reserved.
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+namespace librealsense
+{
+    // Per-frame parameters of temporal_filter::temp_jw_smooth
+    struct temporal_smooth_params
+    {
+        float alpha;
+        float one_minus_alpha;
+        float delta_z;
+        uint8_t mask;               // The history bit of the current frame
+        // Bit (h % 8) of byte (h / 8) is set when a pixel with history h may be filled from the last
+        // frame, i.e. when the persistence map classifies h as credible for the current frame
+        uint8_t persistent[32];
+    };
+
+    // Vectorized temporal_filter::temp_jw_smooth, 8 (SSSE3) or 16 (AVX2) depth pixels at a time. The
+    // persistence lookup is done on the history bytes with nibble shuffles into 'persistent'.
+    // The results are bit-exact with the scalar code. The kernels process whole vectors of pixels
+    // from the start of the frame and return the number of pixels processed; the rest are left for
+    // the scalar code.
+
+    size_t temporal_filter_smooth_sse(uint16_t * frame, uint16_t * last_frame, uint8_t * history, size_t count, const temporal_smooth_params & params);
+    size_t temporal_filter_smooth_sse(float * frame, float * last_frame, uint8_t * history, size_t count, const temporal_smooth_params & params);
+
+    size_t temporal_filter_smooth_avx2(uint16_t * frame, uint16_t * last_frame, uint8_t * history, size_t count, const temporal_smooth_params & params);
+    size_t temporal_filter_smooth_avx2(float * frame, float * last_frame, uint8_t * history, size_t count, const temporal_smooth_params & params);
+
+    // The scalar temporal_filter::temp_jw_smooth, for the pixels left by the kernels above
+    void temporal_filter_smooth_scalar(uint16_t * frame, uint16_t * last_frame, uint8_t * history, size_t count, const temporal_smooth_params & params);
+    void temporal_filter_smooth_scalar(float * frame, float * last_frame, uint8_t * history, size_t count, const temporal_smooth_params & params);
+}
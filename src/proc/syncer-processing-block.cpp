@@ -13,6 +13,15 @@ namespace librealsense
     syncer_process_unit::syncer_process_unit(std::initializer_list< bool_option::ptr > enable_opts, bool log)
         : processing_block("syncer"), _matcher((new composite_identity_matcher({})))
         , _enable_opts(enable_opts.begin(), enable_opts.end())
+        , _inbox( INBOX_SIZE,
+                  [this]( frame_holder const & f ) {
+                      // The dispatching thread falls behind; warn on the 1st, 2nd, 4th... drop only
+                      auto const drops = ++_inbox_drops;
+                      if( ! ( drops & ( drops - 1 ) ) )
+                          LOG_WARNING( "syncer inbox full: dropped " << frame_holder_to_string( f ) << " ("
+                                                                     << drops << " frames so far)" );
+                  } )
+        , _inbox_drops( 0 )
     {
         _matcher->set_callback( [this]( frame_holder f, syncronization_environment env ) {
             if( env.log )
@@ -53,31 +62,51 @@ namespace librealsense
                 return;
             }
             LOG_DEBUG( "--> syncing " << frame_holder_to_string( frame ));
+
+            // The matchers are not thread-safe, so only one thread at a time may dispatch. Rather than
+            // have the other streams' threads wait for it, they leave their frames in the inbox: whoever
+            // holds the lock dispatches them, in arrival order, before letting go.
+            if( ! _inbox.enqueue( std::move( frame ) ) )
+                return;
+
+            do
             {
-                std::lock_guard<std::mutex> lock(_mutex);
-                if( ! _matcher->get_active() )
                 {
-                    LOG_DEBUG( "matcher was stopped: NOT DISPATCHING FRAME!" );
-                    return;
-                }
-                _matcher->dispatch(std::move(frame), { source, _matches, log });
-            }
+                    std::unique_lock< std::mutex > lock( _mutex, std::try_to_lock );
+                    if( ! lock.owns_lock() )
+                        return;
 
-            frame_holder f;
-            {
-                // Another thread has the lock, meaning will get into the following loop and dequeue all
-                // the frames. So there's nothing for us to do...
-                std::unique_lock< std::mutex > lock(_callback_mutex, std::try_to_lock);
-                if (!lock.owns_lock())
-                    return;
+                    frame_holder next;
+                    while( _inbox.try_dequeue( &next ) )
+                    {
+                        if( ! _matcher->get_active() )
+                        {
+                            LOG_DEBUG( "matcher was stopped: NOT DISPATCHING FRAME!" );
+                            continue;
+                        }
+                        _matcher->dispatch( std::move( next ), { source, _matches, log } );
+                    }
+                }
 
-                while (_matches.try_dequeue(&f))
+                frame_holder f;
                 {
-                    LOG_DEBUG( "--> frame ready: " << *f.frame );
-                    get_source().frame_ready(std::move(f));
+                    // Another thread has the lock, meaning will get into the following loop and dequeue all
+                    // the frames. So there's nothing for us to do...
+                    std::unique_lock< std::mutex > lock(_callback_mutex, std::try_to_lock);
+                    if (!lock.owns_lock())
+                        return;
+
+                    while (_matches.try_dequeue(&f))
+                    {
+                        LOG_DEBUG( "--> frame ready: " << *f.frame );
+                        get_source().frame_ready(std::move(f));
+                    }
                 }
-            }
 
+                // A frame (or match) left behind by a thread that gave up on one of the locks while we
+                // still held it would otherwise wait for the next frame to arrive
+            }
+            while( ! _inbox.empty() || ! _matches.empty() );
         };
 
         set_processing_callback(std::shared_ptr<rs2_frame_processor_callback>(
@@ -89,6 +118,7 @@ namespace librealsense
     void syncer_process_unit::stop()
     {
         _matcher->stop();
+        _inbox.clear();
     }
 }
 
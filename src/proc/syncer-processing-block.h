@@ -4,6 +4,7 @@
 #pragma once
 
 #include <stdint.h>
+#include <atomic>
 #include <vector>
 #include <mutex>
 #include <memory>
@@ -33,6 +34,9 @@ namespace librealsense
         // pending dispatch will be lost!
         void stop();
 
+        // Number of frames dropped, without being synced, because the inbox was full
+        uint64_t get_inbox_drops() const { return _inbox_drops; }
+
         ~syncer_process_unit()
         {
             _matcher.reset();
@@ -43,5 +47,11 @@ namespace librealsense
 
         single_consumer_frame_queue<frame_holder> _matches;
         std::mutex _callback_mutex;
+
+        // Frames waiting for the thread that currently holds the lock to dispatch them; sized for a burst
+        // of one frame from each of many streams
+        static const unsigned INBOX_SIZE = 128;
+        single_consumer_frame_queue<frame_holder> _inbox;
+        std::atomic< uint64_t > _inbox_drops;  // oldest frames dropped because the inbox was full
     };
 }
@@ -53,6 +53,21 @@ namespace librealsense
         }
     }
 
+    std::vector<frame_holder> processing_block::invoke_and_hold(frame_holder f)
+    {
+        std::vector<frame_holder> results;
+        _source_wrapper.hold_results(&results);
+        invoke(std::move(f));
+        _source_wrapper.hold_results(nullptr);
+        return results;
+    }
+
+    void processing_block::publish(std::vector<frame_holder> results)
+    {
+        for (auto&& result : results)
+            _source.invoke_callback(std::move(result));
+    }
+
     generic_processing_block::generic_processing_block(const char* name)
         : processing_block(name)
     {
@@ -314,8 +329,26 @@ namespace librealsense
         return _stream_filter.match(frame);
     }
 
+    namespace
+    {
+        // The source whose results are held on this thread, and where to (see hold_results)
+        thread_local const synthetic_source* held_source = nullptr;
+        thread_local std::vector<frame_holder>* held_results = nullptr;
+    }
+
+    void synthetic_source::hold_results(std::vector<frame_holder>* results)
+    {
+        held_source = results ? this : nullptr;
+        held_results = results;
+    }
+
     void synthetic_source::frame_ready(frame_holder result)
     {
+        if (held_source == this)
+        {
+            held_results->push_back(std::move(result));
+            return;
+        }
         _actual_source.invoke_callback(std::move(result));
     }
 
@@ -6,6 +6,7 @@
 #include "../core/processing.h"
 #include "../image.h"
 #include "../source.h"
+#include "../executor.h"
 #include <librealsense2/hpp/rs_frame.hpp>
 #include <librealsense2/hpp/rs_processing.hpp>
 
@@ -38,6 +39,10 @@ namespace librealsense
 
         void frame_ready(frame_holder result) override;
 
+        // While set (on the calling thread only), frame_ready() appends to 'results' instead of
+        // passing the frames on; null to pass them on again
+        void hold_results(std::vector<frame_holder>* results);
+
         rs2_source* get_c_wrapper() override { return _c_wrapper.get(); }
 
     private:
@@ -54,6 +59,21 @@ namespace librealsense
         void set_output_callback(frame_callback_ptr callback) override;
         void invoke(frame_holder frames) override;
         synthetic_source_interface& get_source() override { return _source_wrapper; }
+        void set_frame_allocator(frame_allocator_ptr allocator) { _source.set_allocator(allocator); }
+        frame_pool_stats get_frame_pool_stats() const { return _source.get_pool_stats(); }
+
+        // A block that keeps no state between frames may process several frames at once when
+        // attached to an executor (see rs2_processing_block_set_stateless). The built-in blocks all
+        // keep some (cached output profiles, history buffers), so only custom blocks, whose callback
+        // is the caller's to vouch for, can be declared stateless
+        virtual bool can_be_stateless() const { return false; }
+        void set_stateless(bool stateless) { _stateless = stateless; }
+        bool is_stateless() const { return _stateless; }
+
+        // Like invoke(), but returns the frames the block outputs instead of passing them to the
+        // output callback, so that the results of frames processed concurrently are passed on in order
+        std::vector<frame_holder> invoke_and_hold(frame_holder frame);
+        void publish(std::vector<frame_holder> results);
 
         virtual ~processing_block() { _source.flush(); }
     protected:
@@ -61,6 +81,16 @@ namespace librealsense
         std::mutex _mutex;
         frame_processor_callback_ptr _callback;
         synthetic_source _source_wrapper;
+        std::atomic<bool> _stateless{ false };
+    };
+
+    // The block made by rs2_create_processing_block around a user callback
+    class LRS_EXTENSION_API custom_processing_block : public processing_block
+    {
+    public:
+        custom_processing_block() : processing_block("Custom processing block") {}
+
+        bool can_be_stateless() const override { return true; }
     };
 
     class LRS_EXTENSION_API generic_processing_block : public processing_block
@@ -276,10 +306,18 @@ struct rs2_processing_block : public rs2_options
 {
     rs2_processing_block(std::shared_ptr<librealsense::processing_block_interface> block)
         : rs2_options((librealsense::options_interface*)block.get()),
-        block(block) { }
+        block(block), invoke_mutex(std::make_shared<std::mutex>()) { }
 
     std::shared_ptr<librealsense::processing_block_interface> block;
 
+    // Set while the block is attached to a context's executor: frames passed to the block are then
+    // processed on the executor's threads rather than the caller's
+    std::shared_ptr<librealsense::executor::strand> strand;
+
+    // Keeps frames processed on the caller's thread (rs2_process_frame_sync) from overlapping with
+    // those of the block's strand, unless the block is stateless
+    std::shared_ptr<std::mutex> invoke_mutex;
+
     rs2_processing_block& operator=(const rs2_processing_block&) = delete;
     rs2_processing_block(const rs2_processing_block&) = delete;
 };
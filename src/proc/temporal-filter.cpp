@@ -9,6 +9,7 @@
 #include "context.h"
 #include "proc/synthetic-stream.h"
 #include "proc/temporal-filter.h"
+#include "cpu-features.h"
 
 namespace librealsense
 {
@@ -40,7 +41,8 @@ namespace librealsense
         _delta_param(temp_delta_default),
         _width(0), _height(0), _stride(0), _bpp(0),
         _extension_type(RS2_EXTENSION_DEPTH_FRAME),
-        _current_frm_size_pixels(0)
+        _current_frm_size_pixels(0),
+        _use_avx2(cpu_has_avx2())
     {
         _stream_filter.stream = RS2_STREAM_DEPTH;
         _stream_filter.format = RS2_FORMAT_Z16;
@@ -123,6 +125,34 @@ namespace librealsense
     }
 
 
+    temporal_smooth_params temporal_filter::get_smooth_params(uint8_t mask) const
+    {
+        temporal_smooth_params params;
+        params.alpha = _alpha_param;
+        params.one_minus_alpha = _one_minus_alpha;
+        params.delta_z = _delta_param;
+        params.mask = mask;
+        memset(params.persistent, 0, sizeof(params.persistent));
+        for (size_t h = 0; h < PRESISTENCY_LUT_SIZE; h++)
+            if (_persistence_map[h] & mask)
+                params.persistent[h / 8] |= uint8_t(1 << (h % 8));
+        return params;
+    }
+
+    size_t temporal_filter::temp_jw_smooth_simd(uint16_t * frame, uint16_t * last_frame, uint8_t * history, const temporal_smooth_params & params)
+    {
+        if (_use_avx2)
+            return temporal_filter_smooth_avx2(frame, last_frame, history, _current_frm_size_pixels, params);
+        return temporal_filter_smooth_sse(frame, last_frame, history, _current_frm_size_pixels, params);
+    }
+
+    size_t temporal_filter::temp_jw_smooth_simd(float * frame, float * last_frame, uint8_t * history, const temporal_smooth_params & params)
+    {
+        if (_use_avx2)
+            return temporal_filter_smooth_avx2(frame, last_frame, history, _current_frm_size_pixels, params);
+        return temporal_filter_smooth_sse(frame, last_frame, history, _current_frm_size_pixels, params);
+    }
+
     void temporal_filter::on_set_persistence_control(uint8_t val)
     {
         std::lock_guard<std::mutex> lock(_mutex);
@@ -171,7 +201,7 @@ namespace librealsense
             _last_frame.resize(_current_frm_size_pixels*_bpp);
 
             _history.clear();
-            _history.resize(_current_frm_size_pixels*_bpp);
+            _history.resize(_current_frm_size_pixels);  // one byte of history per pixel
 
         }
     }
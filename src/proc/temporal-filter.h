@@ -3,6 +3,7 @@
 
 #pragma once
 #include "types.h"
+#include "proc/sse/sse-temporal-filter.h"
 
 namespace librealsense
 {
@@ -24,65 +25,24 @@ namespace librealsense
         {
             static_assert((std::is_arithmetic<T>::value), "temporal filter assumes numeric types");
 
-            const bool fp = (std::is_floating_point<T>::value);
-
-            T delta_z = static_cast<T>(_delta_param);
-
             auto frame          = reinterpret_cast<T*>(frame_data);
             auto _last_frame    = reinterpret_cast<T*>(_last_frame_data);
 
             unsigned char mask = 1 << _cur_frame_index;
+            auto params = get_smooth_params(mask);
 
             // pass one -- go through image and update all
-            for (size_t i = 0; i < _current_frm_size_pixels; i++)
-            {
-                T cur_val = frame[i];
-                T prev_val = _last_frame[i];
-
-                if (cur_val)
-                {
-                    if (!prev_val)
-                    {
-                        _last_frame[i] = cur_val;
-                        history[i] = mask;
-                    }
-                    else
-                    {  // old and new val
-                        T diff = static_cast<T>(fabs(cur_val - prev_val));
-
-                        if (diff < delta_z)
-                        {  // old and new val agree
-                            history[i] |= mask;
-                            float filtered = _alpha_param * cur_val + _one_minus_alpha * prev_val;
-                            T result = static_cast<T>(filtered);
-                            frame[i] = result;
-                            _last_frame[i] = result;
-                        }
-                        else
-                        {
-                            _last_frame[i] = cur_val;
-                            history[i] = mask;
-                        }
-                    }
-                }
-                else
-                {  // no cur_val
-                    if (prev_val)
-                    { // only case we can help
-                        unsigned char hist = history[i];
-                        unsigned char classification = _persistence_map[hist];
-                        if (classification & mask)
-                        { // we have had enough samples lately
-                            frame[i] = prev_val;
-                        }
-                    }
-                    history[i] &= ~mask;
-                }
-            }
+            // (vectorized up to the last whole vector of pixels, if supported; see sse-temporal-filter.h)
+            size_t done = temp_jw_smooth_simd(frame, _last_frame, history, params);
+            temporal_filter_smooth_scalar(frame + done, _last_frame + done, history + done, _current_frm_size_pixels - done, params);
 
             _cur_frame_index = (_cur_frame_index + 1) % 8;  // at end of cycle
         }
 
+        temporal_smooth_params get_smooth_params(uint8_t mask) const;
+        size_t temp_jw_smooth_simd(uint16_t * frame, uint16_t * last_frame, uint8_t * history, const temporal_smooth_params & params);
+        size_t temp_jw_smooth_simd(float * frame, float * last_frame, uint8_t * history, const temporal_smooth_params & params);
+
     private:
         void on_set_persistence_control(uint8_t val);
         void on_set_alpha(float val);
@@ -105,6 +65,7 @@ namespace librealsense
         uint8_t                 _cur_frame_index;
         // encodes whether a particular 8 bit history is good enough for all 8 phases of storage
         std::array<uint8_t, PRESISTENCY_LUT_SIZE> _persistence_map;
+        bool                    _use_avx2;
     };
     MAP_EXTENSION(RS2_EXTENSION_TEMPORAL_FILTER, librealsense::temporal_filter);
 }
@@ -3,6 +3,7 @@
 
 #include "y16i-to-y10msby10msb.h"
 #include "stream.h"
+#include "format-converter-kernels.h"
 // CUDA TODO
 //#ifdef RS2_USE_CUDA
 //#include "cuda/cuda-conversion.cuh"
@@ -10,11 +11,6 @@
 
 namespace librealsense
 {
-    struct y16i_pixel { uint16_t left : 16, right : 16;
-                        // left and right data are shifted 6 times so that the MSB 10 bit will hold the data
-                        // data should be in MSB because OpenGL then uses the MSB byte
-                        uint16_t l() const { return left << 6; }
-                        uint16_t r() const { return right << 6; } };
     void unpack_y10msb_y10msb_from_y16i(byte* const dest[], const byte* source, int width, int height, int actual_size)
     {
         auto count = width * height;
@@ -22,9 +18,8 @@ namespace librealsense
 //#ifdef RS2_USE_CUDA
 //        rscuda::split_frame_y10msb_y10msb_from_y16i_cuda(dest, count, reinterpret_cast<const y12i_pixel*>(source));
 //#else
-        split_frame(dest, count, reinterpret_cast<const y16i_pixel*>(source),
-            [](const y16i_pixel& p) -> uint16_t { return (p.l()); },
-            [](const y16i_pixel& p) -> uint16_t { return (p.r()); });
+        static auto split = get_format_converter_kernel(RS2_FORMAT_Y16I, RS2_FORMAT_Y16);
+        split(dest, source, count);
 //#endif
     }
 
@@ -4,6 +4,7 @@
 #include "y8i-to-y8y8.h"
 
 #include "stream.h"
+#include "format-converter-kernels.h"
 
 #ifdef RS2_USE_CUDA
 #include "cuda/cuda-conversion.cuh"
@@ -18,9 +19,8 @@ namespace librealsense
 #ifdef RS2_USE_CUDA
         rscuda::split_frame_y8_y8_from_y8i_cuda(dest, count, reinterpret_cast<const y8i_pixel *>(source));
 #else
-        split_frame(dest, count, reinterpret_cast<const y8i_pixel*>(source),
-            [](const y8i_pixel & p) -> uint8_t { return p.l; },
-            [](const y8i_pixel & p) -> uint8_t { return p.r; });
+        static auto split = get_format_converter_kernel(RS2_FORMAT_Y8I, RS2_FORMAT_Y8);
+        split(dest, source, count);
 #endif
     }
 
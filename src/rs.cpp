@@ -107,6 +107,11 @@ struct rs2_pipeline_profile
     std::shared_ptr<librealsense::pipeline::profile> profile;
 };
 
+struct rs2_ply_exporter
+{
+    librealsense::ply_writer writer;
+};
+
 struct rs2_frame_queue
 {
     explicit rs2_frame_queue(int cap)
@@ -828,6 +833,67 @@ void rs2_start_cpp(const rs2_sensor* sensor, rs2_frame_callback* callback, rs2_e
 }
 HANDLE_EXCEPTIONS_AND_RETURN(, sensor, callback)
 
+void rs2_set_frame_allocator(const rs2_sensor* sensor, rs2_frame_allocate_ptr on_allocate, rs2_frame_deallocate_ptr on_deallocate, void* user, rs2_error** error) BEGIN_API_CALL
+{
+    VALIDATE_NOT_NULL(sensor);
+    VALIDATE_NOT_NULL(on_allocate);
+    VALIDATE_NOT_NULL(on_deallocate);
+    auto sensor_base = dynamic_cast<librealsense::sensor_base*>(sensor->sensor);
+    if (!sensor_base)
+        throw std::runtime_error("this sensor does not support frame allocators");
+    librealsense::frame_allocator_ptr allocator(
+        new librealsense::frame_allocator(on_allocate, on_deallocate, user),
+        [](rs2_frame_allocator* p) { delete p; });
+    sensor_base->set_frame_allocator(std::move(allocator));
+}
+HANDLE_EXCEPTIONS_AND_RETURN(, sensor, on_allocate, on_deallocate, user)
+
+void rs2_set_frame_allocator_cpp(const rs2_sensor* sensor, rs2_frame_allocator* allocator, rs2_error** error) BEGIN_API_CALL
+{
+    // Take ownership of the allocator ASAP or else memory leaks could result if we throw! (the caller usually does a
+    // 'new' when calling us)
+    VALIDATE_NOT_NULL( allocator );
+    frame_allocator_ptr allocator_ptr{ allocator, []( rs2_frame_allocator * p ) {
+                                          p->release();
+                                      } };
+
+    VALIDATE_NOT_NULL(sensor);
+    auto sensor_base = dynamic_cast<librealsense::sensor_base*>(sensor->sensor);
+    if (!sensor_base)
+        throw std::runtime_error("this sensor does not support frame allocators");
+    sensor_base->set_frame_allocator( allocator_ptr );
+}
+HANDLE_EXCEPTIONS_AND_RETURN(, sensor, allocator)
+
+void rs2_get_frame_pool_statistics(const rs2_sensor* sensor, rs2_frame_pool_statistics* stats, rs2_error** error) BEGIN_API_CALL
+{
+    VALIDATE_NOT_NULL(sensor);
+    VALIDATE_NOT_NULL(stats);
+    auto sensor_base = dynamic_cast<librealsense::sensor_base*>(sensor->sensor);
+    if (!sensor_base)
+        throw std::runtime_error("this sensor does not pool frame buffers");
+    auto s = sensor_base->get_frame_pool_stats();
+    stats->hits = s.hits;
+    stats->misses = s.misses;
+    stats->evictions = s.evictions;
+    stats->pooled = s.pooled;
+}
+HANDLE_EXCEPTIONS_AND_RETURN(, sensor, stats)
+
+void rs2_get_control_cache_statistics(const rs2_sensor* sensor, rs2_control_cache_statistics* stats, rs2_error** error) BEGIN_API_CALL
+{
+    VALIDATE_NOT_NULL(sensor);
+    VALIDATE_NOT_NULL(stats);
+    auto sensor_base = dynamic_cast<librealsense::sensor_base*>(sensor->sensor);
+    librealsense::option_cache_stats s;
+    if (sensor_base)
+        s = sensor_base->get_option_cache_stats();
+    stats->transfers = s.transfers;
+    stats->values_saved = s.values_saved;
+    stats->ranges_saved = s.ranges_saved;
+}
+HANDLE_EXCEPTIONS_AND_RETURN(, sensor, stats)
+
 void rs2_set_notifications_callback_cpp(const rs2_sensor* sensor, rs2_notifications_callback* callback, rs2_error** error) BEGIN_API_CALL
 {
     // Take ownership of the callback ASAP or else memory leaks could result if we throw! (the caller usually does a
@@ -879,21 +945,21 @@ void rs2_stop(const rs2_sensor* sensor, rs2_error** error) BEGIN_API_CALL
 }
 HANDLE_EXCEPTIONS_AND_RETURN(, sensor)
 
-int rs2_supports_frame_metadata(const rs2_frame* frame, rs2_frame_metadata_value frame_metadata, rs2_error** error) BEGIN_API_CALL
+int rs2_supports_frame_metadata(const rs2_frame* frame, rs2_frame_metadata_value frame_metadata, rs2_error** error) BEGIN_HOT_API_CALL
 {
     VALIDATE_NOT_NULL(frame);
     VALIDATE_ENUM(frame_metadata);
     return ((frame_interface*)frame)->supports_frame_metadata(frame_metadata);
 }
-HANDLE_EXCEPTIONS_AND_RETURN(0, frame, frame_metadata)
+HOT_HANDLE_EXCEPTIONS_AND_RETURN(0, frame, frame_metadata)
 
-rs2_metadata_type rs2_get_frame_metadata(const rs2_frame* frame, rs2_frame_metadata_value frame_metadata, rs2_error** error) BEGIN_API_CALL
+rs2_metadata_type rs2_get_frame_metadata(const rs2_frame* frame, rs2_frame_metadata_value frame_metadata, rs2_error** error) BEGIN_HOT_API_CALL
 {
     VALIDATE_NOT_NULL(frame);
     VALIDATE_ENUM(frame_metadata);
     return ((frame_interface*)frame)->get_frame_metadata(frame_metadata);
 }
-HANDLE_EXCEPTIONS_AND_RETURN(0, frame, frame_metadata)
+HOT_HANDLE_EXCEPTIONS_AND_RETURN(0, frame, frame_metadata)
 
 const char* rs2_get_notification_description(rs2_notification* notification, rs2_error** error) BEGIN_API_CALL
 {
@@ -949,19 +1015,19 @@ int rs2_device_list_contains(const rs2_device_list* info_list, const rs2_device*
 }
 HANDLE_EXCEPTIONS_AND_RETURN(false, info_list, device)
 
-rs2_time_t rs2_get_frame_timestamp(const rs2_frame* frame_ref, rs2_error** error) BEGIN_API_CALL
+rs2_time_t rs2_get_frame_timestamp(const rs2_frame* frame_ref, rs2_error** error) BEGIN_HOT_API_CALL
 {
     VALIDATE_NOT_NULL(frame_ref);
     return ((frame_interface*)frame_ref)->get_frame_timestamp();
 }
-HANDLE_EXCEPTIONS_AND_RETURN(0, frame_ref)
+HOT_HANDLE_EXCEPTIONS_AND_RETURN(0, frame_ref)
 
-rs2_timestamp_domain rs2_get_frame_timestamp_domain(const rs2_frame* frame_ref, rs2_error** error) BEGIN_API_CALL
+rs2_timestamp_domain rs2_get_frame_timestamp_domain(const rs2_frame* frame_ref, rs2_error** error) BEGIN_HOT_API_CALL
 {
     VALIDATE_NOT_NULL(frame_ref);
     return ((frame_interface*)frame_ref)->get_frame_timestamp_domain();
 }
-HANDLE_EXCEPTIONS_AND_RETURN(RS2_TIMESTAMP_DOMAIN_COUNT, frame_ref)
+HOT_HANDLE_EXCEPTIONS_AND_RETURN(RS2_TIMESTAMP_DOMAIN_COUNT, frame_ref)
 
 rs2_sensor* rs2_get_frame_sensor(const rs2_frame* frame, rs2_error** error) BEGIN_API_CALL
 {
@@ -974,79 +1040,79 @@ rs2_sensor* rs2_get_frame_sensor(const rs2_frame* frame, rs2_error** error) BEGI
 }
 HANDLE_EXCEPTIONS_AND_RETURN(nullptr, frame)
 
-int rs2_get_frame_data_size(const rs2_frame* frame_ref, rs2_error** error) BEGIN_API_CALL
+int rs2_get_frame_data_size(const rs2_frame* frame_ref, rs2_error** error) BEGIN_HOT_API_CALL
 {
     VALIDATE_NOT_NULL(frame_ref);
     return ((frame_interface*)frame_ref)->get_frame_data_size();
 }
-HANDLE_EXCEPTIONS_AND_RETURN(0, frame_ref)
+HOT_HANDLE_EXCEPTIONS_AND_RETURN(0, frame_ref)
 
-const void* rs2_get_frame_data(const rs2_frame* frame_ref, rs2_error** error) BEGIN_API_CALL
+const void* rs2_get_frame_data(const rs2_frame* frame_ref, rs2_error** error) BEGIN_HOT_API_CALL
 {
     VALIDATE_NOT_NULL(frame_ref);
     return ((frame_interface*)frame_ref)->get_frame_data();
 }
-HANDLE_EXCEPTIONS_AND_RETURN(nullptr, frame_ref)
+HOT_HANDLE_EXCEPTIONS_AND_RETURN(nullptr, frame_ref)
 
-int rs2_get_frame_width(const rs2_frame* frame_ref, rs2_error** error) BEGIN_API_CALL
+int rs2_get_frame_width(const rs2_frame* frame_ref, rs2_error** error) BEGIN_HOT_API_CALL
 {
     VALIDATE_NOT_NULL(frame_ref);
     auto vf = VALIDATE_INTERFACE(((frame_interface*)frame_ref), librealsense::video_frame);
     return vf->get_width();
 }
-HANDLE_EXCEPTIONS_AND_RETURN(0, frame_ref)
+HOT_HANDLE_EXCEPTIONS_AND_RETURN(0, frame_ref)
 
-int rs2_get_frame_height(const rs2_frame* frame_ref, rs2_error** error) BEGIN_API_CALL
+int rs2_get_frame_height(const rs2_frame* frame_ref, rs2_error** error) BEGIN_HOT_API_CALL
 {
     VALIDATE_NOT_NULL(frame_ref);
     auto vf = VALIDATE_INTERFACE(((frame_interface*)frame_ref), librealsense::video_frame);
     return vf->get_height();
 }
-HANDLE_EXCEPTIONS_AND_RETURN(0, frame_ref)
+HOT_HANDLE_EXCEPTIONS_AND_RETURN(0, frame_ref)
 
-int rs2_get_frame_stride_in_bytes(const rs2_frame* frame_ref, rs2_error** error) BEGIN_API_CALL
+int rs2_get_frame_stride_in_bytes(const rs2_frame* frame_ref, rs2_error** error) BEGIN_HOT_API_CALL
 {
     VALIDATE_NOT_NULL(frame_ref);
     auto vf = VALIDATE_INTERFACE(((frame_interface*)frame_ref), librealsense::video_frame);
     return vf->get_stride();
 }
-HANDLE_EXCEPTIONS_AND_RETURN(0, frame_ref)
+HOT_HANDLE_EXCEPTIONS_AND_RETURN(0, frame_ref)
 
-const rs2_stream_profile* rs2_get_frame_stream_profile(const rs2_frame* frame_ref, rs2_error** error) BEGIN_API_CALL
+const rs2_stream_profile* rs2_get_frame_stream_profile(const rs2_frame* frame_ref, rs2_error** error) BEGIN_HOT_API_CALL
 {
     VALIDATE_NOT_NULL(frame_ref);
     return ((frame_interface*)frame_ref)->get_stream()->get_c_wrapper();
 }
-HANDLE_EXCEPTIONS_AND_RETURN(nullptr, frame_ref)
+HOT_HANDLE_EXCEPTIONS_AND_RETURN(nullptr, frame_ref)
 
-int rs2_get_frame_bits_per_pixel(const rs2_frame* frame_ref, rs2_error** error) BEGIN_API_CALL
+int rs2_get_frame_bits_per_pixel(const rs2_frame* frame_ref, rs2_error** error) BEGIN_HOT_API_CALL
 {
     VALIDATE_NOT_NULL(frame_ref);
     auto vf = VALIDATE_INTERFACE(((frame_interface*)frame_ref), librealsense::video_frame);
     return vf->get_bpp();
 }
-HANDLE_EXCEPTIONS_AND_RETURN(0, frame_ref)
+HOT_HANDLE_EXCEPTIONS_AND_RETURN(0, frame_ref)
 
-unsigned long long rs2_get_frame_number(const rs2_frame* frame, rs2_error** error) BEGIN_API_CALL
+unsigned long long rs2_get_frame_number(const rs2_frame* frame, rs2_error** error) BEGIN_HOT_API_CALL
 {
     VALIDATE_NOT_NULL(frame);
     return ((frame_interface*)frame)->get_frame_number();
 }
-HANDLE_EXCEPTIONS_AND_RETURN(0, frame)
+HOT_HANDLE_EXCEPTIONS_AND_RETURN(0, frame)
 
-void rs2_release_frame(rs2_frame* frame) BEGIN_API_CALL
+void rs2_release_frame(rs2_frame* frame) BEGIN_HOT_API_CALL
 {
     VALIDATE_NOT_NULL(frame);
     ((frame_interface*)frame)->release();
 }
-NOEXCEPT_RETURN(, frame)
+HOT_NOEXCEPT_RETURN(, frame)
 
-void rs2_keep_frame(rs2_frame* frame) BEGIN_API_CALL
+void rs2_keep_frame(rs2_frame* frame) BEGIN_HOT_API_CALL
 {
     VALIDATE_NOT_NULL(frame);
     ((frame_interface*)frame)->keep();
 }
-NOEXCEPT_RETURN(, frame)
+HOT_NOEXCEPT_RETURN(, frame)
 
 const char* rs2_get_option_description(const rs2_options* options, rs2_option option, rs2_error** error) BEGIN_API_CALL
 {
@@ -1056,12 +1122,12 @@ const char* rs2_get_option_description(const rs2_options* options, rs2_option op
 }
 HANDLE_EXCEPTIONS_AND_RETURN(nullptr, options, option)
 
-void rs2_frame_add_ref(rs2_frame* frame, rs2_error** error) BEGIN_API_CALL
+void rs2_frame_add_ref(rs2_frame* frame, rs2_error** error) BEGIN_HOT_API_CALL
 {
     VALIDATE_NOT_NULL(frame);
     ((frame_interface*)frame)->acquire();
 }
-HANDLE_EXCEPTIONS_AND_RETURN(, frame)
+HOT_HANDLE_EXCEPTIONS_AND_RETURN(, frame)
 
 const char* rs2_get_option_value_description(const rs2_options* options, rs2_option option, float value, rs2_error** error) BEGIN_API_CALL
 {
@@ -1133,6 +1199,46 @@ int rs2_try_wait_for_frame(rs2_frame_queue* queue, unsigned int timeout_ms, rs2_
 }
 HANDLE_EXCEPTIONS_AND_RETURN(0, queue, output_frame)
 
+int rs2_poll_for_frames_batch(rs2_frame_queue* queue, rs2_frame** output_frames, int max_frames, rs2_error** error) BEGIN_API_CALL
+{
+    VALIDATE_NOT_NULL(queue);
+    VALIDATE_NOT_NULL(output_frames);
+    VALIDATE_GT(max_frames, 0);
+    int n = 0;
+    queue->queue.try_dequeue_batch(max_frames, [&](librealsense::frame_holder&& fh)
+    {
+        frame_interface* result = nullptr;
+        std::swap(result, fh.frame);
+        output_frames[n++] = (rs2_frame*)result;
+    });
+    return n;
+}
+HANDLE_EXCEPTIONS_AND_RETURN(0, queue, output_frames, max_frames)
+
+int rs2_try_wait_for_frames_batch(rs2_frame_queue* queue, unsigned int timeout_ms, rs2_frame** output_frames, int max_frames, rs2_error** error) BEGIN_API_CALL
+{
+    VALIDATE_NOT_NULL(queue);
+    VALIDATE_NOT_NULL(output_frames);
+    VALIDATE_GT(max_frames, 0);
+    int n = 0;
+    queue->queue.dequeue_batch(max_frames, timeout_ms, [&](librealsense::frame_holder&& fh)
+    {
+        frame_interface* result = nullptr;
+        std::swap(result, fh.frame);
+        output_frames[n++] = (rs2_frame*)result;
+    });
+    return n;
+}
+HANDLE_EXCEPTIONS_AND_RETURN(0, queue, timeout_ms, output_frames, max_frames)
+
+void rs2_set_frame_queue_wake_threshold(rs2_frame_queue* queue, int frames, unsigned int latency_us, rs2_error** error) BEGIN_API_CALL
+{
+    VALIDATE_NOT_NULL(queue);
+    VALIDATE_GT(frames, 0);
+    queue->queue.set_wake_threshold(frames, std::chrono::microseconds(latency_us));
+}
+HANDLE_EXCEPTIONS_AND_RETURN(, queue, frames, latency_us)
+
 void rs2_enqueue_frame(rs2_frame* frame, void* queue) BEGIN_API_CALL
 {
     VALIDATE_NOT_NULL(frame);
@@ -1583,6 +1689,17 @@ void rs2_context_unload_tracking_module(rs2_context* ctx, rs2_error** error) BEG
 }
 HANDLE_EXCEPTIONS_AND_RETURN(, ctx)
 
+void rs2_context_set_executor(rs2_context* ctx, int threads, const int* cpus, int cpus_count, rs2_error** error) BEGIN_API_CALL
+{
+    VALIDATE_NOT_NULL(ctx);
+    VALIDATE_RANGE(threads, 0, 256);
+    std::vector<int> affinity;
+    if (cpus)
+        affinity.assign(cpus, cpus + cpus_count);
+    ctx->ctx->set_executor(threads, std::move(affinity));
+}
+HANDLE_EXCEPTIONS_AND_RETURN(, ctx, threads, cpus, cpus_count)
+
 const char* rs2_playback_device_get_file_path(const rs2_device* device, rs2_error** error) BEGIN_API_CALL
 {
     VALIDATE_NOT_NULL(device);
@@ -1648,6 +1765,23 @@ int rs2_playback_device_is_real_time(const rs2_device* device, rs2_error** error
 }
 HANDLE_EXCEPTIONS_AND_RETURN(0, device)
 
+void rs2_playback_device_set_index_file(const rs2_device* device, int enabled, rs2_error** error) BEGIN_API_CALL
+{
+    VALIDATE_NOT_NULL(device);
+    auto playback = VALIDATE_INTERFACE(device->device, librealsense::playback_device);
+    playback->set_index_file(enabled != 0);
+}
+HANDLE_EXCEPTIONS_AND_RETURN(, device, enabled)
+
+void rs2_playback_device_set_read_ahead(const rs2_device* device, unsigned long long bytes, rs2_error** error) BEGIN_API_CALL
+{
+    VALIDATE_NOT_NULL(device);
+    VALIDATE_RANGE(bytes, 0, std::numeric_limits<size_t>::max());
+    auto playback = VALIDATE_INTERFACE(device->device, librealsense::playback_device);
+    playback->set_read_ahead(size_t(bytes));
+}
+HANDLE_EXCEPTIONS_AND_RETURN(, device, bytes)
+
 void rs2_playback_device_set_status_changed_callback(const rs2_device* device, rs2_playback_status_changed_callback* callback, rs2_error** error) BEGIN_API_CALL
 {
     // Take ownership of the callback ASAP or else memory leaks could result if we throw! (the caller usually does a
@@ -1737,6 +1871,37 @@ const char* rs2_record_device_filename(const rs2_device* device, rs2_error** err
 }
 HANDLE_EXCEPTIONS_AND_RETURN(nullptr, device)
 
+void rs2_record_device_get_statistics(const rs2_device* device, rs2_record_statistics* stats, rs2_error** error) BEGIN_API_CALL
+{
+    VALIDATE_NOT_NULL(device);
+    VALIDATE_NOT_NULL(stats);
+    auto record_device = VALIDATE_INTERFACE(device->device, librealsense::record_device);
+    auto s = record_device->get_statistics();
+    stats->queued_bytes = s.queued_bytes;
+    stats->written_frames = s.written_frames;
+    stats->dropped_frames = s.dropped_frames;
+    stats->max_write_latency = std::chrono::duration<double, std::milli>(s.max_write_latency).count();
+    stats->average_write_latency = std::chrono::duration<double, std::milli>(s.average_write_latency).count();
+}
+HANDLE_EXCEPTIONS_AND_RETURN(, device, stats)
+
+void rs2_record_device_set_max_cached_data_size(const rs2_device* device, unsigned long long max_cached_data_size, rs2_error** error) BEGIN_API_CALL
+{
+    VALIDATE_NOT_NULL(device);
+    VALIDATE_RANGE(max_cached_data_size, 1, std::numeric_limits<unsigned long long>::max());
+    auto record_device = VALIDATE_INTERFACE(device->device, librealsense::record_device);
+    record_device->set_max_cached_data_size(max_cached_data_size);
+}
+HANDLE_EXCEPTIONS_AND_RETURN(, device, max_cached_data_size)
+
+void rs2_record_device_set_index_file(const rs2_device* device, int enabled, rs2_error** error) BEGIN_API_CALL
+{
+    VALIDATE_NOT_NULL(device);
+    auto record_device = VALIDATE_INTERFACE(device->device, librealsense::record_device);
+    record_device->set_index_file(enabled != 0);
+}
+HANDLE_EXCEPTIONS_AND_RETURN(, device, enabled)
+
 
 rs2_frame* rs2_allocate_synthetic_video_frame(rs2_source* source, const rs2_stream_profile* new_stream, rs2_frame* original,
     int new_bpp, int new_width, int new_height, int new_stride, rs2_extension frame_type, rs2_error** error) BEGIN_API_CALL
@@ -2074,7 +2239,7 @@ rs2_processing_block* rs2_create_processing_block(rs2_frame_processor_callback*
     frame_processor_callback_ptr callback_ptr{ proc, []( rs2_frame_processor_callback * p ) {
                                                   p->release();
                                               } };
-    auto block = std::make_shared<librealsense::processing_block>("Custom processing block");
+    auto block = std::make_shared<librealsense::custom_processing_block>();
     block->set_processing_callback( callback_ptr );
 
     return new rs2_processing_block{ block };
@@ -2085,7 +2250,7 @@ rs2_processing_block* rs2_create_processing_block_fptr(rs2_frame_processor_callb
 {
     VALIDATE_NOT_NULL(proc);
 
-    auto block = std::make_shared<librealsense::processing_block>("Custom processing block");
+    auto block = std::make_shared<librealsense::custom_processing_block>();
 
     block->set_processing_callback({
         new librealsense::internal_frame_processor_fptr_callback(proc, context),
@@ -2142,6 +2307,34 @@ void rs2_start_processing_fptr(rs2_processing_block* block, rs2_frame_callback_p
 }
 HANDLE_EXCEPTIONS_AND_RETURN(, block, on_frame, user)
 
+void rs2_set_processing_block_frame_allocator(rs2_processing_block* block, rs2_frame_allocate_ptr on_allocate, rs2_frame_deallocate_ptr on_deallocate, void* user, rs2_error** error) BEGIN_API_CALL
+{
+    VALIDATE_NOT_NULL(block);
+    VALIDATE_NOT_NULL(on_allocate);
+    VALIDATE_NOT_NULL(on_deallocate);
+    auto pb = dynamic_cast<librealsense::processing_block*>(block->block.get());
+    if (!pb)
+        throw std::runtime_error("this processing block does not support frame allocators");
+    librealsense::frame_allocator_ptr allocator(
+        new librealsense::frame_allocator(on_allocate, on_deallocate, user),
+        [](rs2_frame_allocator* p) { delete p; });
+    pb->set_frame_allocator(std::move(allocator));
+}
+HANDLE_EXCEPTIONS_AND_RETURN(, block, on_allocate, on_deallocate, user)
+
+void rs2_set_processing_block_frame_allocator_cpp(rs2_processing_block* block, rs2_frame_allocator* allocator, rs2_error** error) BEGIN_API_CALL
+{
+    VALIDATE_NOT_NULL(allocator);
+    frame_allocator_ptr allocator_ptr{ allocator, [](rs2_frame_allocator* p) { p->release(); } };
+
+    VALIDATE_NOT_NULL(block);
+    auto pb = dynamic_cast<librealsense::processing_block*>(block->block.get());
+    if (!pb)
+        throw std::runtime_error("this processing block does not support frame allocators");
+    pb->set_frame_allocator(allocator_ptr);
+}
+HANDLE_EXCEPTIONS_AND_RETURN(, block, allocator)
+
 void rs2_start_processing_queue(rs2_processing_block* block, rs2_frame_queue* queue, rs2_error** error) BEGIN_API_CALL
 {
     VALIDATE_NOT_NULL(block);
@@ -2157,13 +2350,90 @@ void rs2_process_frame(rs2_processing_block* block, rs2_frame* frame, rs2_error*
     VALIDATE_NOT_NULL(block);
     VALIDATE_NOT_NULL(frame);
 
+    if (auto strand = std::atomic_load(&block->strand))
+    {
+        // The tasks keep the block alive until they are done with it
+        auto fh = std::make_shared<frame_holder>((frame_interface*)frame);
+        if (strand->get_concurrency() > 1)
+        {
+            // Stateless: frames are processed concurrently, and their results reordered by the strand
+            auto pb = std::static_pointer_cast<librealsense::processing_block>(block->block);
+            strand->post_ordered([pb, fh]() {
+                auto results = std::make_shared<std::vector<frame_holder>>(pb->invoke_and_hold(std::move(*fh)));
+                return librealsense::executor::task([pb, results]() { pb->publish(std::move(*results)); });
+            });
+        }
+        else
+        {
+            auto b = block->block;
+            auto m = block->invoke_mutex;
+            strand->post([b, m, fh]() {
+                std::lock_guard<std::mutex> lock(*m);
+                b->invoke(std::move(*fh));
+            });
+        }
+        return;
+    }
     block->block->invoke(frame_holder((frame_interface*)frame));
 }
 HANDLE_EXCEPTIONS_AND_RETURN(, block, frame)
 
+void rs2_process_frame_sync(rs2_processing_block* block, rs2_frame* frame, rs2_error** error) BEGIN_API_CALL
+{
+    VALIDATE_NOT_NULL(block);
+    VALIDATE_NOT_NULL(frame);
+
+    frame_holder fh((frame_interface*)frame);
+    auto strand = std::atomic_load(&block->strand);
+    if (strand && strand->get_concurrency() == 1)
+    {
+        // Not while the strand is processing another frame of the block
+        std::lock_guard<std::mutex> lock(*block->invoke_mutex);
+        block->block->invoke(std::move(fh));
+        return;
+    }
+    block->block->invoke(std::move(fh));
+}
+HANDLE_EXCEPTIONS_AND_RETURN(, block, frame)
+
+void rs2_processing_block_attach_executor(rs2_processing_block* block, rs2_context* ctx, rs2_error** error) BEGIN_API_CALL
+{
+    VALIDATE_NOT_NULL(block);
+    std::shared_ptr<librealsense::executor::strand> strand;
+    if (ctx)
+    {
+        auto ex = ctx->ctx->get_executor();
+        auto pb = std::dynamic_pointer_cast<librealsense::processing_block>(block->block);
+        int concurrency = pb && pb->is_stateless() ? ex->get_thread_count() : 1;
+        strand = ex->make_strand(QUEUE_MAX_SIZE, concurrency);
+    }
+    if (auto prev = std::atomic_exchange(&block->strand, strand))
+        prev->stop();
+}
+HANDLE_EXCEPTIONS_AND_RETURN(, block, ctx)
+
+void rs2_processing_block_set_stateless(rs2_processing_block* block, int stateless, rs2_error** error) BEGIN_API_CALL
+{
+    VALIDATE_NOT_NULL(block);
+    auto pb = std::dynamic_pointer_cast<librealsense::processing_block>(block->block);
+    if (!pb || (stateless && !pb->can_be_stateless()))
+        throw std::runtime_error("this processing block keeps state between frames and cannot process them concurrently");
+    pb->set_stateless(stateless != 0);
+}
+HANDLE_EXCEPTIONS_AND_RETURN(, block, stateless)
+
+int rs2_processing_block_uses_executor(rs2_processing_block* block, rs2_error** error) BEGIN_API_CALL
+{
+    VALIDATE_NOT_NULL(block);
+    return std::atomic_load(&block->strand) != nullptr;
+}
+HANDLE_EXCEPTIONS_AND_RETURN(0, block)
+
 void rs2_delete_processing_block(rs2_processing_block* block) BEGIN_API_CALL
 {
     VALIDATE_NOT_NULL(block);
+    if (auto strand = std::atomic_load(&block->strand))
+        strand->stop();
 
     delete block;
 }
@@ -2222,10 +2492,54 @@ void rs2_export_to_ply(const rs2_frame* frame, const char* fname, rs2_frame* tex
     VALIDATE_NOT_NULL(frame);
     VALIDATE_NOT_NULL(fname);
     auto points = VALIDATE_INTERFACE((frame_interface*)frame, librealsense::points);
-    points->export_to_ply(fname, (frame_interface*)texture);
+    ply_writer writer;
+    points->export_to_ply(writer, fname, (frame_interface*)texture);
 }
 HANDLE_EXCEPTIONS_AND_RETURN(, frame, fname)
 
+void rs2_export_to_ply_ex(const rs2_frame* frame, const char* fname, rs2_frame* texture, int mesh, int normals, float threshold, rs2_error** error) BEGIN_API_CALL
+{
+    VALIDATE_NOT_NULL(frame);
+    VALIDATE_NOT_NULL(fname);
+    VALIDATE_RANGE(threshold, 0.f, std::numeric_limits<float>::max());
+    auto points = VALIDATE_INTERFACE((frame_interface*)frame, librealsense::points);
+    ply_writer::options opts;
+    opts.mesh = mesh != 0;
+    opts.normals = normals != 0;
+    opts.threshold = threshold;
+    ply_writer writer;
+    points->export_to_ply(writer, fname, (frame_interface*)texture, opts);
+}
+HANDLE_EXCEPTIONS_AND_RETURN(, frame, fname, texture, mesh, normals, threshold)
+
+rs2_ply_exporter* rs2_create_ply_exporter(rs2_error** error) BEGIN_API_CALL
+{
+    return new rs2_ply_exporter();
+}
+NOARGS_HANDLE_EXCEPTIONS_AND_RETURN(nullptr)
+
+void rs2_delete_ply_exporter(rs2_ply_exporter* exporter) BEGIN_API_CALL
+{
+    VALIDATE_NOT_NULL(exporter);
+    delete exporter;
+}
+NOEXCEPT_RETURN(, exporter)
+
+void rs2_ply_exporter_export(rs2_ply_exporter* exporter, const rs2_frame* frame, const char* fname, rs2_frame* texture, int mesh, int normals, float threshold, rs2_error** error) BEGIN_API_CALL
+{
+    VALIDATE_NOT_NULL(exporter);
+    VALIDATE_NOT_NULL(frame);
+    VALIDATE_NOT_NULL(fname);
+    VALIDATE_RANGE(threshold, 0.f, std::numeric_limits<float>::max());
+    auto points = VALIDATE_INTERFACE((frame_interface*)frame, librealsense::points);
+    ply_writer::options opts;
+    opts.mesh = mesh != 0;
+    opts.normals = normals != 0;
+    opts.threshold = threshold;
+    points->export_to_ply(exporter->writer, fname, (frame_interface*)texture, opts);
+}
+HANDLE_EXCEPTIONS_AND_RETURN(, exporter, frame, fname, texture, mesh, normals, threshold)
+
 rs2_pixel* rs2_get_frame_texture_coordinates(const rs2_frame* frame, rs2_error** error) BEGIN_API_CALL
 {
     VALIDATE_NOT_NULL(frame);
@@ -2463,6 +2777,22 @@ void rs2_pose_frame_get_pose_data(const rs2_frame* frame, rs2_pose* pose, rs2_er
 }
 HANDLE_EXCEPTIONS_AND_RETURN(, frame, pose)
 
+int rs2_get_motion_frame_sample_count(const rs2_frame* frame, rs2_error** error) BEGIN_HOT_API_CALL
+{
+    VALIDATE_NOT_NULL(frame);
+    auto mf = VALIDATE_INTERFACE((frame_interface*)frame, librealsense::motion_frame);
+    return mf->get_sample_count();
+}
+HOT_HANDLE_EXCEPTIONS_AND_RETURN(0, frame)
+
+const double* rs2_get_motion_frame_sample_timestamps(const rs2_frame* frame, rs2_error** error) BEGIN_HOT_API_CALL
+{
+    VALIDATE_NOT_NULL(frame);
+    auto mf = VALIDATE_INTERFACE((frame_interface*)frame, librealsense::motion_frame);
+    return mf->get_sample_timestamps();
+}
+HOT_HANDLE_EXCEPTIONS_AND_RETURN(nullptr, frame)
+
 void rs2_extract_target_dimensions(const rs2_frame* frame_ref, rs2_calib_target_type calib_type, float* target_dims, unsigned int target_dims_size, rs2_error** error) BEGIN_API_CALL
 {
     VALIDATE_NOT_NULL(frame_ref);
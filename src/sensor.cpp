@@ -130,6 +130,18 @@ void log_callback_end( uint32_t fps,
         return _is_streaming;
     }
 
+    void sensor_base::set_frame_allocator(frame_allocator_ptr allocator)
+    {
+        if (is_streaming())
+            throw wrong_api_call_sequence_exception("set_frame_allocator(...) failed. Sensor is streaming!");
+        _source.set_allocator(allocator);
+    }
+
+    frame_pool_stats sensor_base::get_frame_pool_stats() const
+    {
+        return _source.get_pool_stats();
+    }
+
     bool sensor_base::is_opened() const
     {
         return _is_opened;
@@ -336,6 +348,11 @@ void log_callback_end( uint32_t fps,
         {
             LOG_ERROR("An error has occurred while stop_streaming()!");
         }
+
+        auto stats = _option_cache.get_stats();
+        if (stats.values_saved || stats.ranges_saved)
+            LOG_DEBUG("Option control transfers of " << get_info(RS2_CAMERA_INFO_NAME) << ": " << stats.transfers
+                << " made, " << stats.values_saved << " value and " << stats.ranges_saved << " range queries saved");
     }
 
     void uvc_sensor::verify_supported_requests(const stream_profiles& requests) const
@@ -389,6 +406,9 @@ void log_callback_end( uint32_t fps,
 
         verify_supported_requests(requests);
 
+        const bool zero_copy = _zero_copy && _zero_copy->is_true();
+        _zero_copy_frames.clear();
+
         for (auto&& req_profile : requests)
         {
             auto&& req_profile_base = std::dynamic_pointer_cast<stream_profile_base>(req_profile);
@@ -396,8 +416,13 @@ void log_callback_end( uint32_t fps,
             {
                 unsigned long long last_frame_number = 0;
                 rs2_time_t last_timestamp = 0;
+                // Frames referencing the driver's buffers that the user has not released yet. One
+                // buffer is always left to the driver; beyond that, frames are copied as usual
+                auto zero_copy_frames = std::make_shared<std::atomic<int>>(0);
+                const int max_zero_copy_frames = DEFAULT_V4L2_FRAME_BUFFERS - 1;
+                _zero_copy_frames.push_back(zero_copy_frames);
                 _device->probe_and_commit(req_profile_base->get_backend_profile(),
-                    [this, req_profile_base, req_profile, last_frame_number, last_timestamp](platform::stream_profile p, platform::frame_object f, std::function<void()> continuation) mutable
+                    [this, req_profile_base, req_profile, last_frame_number, last_timestamp, zero_copy, zero_copy_frames, max_zero_copy_frames](platform::stream_profile p, platform::frame_object f, std::function<void()> continuation) mutable
                 {
                     const auto&& system_time = environment::get_instance().get_time_service()->get_time();
 
@@ -411,7 +436,6 @@ void log_callback_end( uint32_t fps,
                     }
 
                     const auto&& fr = generate_frame_from_data(f, _timestamp_reader.get(), last_timestamp, last_frame_number, req_profile_base);
-                    const auto&& requires_processing = true; // TODO - Ariel add option
                     const auto&& timestamp_domain = _timestamp_reader->get_frame_timestamp_domain(fr);
                     auto bpp = get_image_bpp( req_profile_base->get_format() );
                     auto&& frame_counter = fr->additional_data.frame_number;
@@ -423,8 +447,6 @@ void log_callback_end( uint32_t fps,
                     if (msp)
                         expected_size = 64;//32; // D457 - WORKAROUND - SHOULD BE REMOVED AFTER CORRECTION IN DRIVER
 
-                    frame_continuation release_and_enqueue(continuation, f.pixels);
-
                     LOG_DEBUG("FrameAccepted," << librealsense::get_string(req_profile_base->get_stream_type())
                         << ",Counter," << std::dec << fr->additional_data.frame_number
                         << ",Index," << req_profile_base->get_stream_index()
@@ -454,6 +476,24 @@ void log_callback_end( uint32_t fps,
                     if (val_in_range(req_profile_base->get_format(), { RS2_FORMAT_MJPEG, RS2_FORMAT_Z16H }))
                         expected_size = static_cast<int>(f.frame_size);
 
+                    // Frames that need no re-layout can reference the driver's buffer directly;
+                    // the buffer is re-queued when the frame is released
+                    const bool requires_processing = !zero_copy
+                        || f.frame_size != expected_size
+                        || zero_copy_frames->load() >= max_zero_copy_frames;
+                    frame_continuation release_and_enqueue;
+                    if (requires_processing)
+                        release_and_enqueue = frame_continuation(continuation, f.pixels);
+                    else
+                    {
+                        ++*zero_copy_frames;
+                        release_and_enqueue = frame_continuation([continuation, zero_copy_frames]()
+                        {
+                            continuation();
+                            --*zero_copy_frames;
+                        }, f.pixels);
+                    }
+
                     frame_holder fh = _source.alloc_frame(
                         stream_to_frame_types( req_profile_base->get_stream_type() ),
                         expected_size,
@@ -463,7 +503,21 @@ void log_callback_end( uint32_t fps,
                     if( diff > 10 )
                         LOG_DEBUG("!! Frame allocation took " << diff << " msec");
 
-                    if (fh.frame)
+                    if (fh.frame && !requires_processing)
+                    {
+                        if (auto&& raw = dynamic_cast<frame*>(fh.frame))
+                            raw->set_external_buffer((byte*)f.pixels, expected_size, nullptr);
+
+                        auto&& video = dynamic_cast<video_frame*>(fh.frame);
+                        if (video)
+                        {
+                            video->assign(width, height, width * bpp / 8, bpp);
+                        }
+
+                        fh->set_timestamp_domain(timestamp_domain);
+                        fh->set_stream(req_profile_base);
+                    }
+                    else if (fh.frame)
                     {
                         // method should be limited to use of MIPI - not for USB
                         // the aim is to grab the data from a bigger buffer, which is aligned to 64 bytes,
@@ -591,6 +645,14 @@ void log_callback_end( uint32_t fps,
         else if (!_is_opened)
             throw wrong_api_call_sequence_exception("close() failed. UVC device was not opened!");
 
+        int zero_copy_frames = 0;
+        for (auto&& frames : _zero_copy_frames)
+            zero_copy_frames += *frames;
+        if (zero_copy_frames)
+            LOG_WARNING(zero_copy_frames << " zero-copy frames still held by the user on close of " << get_info(RS2_CAMERA_INFO_NAME)
+                        << "; their buffers are returned to the driver when they are released");
+        _zero_copy_frames.clear();
+
         for (auto&& profile : _internal_config)
         {
             try // Handle disconnect event
@@ -829,6 +891,9 @@ void log_callback_end( uint32_t fps,
     {
         register_metadata(RS2_FRAME_METADATA_BACKEND_TIMESTAMP, make_additional_data_parser(&frame_additional_data::backend_timestamp));
 
+        _samples_per_frame = std::make_shared<motion_samples_per_frame_option>();
+        register_option(RS2_OPTION_MOTION_SAMPLES_PER_FRAME, _samples_per_frame);
+
         std::map<std::string, uint32_t> frequency_per_sensor;
         for (auto&& elem : sensor_name_and_hid_profiles)
             frequency_per_sensor.insert(make_pair(elem.first, elem.second.fps));
@@ -953,9 +1018,14 @@ void log_callback_end( uint32_t fps,
 
         unsigned long long last_frame_number = 0;
         rs2_time_t last_timestamp = 0;
+        const int samples_per_frame = static_cast<int>(_samples_per_frame->query());
+        _motion_batches.clear();
+        if (samples_per_frame > 1)
+            for (auto&& elem : _configured_profiles)
+                _motion_batches[elem.first];
         raise_on_before_streaming_changes(true); //Required to be just before actual start allow recording to work
 
-        _hid_device->start_capture([this, last_frame_number, last_timestamp](const platform::sensor_data& sensor_data) mutable
+        _hid_device->start_capture([this, last_frame_number, last_timestamp, samples_per_frame](const platform::sensor_data& sensor_data) mutable
         {
             const auto&& system_time = environment::get_instance().get_time_service()->get_time();
             auto timestamp_reader = _hid_iio_timestamp_reader.get();
@@ -1007,14 +1077,56 @@ void log_callback_end( uint32_t fps,
 
             last_frame_number = frame_counter;
             last_timestamp = timestamp;
-            frame_holder frame = _source.alloc_frame(RS2_EXTENSION_MOTION_FRAME, data_size, fr->additional_data, true);
-            memcpy( (void *)frame->get_frame_data(),
-                    sensor_data.fo.pixels,
-                    sizeof( byte ) * sensor_data.fo.frame_size );
-            if (!frame)
+
+            frame_holder frame;
+            auto batch = is_custom_sensor ? _motion_batches.end() : _motion_batches.find(sensor_name);
+            if (batch != _motion_batches.end())
             {
-                LOG_INFO("Dropped frame. alloc_frame(...) returned nullptr");
-                return;
+                // The sample is added to the batch of its sensor, which is only sent once full
+                const int stride = static_cast<int>(data_size);
+                if (batch->second.frame && batch->second.stride != stride)
+                {
+                    LOG_WARNING("HID sample size changed from " << batch->second.stride << " to " << stride
+                        << " bytes; dropping " << batch->second.samples << " batched " << sensor_name << " samples");
+                    batch->second = motion_batch();
+                }
+                if (!batch->second.frame)
+                {
+                    batch->second.frame = _source.alloc_frame(RS2_EXTENSION_MOTION_FRAME,
+                        motion_frame::batch_size(samples_per_frame, stride), fr->additional_data, true);
+                    if (!batch->second.frame)
+                    {
+                        LOG_INFO("Dropped frame. alloc_frame(...) returned nullptr");
+                        return;
+                    }
+                    batch->second.stride = stride;
+                }
+
+                auto&& mf = static_cast<motion_frame*>(batch->second.frame.frame);
+                auto data = const_cast<byte*>(mf->get_frame_data());
+                auto index = batch->second.samples;
+                memcpy(data + index * stride, sensor_data.fo.pixels, data_size);
+                memcpy(data + motion_frame::timestamps_offset(samples_per_frame, stride) + index * sizeof(rs2_time_t),
+                       &timestamp, sizeof(rs2_time_t));
+                if (++batch->second.samples < samples_per_frame)
+                    return;
+
+                mf->additional_data = fr->additional_data;
+                mf->assign_samples(samples_per_frame, stride);
+                frame = std::move(batch->second.frame);
+                batch->second = motion_batch();
+            }
+            else
+            {
+                frame = _source.alloc_frame(RS2_EXTENSION_MOTION_FRAME, data_size, fr->additional_data, true);
+                if (!frame)
+                {
+                    LOG_INFO("Dropped frame. alloc_frame(...) returned nullptr");
+                    return;
+                }
+                memcpy( (void *)frame->get_frame_data(),
+                        sensor_data.fo.pixels,
+                        sizeof( byte ) * sensor_data.fo.frame_size );
             }
             frame->set_stream(request);
             frame->set_timestamp_domain(timestamp_domain);
@@ -1044,6 +1156,8 @@ void log_callback_end( uint32_t fps,
 
         _hid_device->stop_capture();
         _is_streaming = false;
+        // Samples of batches that were not full are dropped
+        _motion_batches.clear();
         _source.flush();
         _source.reset();
         _hid_iio_timestamp_reader->reset();
@@ -1118,6 +1232,17 @@ void log_callback_end( uint32_t fps,
     {
         register_metadata(RS2_FRAME_METADATA_BACKEND_TIMESTAMP, make_additional_data_parser(&frame_additional_data::backend_timestamp));
         register_metadata(RS2_FRAME_METADATA_RAW_FRAME_SIZE, make_additional_data_parser(&frame_additional_data::raw_size));
+
+        if (!_device->allows_control_caching())
+            _option_cache.disable();
+        else
+            register_option(RS2_OPTION_CONTROL_CACHE_MAX_AGE, std::make_shared<control_cache_max_age_option>(_option_cache));
+
+        if (_device->holds_frame_buffers())
+        {
+            _zero_copy = std::make_shared<zero_copy_option>();
+            register_option(RS2_OPTION_ZERO_COPY, _zero_copy);
+        }
     }
 
     iio_hid_timestamp_reader::iio_hid_timestamp_reader()
@@ -1218,6 +1343,11 @@ void log_callback_end( uint32_t fps,
         auto& raw_fourcc_to_rs2_stream_map = _raw_sensor->get_fourcc_to_rs2_stream_map();
         _fourcc_to_rs2_stream = std::make_shared<std::map<uint32_t, rs2_stream>>(fourcc_to_rs2_stream_map);
         raw_fourcc_to_rs2_stream_map = _fourcc_to_rs2_stream;
+
+        // Options the raw sensor registers on its own are exposed on the synthetic sensor as well
+        for (auto&& id : { RS2_OPTION_ZERO_COPY, RS2_OPTION_MOTION_SAMPLES_PER_FRAME, RS2_OPTION_CONTROL_CACHE_MAX_AGE })
+            if (_raw_sensor->supports_option(id))
+                sensor_base::register_option(id, _raw_sensor->get_option_handler(id));
     }
 
     synthetic_sensor::~synthetic_sensor()
@@ -1565,6 +1695,8 @@ void log_callback_end( uint32_t fps,
             // Retrieve source profile from cached map and generate the relevant processing block.
             std::unordered_set<std::shared_ptr<stream_profile_interface>> current_resolved_reqs;
             auto best_pb = best_pbf->generate();
+            if (_frame_allocator)
+                best_pb->set_frame_allocator(_frame_allocator);
             register_processing_block_options(*best_pb);
             for (auto&& req : best_reqs)
             {
@@ -1792,6 +1924,34 @@ void log_callback_end( uint32_t fps,
         _raw_sensor->register_metadata(metadata, metadata_parser);
     }
 
+    void synthetic_sensor::set_frame_allocator(frame_allocator_ptr allocator)
+    {
+        std::lock_guard<std::mutex> lock(_synthetic_configure_lock);
+        _raw_sensor->set_frame_allocator(allocator);
+        sensor_base::set_frame_allocator(allocator);
+        _frame_allocator = allocator;
+
+        // Processing blocks of an opened sensor already exist; later ones get it when generated
+        for (auto&& entry : _profiles_to_processing_block)
+        {
+            for (auto&& pb : entry.second)
+                pb->set_frame_allocator(allocator);
+        }
+    }
+
+    frame_pool_stats synthetic_sensor::get_frame_pool_stats() const
+    {
+        // The raw frames, and those the processing blocks convert them to
+        std::lock_guard<std::mutex> lock(_synthetic_configure_lock);
+        auto total = _raw_sensor->get_frame_pool_stats();
+        std::set<std::shared_ptr<processing_block>> blocks;
+        for (auto&& entry : _profiles_to_processing_block)
+            blocks.insert(entry.second.begin(), entry.second.end());
+        for (auto&& pb : blocks)
+            total += pb->get_frame_pool_stats();
+        return total;
+    }
+
     bool synthetic_sensor::is_streaming() const
     {
         return _raw_sensor->is_streaming();
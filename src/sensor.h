@@ -23,6 +23,7 @@
 #include "core/extension.h"
 #include "proc/processing-blocks-factory.h"
 #include "proc/identity-processing-block.h"
+#include "option-cache.h"
 
 namespace librealsense
 {
@@ -70,6 +71,11 @@ namespace librealsense
             _on_open = callback;
         }
         virtual void set_frame_metadata_modifier(on_frame_md callback) { _metadata_modifier = callback; }
+        virtual void set_frame_allocator(frame_allocator_ptr allocator);
+        // Buffer-recycling counters of the frames the sensor produces, since it was last opened
+        virtual frame_pool_stats get_frame_pool_stats() const;
+        // How many control transfers the caching of option values and ranges saved; none by default
+        virtual option_cache_stats get_option_cache_stats() const { return {}; }
         device_interface& get_device() override;
 
         // Make sensor inherit its owning device info by default
@@ -236,6 +242,9 @@ namespace librealsense
         int register_before_streaming_changes_callback(std::function<void(bool)> callback) override;
         void unregister_before_start_callback(int token) override;
         void register_metadata(rs2_frame_metadata_value metadata, std::shared_ptr<md_attribute_parser_base> metadata_parser) const override;
+        void set_frame_allocator(frame_allocator_ptr allocator) override;
+        frame_pool_stats get_frame_pool_stats() const override;
+        option_cache_stats get_option_cache_stats() const override { return _raw_sensor->get_option_cache_stats(); }
         bool is_streaming() const override;
         bool is_opened() const override;
 
@@ -253,7 +262,7 @@ namespace librealsense
         void register_processing_block_options(const processing_block& pb);
         void unregister_processing_block_options(const processing_block& pb);
 
-        std::mutex _synthetic_configure_lock;
+        mutable std::mutex _synthetic_configure_lock;
 
         frame_callback_ptr _post_process_callback;
         std::shared_ptr<sensor_base> _raw_sensor;
@@ -264,6 +273,7 @@ namespace librealsense
         std::unordered_map<stream_profile, stream_profiles> _target_to_source_profiles_map;
         std::unordered_map<rs2_format, stream_profiles> _cached_requests;
         std::vector<rs2_option> _cached_processing_blocks_options;
+        frame_allocator_ptr _frame_allocator;
     };
 
     class iio_hid_timestamp_reader : public frame_timestamp_reader
@@ -286,6 +296,8 @@ namespace librealsense
         rs2_timestamp_domain get_frame_timestamp_domain(const std::shared_ptr<frame_interface>& frame) const override;
     };
 
+    class motion_samples_per_frame_option;
+
     class hid_sensor : public sensor_base
     {
     public:
@@ -324,6 +336,18 @@ namespace librealsense
         std::vector<platform::hid_sensor> _hid_sensors;
         std::unique_ptr<frame_timestamp_reader> _hid_iio_timestamp_reader;
         std::unique_ptr<frame_timestamp_reader> _custom_hid_timestamp_reader;
+        std::shared_ptr<motion_samples_per_frame_option> _samples_per_frame;
+
+        // The batched frame being filled for a HID sensor, when motion frames carry several samples
+        struct motion_batch
+        {
+            frame_holder frame;
+            int samples = 0;
+            int stride = 0;
+        };
+        // Per configured HID sensor; filled before streaming starts, so that the capture threads of
+        // the different sensors only look their own entry up
+        std::map<std::string, motion_batch> _motion_batches;
 
         stream_profiles get_sensor_profiles(std::string sensor_name) const;
 
@@ -334,6 +358,8 @@ namespace librealsense
         uint32_t fps_to_sampling_frequency(rs2_stream stream, uint32_t fps) const;
     };
 
+    class zero_copy_option;
+
     class uvc_sensor : public sensor_base
     {
     public:
@@ -353,6 +379,10 @@ namespace librealsense
         platform::usb_spec get_usb_specification() const { return _device->get_usb_specification(); }
         std::string get_device_path() const { return _device->get_device_location(); }
 
+        // The values and ranges of the sensor's XU and PU options
+        option_cache& get_option_cache() { return _option_cache; }
+        option_cache_stats get_option_cache_stats() const override { return _option_cache.get_stats(); }
+
         template<class T>
         auto invoke_powered(T action)
             -> decltype(action(*static_cast<platform::uvc_device*>(nullptr)))
@@ -404,6 +434,9 @@ namespace librealsense
         std::vector<platform::extension_unit> _xus;
         std::unique_ptr<power> _power;
         std::unique_ptr<frame_timestamp_reader> _timestamp_reader;
+        std::shared_ptr<zero_copy_option> _zero_copy;
+        std::vector<std::shared_ptr<std::atomic<int>>> _zero_copy_frames; // per opened profile
+        option_cache _option_cache;
     };
 
     processing_blocks get_color_recommended_proccesing_blocks();
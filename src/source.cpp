@@ -63,6 +63,7 @@ namespace librealsense
         {
             _archive[type] = make_archive(type, &_max_publish_list_size, _ts, metadata_parsers);
         }
+        apply_allocator();
 
         _metadata_parsers = metadata_parsers;
     }
@@ -134,6 +135,44 @@ namespace librealsense
         }
     }
 
+    void frame_source::set_allocator(frame_allocator_ptr allocator)
+    {
+        std::lock_guard<std::mutex> lock(_callback_mutex);
+        _allocator = allocator;
+        apply_allocator();
+    }
+
+    bool frame_source::has_allocator() const
+    {
+        std::lock_guard<std::mutex> lock(_callback_mutex);
+        return _allocator != nullptr;
+    }
+
+    void frame_source::apply_allocator()
+    {
+        // Other frame types keep internal buffers: composite frames store frame references in them, and
+        // motion, pose and points frames access their storage directly
+        for (auto type : { RS2_EXTENSION_VIDEO_FRAME, RS2_EXTENSION_DEPTH_FRAME, RS2_EXTENSION_DISPARITY_FRAME })
+        {
+            auto it = _archive.find(type);
+            if (it != _archive.end() && it->second)
+                it->second->set_allocator(_allocator);
+        }
+    }
+
+    frame_pool_stats frame_source::get_pool_stats() const
+    {
+        std::lock_guard<std::mutex> lock(_callback_mutex);
+        frame_pool_stats total;
+        for (auto&& kvp : _archive)
+        {
+            if (!kvp.second)
+                continue;
+            total += kvp.second->get_pool_stats();
+        }
+        return total;
+    }
+
     void frame_source::flush() const
     {
         for (auto&& kvp : _archive)
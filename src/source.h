@@ -35,6 +35,13 @@ namespace librealsense
 
         void flush() const;
 
+        // Buffer-recycling counters, summed over the archives of all frame types
+        frame_pool_stats get_pool_stats() const;
+
+        // Have video, depth and disparity frames use buffers from a user-supplied allocator; kept across init()
+        void set_allocator(frame_allocator_ptr allocator);
+        bool has_allocator() const;
+
         virtual ~frame_source() { flush(); }
 
         double get_time() const { return _ts ? _ts->get_time() : 0; }
@@ -52,6 +59,8 @@ namespace librealsense
     private:
         friend class syncer_process_unit;
 
+        void apply_allocator();
+
         mutable std::mutex _callback_mutex;
 
         std::map<rs2_extension, std::shared_ptr<archive_interface>> _archive;
@@ -60,5 +69,6 @@ namespace librealsense
         frame_callback_ptr _callback;
         std::shared_ptr<platform::time_service> _ts;
         std::shared_ptr<metadata_parser_map> _metadata_parsers;
+        frame_allocator_ptr _allocator;
     };
 }
@@ -320,23 +320,26 @@ namespace librealsense
         // If we have a Color frame but not Depth, then Depth is "missing" and needs to be
         // waited-for...
 
-        std::vector< frame_holder * > frames_arrived;
-        std::vector< librealsense::matcher * > frames_arrived_matchers;
-        std::vector< int > synced_frames;
-        std::vector< int > unsynced_frames;
-        std::vector< librealsense::matcher * > missing_streams;
-
+        // The scratch vectors are only touched under the lock, and keep their capacity between frames
+        auto & frames_arrived = _frames_arrived;
+        auto & frames_arrived_matchers = _frames_arrived_matchers;
+        auto & synced_frames = _synced_frames;
+        auto & unsynced_frames = _unsynced_frames;
+        auto & missing_streams = _missing_streams;
+
+        // Each released frameset takes the frames, with the vector's buffer
+        std::vector< frame_holder > match;
         while( true )
         {
-            missing_streams.clear();
-            frames_arrived_matchers.clear();
-            frames_arrived.clear();
-
-            std::vector< frame_holder > match;
+            match.clear();
             {
                 // We don't want to stop while syncing!
                 std::lock_guard< std::mutex > lock( _mutex );
 
+                missing_streams.clear();
+                frames_arrived_matchers.clear();
+                frames_arrived.clear();
+
                 // We want to release one frame from each matcher. If a matcher has nothing queued, it is "missing" and
                 // we need to consider waiting for it:
                 for( auto s = _frames_queue.begin(); s != _frames_queue.end(); s++ )
@@ -155,6 +155,13 @@ namespace librealsense
         std::map<matcher*, rs2_timestamp_domain> _next_expected_domain;
 
         std::mutex _mutex;
+
+        // Scratch space for sync(), kept so frames don't allocate; guarded by _mutex
+        std::vector< frame_holder * > _frames_arrived;
+        std::vector< matcher * > _frames_arrived_matchers;
+        std::vector< int > _synced_frames;
+        std::vector< int > _unsynced_frames;
+        std::vector< matcher * > _missing_streams;
     };
 
     // composite matcher that does not synchronize between any frames, and instead just passes them on to callback
@@ -387,6 +387,9 @@ const char * get_string( rs2_option value )
     CASE( AUTO_EXPOSURE_LIMIT_TOGGLE )
     CASE( AUTO_GAIN_LIMIT_TOGGLE )
     CASE( EMITTER_FREQUENCY )
+    CASE( ZERO_COPY )
+    CASE( MOTION_SAMPLES_PER_FRAME )
+    CASE( CONTROL_CACHE_MAX_AGE )
     default:
         assert( ! is_valid( value ) );
         return UNKNOWN_VALUE;
@@ -765,6 +765,20 @@ namespace librealsense
     };
 
 
+    class frame_allocator : public rs2_frame_allocator
+    {
+        rs2_frame_allocate_ptr aptr;
+        rs2_frame_deallocate_ptr dptr;
+        void * user;
+    public:
+        frame_allocator(rs2_frame_allocate_ptr on_allocate, rs2_frame_deallocate_ptr on_deallocate, void * user)
+            : aptr(on_allocate), dptr(on_deallocate), user(user) {}
+
+        void * allocate(size_t size) override { return aptr(size, user); }
+        void deallocate(void * buffer, size_t size) override { dptr(buffer, size, user); }
+        void release() override { delete this; }
+    };
+
     template<class T>
     class internal_frame_callback : public rs2_frame_callback
     {
@@ -878,6 +892,7 @@ namespace librealsense
 
     typedef std::shared_ptr<rs2_frame_callback> frame_callback_ptr;
     typedef std::shared_ptr<rs2_frame_processor_callback> frame_processor_callback_ptr;
+    typedef std::shared_ptr<rs2_frame_allocator> frame_allocator_ptr;
     typedef std::shared_ptr<rs2_notifications_callback> notifications_callback_ptr;
     typedef std::shared_ptr<rs2_calibration_change_callback> calibration_change_callback_ptr;
     typedef std::shared_ptr<rs2_software_device_destruction_callback> software_device_destruction_callback_ptr;
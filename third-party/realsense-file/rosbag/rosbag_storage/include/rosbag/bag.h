@@ -124,6 +124,17 @@ public:
     void            setChunkThreshold(uint32_t chunk_threshold);  //!< Set the threshold for creating new chunks
     uint32_t        getChunkThreshold() const;                    //!< Get the threshold for creating new chunks
 
+    //Intel Realsense Change: index sidecar
+    //! Keep a copy of the message index in a "<bag>.idx" file next to the bag
+    /*!
+     * Reading the index of a bag means seeking to the end of every chunk, which takes long on large
+     * files. When enabled before opening, the index is loaded from the sidecar file if it matches
+     * the bag, and the sidecar is created or replaced otherwise; a bag being written gets its
+     * sidecar when closed. Disabled by default. Failing to write the sidecar is not an error, and
+     * is not retried for the same bag.
+     */
+    void            setIndexFile(bool enabled);
+
     //! Write a message into the bag file
     /*!
      * \param topic The topic name
@@ -193,6 +204,11 @@ private:
     void startReadingVersion102();
     void startReadingVersion200();
 
+    std::string getIndexFileName() const;
+    bool        readIndexFile();
+    void        writeIndexFile();
+    uint64_t    hashChunkInfos() const;
+
     // Writing
 
     void writeVersion();
@@ -278,6 +294,8 @@ private:
     CompressionType     compression_;
     uint32_t            chunk_threshold_;
     uint32_t            bag_revision_;
+    bool                use_index_file_;
+    std::string         failed_index_file_;  //!< The sidecar that could not be written, not to try again
 
     uint64_t file_size_;
     uint64_t file_header_pos_;
@@ -37,6 +37,7 @@
 #endif
 #include <signal.h>
 #include <assert.h>
+#include <fstream>
 #include <iomanip>
 #include <map>
 #include <tuple>
@@ -65,6 +66,7 @@ Bag::Bag() :
     compression_(compression::Uncompressed),
     chunk_threshold_(768 * 1024),  // 768KB chunks
     bag_revision_(0),
+    use_index_file_(false),
     file_size_(0),
     file_header_pos_(0),
     index_data_pos_(0),
@@ -81,6 +83,7 @@ Bag::Bag(string const& filename, uint32_t mode) :
     compression_(compression::Uncompressed),
     chunk_threshold_(768 * 1024),  // 768KB chunks
     bag_revision_(0),
+    use_index_file_(false),
     file_size_(0),
     file_header_pos_(0),
     index_data_pos_(0),
@@ -179,6 +182,8 @@ void Bag::close() {
 
 void Bag::closeWrite() {
     stopWriting();
+    if (use_index_file_)
+        writeIndexFile();
 }
 
 string   Bag::getFileName() const { return file_.getFileName(); }
@@ -323,6 +328,9 @@ void Bag::startReadingVersion200() {
     for (uint32_t i = 0; i < chunk_count_; i++)
         readChunkInfoRecord();
 
+    if (use_index_file_ && readIndexFile())
+        return;
+
     // Read the connection indexes for each chunk
     foreach(ChunkInfo const& chunk_info, chunks_) {
         curr_chunk_info_ = chunk_info;
@@ -341,6 +349,136 @@ void Bag::startReadingVersion200() {
 
     // At this point we don't have a curr_chunk_info anymore so we reset it
     curr_chunk_info_ = ChunkInfo();
+
+    if (use_index_file_)
+        writeIndexFile();
+}
+
+//Intel Realsense Change: index sidecar
+//
+// The sidecar holds the connection indexes read from the bag, in order, after a header identifying
+// the bag by its size, the position and counts of its index records, and a hash of its chunk info
+// records (the position, times and message counts of every chunk), so that a bag rewritten with the
+// same layout is not taken for the one the sidecar was made from:
+//   "RSBAGIDX" version:4 bag-size:8 index-pos:8 connection-count:4 chunk-count:4 chunk-hash:8 index-count:4
+//   and for each connection index: connection-id:4 entry-count:4, entries of sec:4 nsec:4 chunk-pos:8 offset:4
+// All values are in the native byte order, as the sidecar is only a cache of the bag.
+
+namespace {
+    char const     INDEX_FILE_MAGIC[8]  = { 'R', 'S', 'B', 'A', 'G', 'I', 'D', 'X' };
+    uint32_t const INDEX_FILE_VERSION   = 2;
+
+    template<typename T>
+    void writeValue(std::ostream& out, T const& value) { out.write((char const*) &value, sizeof(T)); }
+
+    template<typename T>
+    bool readValue(std::istream& in, T& value) { return (bool) in.read((char*) &value, sizeof(T)); }
+
+    // 64-bit FNV-1a
+    void hashValue(uint64_t& hash, uint64_t value) {
+        for (int i = 0; i < 8; i++, value >>= 8) {
+            hash ^= value & 0xff;
+            hash *= 0x100000001b3ULL;
+        }
+    }
+}
+
+void Bag::setIndexFile(bool enabled) { use_index_file_ = enabled; }
+
+string Bag::getIndexFileName() const { return file_.getFileName() + ".idx"; }
+
+uint64_t Bag::hashChunkInfos() const {
+    uint64_t hash = 0xcbf29ce484222325ULL;
+    foreach(ChunkInfo const& chunk_info, chunks_) {
+        hashValue(hash, chunk_info.pos);
+        hashValue(hash, chunk_info.start_time.toNSec());
+        hashValue(hash, chunk_info.end_time.toNSec());
+        for (map<uint32_t, uint32_t>::const_iterator i = chunk_info.connection_counts.begin(); i != chunk_info.connection_counts.end(); i++)
+            hashValue(hash, (uint64_t(i->first) << 32) | i->second);
+    }
+    return hash;
+}
+
+bool Bag::readIndexFile() {
+    std::ifstream in(getIndexFileName(), std::ios::binary);
+    if (!in)
+        return false;
+
+    seek(0, std::ios::end);
+    uint64_t bag_size = file_.getOffset();
+
+    char     magic[sizeof(INDEX_FILE_MAGIC)];
+    uint32_t version, connection_count, chunk_count, index_count;
+    uint64_t size, index_pos, chunk_hash;
+    if (!in.read(magic, sizeof(magic)) || memcmp(magic, INDEX_FILE_MAGIC, sizeof(magic)) != 0
+        || !readValue(in, version) || version != INDEX_FILE_VERSION
+        || !readValue(in, size) || size != bag_size
+        || !readValue(in, index_pos) || index_pos != index_data_pos_
+        || !readValue(in, connection_count) || connection_count != connection_count_
+        || !readValue(in, chunk_count) || chunk_count != chunk_count_
+        || !readValue(in, chunk_hash) || chunk_hash != hashChunkInfos()
+        || !readValue(in, index_count))
+    {
+        CONSOLE_BRIDGE_logDebug("Index file %s does not match the bag, ignoring it", getIndexFileName().c_str());
+        return false;
+    }
+
+    map<uint32_t, multiset<IndexEntry> > connection_indexes;
+    for (uint32_t i = 0; i < index_count; i++) {
+        uint32_t connection_id, count;
+        if (!readValue(in, connection_id) || !readValue(in, count) || connections_.find(connection_id) == connections_.end())
+            return false;
+
+        multiset<IndexEntry>& connection_index = connection_indexes[connection_id];
+        for (uint32_t j = 0; j < count; j++) {
+            IndexEntry index_entry;
+            uint32_t sec, nsec;
+            if (!readValue(in, sec) || !readValue(in, nsec) || !readValue(in, index_entry.chunk_pos) || !readValue(in, index_entry.offset))
+                return false;
+            index_entry.time = Time(sec, nsec);
+            connection_index.insert(connection_index.end(), index_entry);
+        }
+    }
+
+    connection_indexes_.swap(connection_indexes);
+    CONSOLE_BRIDGE_logDebug("Read the message index from %s", getIndexFileName().c_str());
+    return true;
+}
+
+void Bag::writeIndexFile() {
+    if (getIndexFileName() == failed_index_file_)
+        return; //Already failed for this bag, e.g. in a read-only directory; the bag is read without it
+
+    seek(0, std::ios::end);
+    uint64_t bag_size = file_.getOffset();
+
+    std::ofstream out(getIndexFileName(), std::ios::binary | std::ios::trunc);
+    out.write(INDEX_FILE_MAGIC, sizeof(INDEX_FILE_MAGIC));
+    writeValue(out, INDEX_FILE_VERSION);
+    writeValue(out, bag_size);
+    writeValue(out, index_data_pos_);
+    writeValue(out, static_cast<uint32_t>(connections_.size()));
+    writeValue(out, static_cast<uint32_t>(chunks_.size()));
+    writeValue(out, hashChunkInfos());
+    writeValue(out, static_cast<uint32_t>(connection_indexes_.size()));
+    for (map<uint32_t, multiset<IndexEntry> >::const_iterator i = connection_indexes_.begin(); i != connection_indexes_.end(); i++) {
+        writeValue(out, i->first);
+        writeValue(out, static_cast<uint32_t>(i->second.size()));
+        foreach(IndexEntry const& index_entry, i->second) {
+            writeValue(out, index_entry.time.sec);
+            writeValue(out, index_entry.time.nsec);
+            writeValue(out, index_entry.chunk_pos);
+            writeValue(out, index_entry.offset);
+        }
+    }
+
+    if (!out)
+    {
+        CONSOLE_BRIDGE_logWarn("Failed to write the index file %s", getIndexFileName().c_str());
+        out.close();
+        remove(getIndexFileName().c_str());
+        failed_index_file_ = getIndexFileName();
+    }
 }
 
 void Bag::startReadingVersion102() {
@@ -118,6 +118,10 @@ void ChunkedFile::open(string const& filename, string const& mode) {
     if (!file_)
         throw BagIOException((format("Error opening file: %1%") % filename.c_str()).str());
 
+    //Intel Realsense Change: write in large sequential blocks instead of the small default buffer
+    if (mode != "rb")
+        setvbuf(file_, NULL, _IOFBF, 1024 * 1024);
+
     read_stream_  = std::make_shared<UncompressedStream>(this);
     write_stream_ = std::make_shared<UncompressedStream>(this);
     filename_     = filename;
@@ -0,0 +1,771 @@
+// License: Apache 2.0. See LICENSE file in root directory.
+// Copyright(c) 2021 Intel Corporation. All Rights Reserved.
+
+#include <librealsense2/rs.hpp>
+#include <librealsense2/hpp/rs_internal.hpp>
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <functional>
+#include <iostream>
+#include <map>
+#include <mutex>
+#include <new>
+#include <numeric>
+#include <sstream>
+#include <thread>
+#include <vector>
+
+#include "tclap/CmdLine.h"
+#include "json.hpp"
+#include "../../common/decompress-huffman.h"
+
+using namespace std;
+using namespace chrono;
+using namespace TCLAP;
+using json = nlohmann::json;
+
+
+// Every allocation made through the global operator new is counted, so the cost of each block
+// can be reported in allocations per frame as well as in time. Where librealsense is a shared
+// library resolving operator new dynamically (Linux, macOS), its allocations are counted too.
+static atomic< uint64_t > allocations( 0 );
+
+void * operator new( size_t size )
+{
+    ++allocations;
+    if( auto p = malloc( size ? size : 1 ) )
+        return p;
+    throw bad_alloc();
+}
+void * operator new[]( size_t size ) { return operator new( size ); }
+void * operator new( size_t size, const nothrow_t & ) noexcept
+{
+    ++allocations;
+    return malloc( size ? size : 1 );
+}
+void * operator new[]( size_t size, const nothrow_t & t ) noexcept { return operator new( size, t ); }
+void operator delete( void * p ) noexcept { free( p ); }
+void operator delete[]( void * p ) noexcept { free( p ); }
+void operator delete( void * p, size_t ) noexcept { free( p ); }
+void operator delete[]( void * p, size_t ) noexcept { free( p ); }
+void operator delete( void * p, const nothrow_t & ) noexcept { free( p ); }
+void operator delete[]( void * p, const nothrow_t & ) noexcept { free( p ); }
+
+
+#if (defined(_WIN32) || defined(_WIN64))
+#include <intrin.h>
+
+string get_cpu()
+{
+    int CPUInfo[4] = { -1 };
+    __cpuid( CPUInfo, 0x80000000 );
+    unsigned int nExIds = CPUInfo[0];
+
+    char CPUBrandString[0x40] = { 0 };
+    for( unsigned int i = 0x80000002; i <= nExIds && i <= 0x80000004; ++i )
+    {
+        __cpuid( CPUInfo, i );
+        memcpy( CPUBrandString + 16 * ( i - 0x80000002 ), CPUInfo, sizeof( CPUInfo ) );
+    }
+
+    char * ptr = CPUBrandString;
+    while( *ptr == ' ' ) ptr++;
+    return ptr;
+}
+#elif defined __linux__ || defined(__linux__)
+string get_cpu()
+{
+    string line;
+    ifstream finfo( "/proc/cpuinfo" );
+    while( getline( finfo, line ) )
+    {
+        stringstream str( line );
+        string itype;
+        string info;
+        if( getline( str, itype, ':' ) && getline( str, info ) && itype.substr( 0, 10 ) == "model name" )
+            return info.substr( info.find_first_not_of( ' ' ) );
+    }
+    return "unknown";
+}
+#else
+string get_cpu() { return "unknown"; }
+#endif
+
+
+// The inputs each block can be benchmarked with. Framesets pair frames of the same index.
+struct inputs
+{
+    string source;
+    int width = 0;
+    int height = 0;
+
+    vector< rs2::frame > depth;        // Z16
+    vector< rs2::frame > disparity;    // DISPARITY32, derived from 'depth'
+    vector< rs2::frame > color;        // YUYV (synthetic) or whatever the recording holds
+    vector< rs2::frame > ir;           // Y8
+    vector< rs2::frame > z16h;         // compressed depth
+    vector< rs2::frame > depth_color;  // framesets
+    vector< rs2::frame > depth_ir;     // framesets, with the HDR sequence metadata
+};
+
+
+// Bundles frames into a frameset the way a syncer would, without depending on timestamps
+class frameset_bundler
+{
+public:
+    frameset_bundler()
+        : _queue( 1 )
+        , _block( [this]( rs2::frame, rs2::frame_source & src ) {
+            src.frame_ready( src.allocate_composite_frame( _pending ) );
+        } )
+    {
+        _block.start( _queue );
+    }
+
+    rs2::frame bundle( vector< rs2::frame > frames )
+    {
+        _pending = move( frames );
+        _block.invoke( _pending.front() );
+        auto fs = _queue.wait_for_frame();
+        _pending.clear();
+        fs.keep();
+        return fs;
+    }
+
+private:
+    vector< rs2::frame > _pending;
+    rs2::frame_queue _queue;
+    rs2::processing_block _block;
+};
+
+
+// Deterministic pseudo-random numbers, so every run (and every machine) sees the same pixels
+class lcg
+{
+public:
+    explicit lcg( uint32_t seed ) : _state( seed ) {}
+    uint32_t next() { return _state = _state * 1664525u + 1013904223u; }
+
+private:
+    uint32_t _state;
+};
+
+
+rs2_intrinsics make_intrinsics( int width, int height )
+{
+    rs2_intrinsics intr = { width, height, width / 2.f, height / 2.f, width * 0.75f, width * 0.75f,
+                            RS2_DISTORTION_BROWN_CONRADY, { 0, 0, 0, 0, 0 } };
+    return intr;
+}
+
+
+// Depth is a tilted plane with bumps, sensor noise and a few holes: enough structure for the
+// filters to take their real code paths (edges, invalid pixels, temporal persistence)
+void fill_depth( uint16_t * depth, int width, int height, int index, lcg & rnd )
+{
+    for( int y = 0; y < height; ++y )
+        for( int x = 0; x < width; ++x )
+        {
+            auto d = 800 + ( x * 1200 ) / width + ( y * 400 ) / height;
+            if( ( ( x + index * 3 ) / 64 + y / 48 ) % 5 == 0 )
+                d -= 250;
+            d += int( rnd.next() >> 29 ) - 4;
+            if( ( rnd.next() >> 24 ) < 8 )
+                d = 0;
+            depth[y * width + x] = uint16_t( d );
+        }
+}
+
+
+void fill_ir( uint8_t * ir, int width, int height, lcg & rnd )
+{
+    for( int y = 0; y < height; ++y )
+        for( int x = 0; x < width; ++x )
+            ir[y * width + x] = uint8_t( ( x ^ y ) + ( rnd.next() >> 28 ) );
+}
+
+
+void fill_yuyv( uint8_t * yuyv, int width, int height, int index )
+{
+    for( int y = 0; y < height; ++y )
+        for( int x = 0; x < width; x += 2 )
+        {
+            auto p = yuyv + ( y * width + x ) * 2;
+            p[0] = uint8_t( x + index );
+            p[1] = uint8_t( 128 + y );
+            p[2] = uint8_t( x + 1 + index );
+            p[3] = uint8_t( 128 - y );
+        }
+}
+
+
+// The number of compressed words after which at least 'needed' bytes are decoded
+size_t words_to_fill( vector< uint32_t > const & words, size_t first, size_t needed )
+{
+    uint32_t state = 0;
+    size_t decoded = 0;
+    for( size_t i = first; i < words.size(); ++i )
+    {
+        for( int shift = 28; shift >= 0; shift -= 4 )
+        {
+            uint32_t step = uint32_t( DecompressionStateTable[state * 16 + ( ( words[i] >> shift ) & 0xf )] );
+            if( step & 0x8 )
+                decoded += 1 + ( step & 0x7 );
+            state = ( step >> 6 ) & 0x1ff;
+        }
+        if( decoded >= needed )
+            return i + 1;
+    }
+    return words.size();
+}
+
+
+// Z16H depth: any sequence of nibbles is valid for the decoder's state machine, so random words,
+// biased to long runs of unchanged bytes as in real depth, are cut where they fill the image. Of
+// the lengths around the cut, the first the reference decoder accepts is kept. Returns the number
+// of words to hand to the decoder; 'words' is large enough for the frame's stride times height.
+size_t fill_z16h( vector< uint32_t > & words, int width, int height, lcg & rnd )
+{
+    uint32_t stride = width * 2;
+    words.resize( ( stride + 3 ) / 4 + stride * height );
+    for( auto & w : words )
+    {
+        w = rnd.next();
+        for( int n = 0; n < 6; ++n )
+            w |= 0xfu << ( 4 * ( rnd.next() >> 29 ) );
+    }
+
+    auto first = ( stride + 3 ) / 4;
+    auto fill = words_to_fill( words, first, size_t( stride ) * ( height - 1 ) );
+    vector< uint8_t > image( stride * height + 64 );
+    for( size_t length = fill - 1; length <= fill + 1 && length < words.size(); ++length )
+    {
+        vector< uint32_t > data( words.begin(), words.begin() + length );
+        if( unhuffimage4( data.data(), uint32_t( length ), stride, height, image.data() ) )
+            return length;
+    }
+    return fill;
+}
+
+
+void delete_pixels( void * p ) { delete[] static_cast< uint8_t * >( p ); }
+void delete_words( void * p ) { delete[] static_cast< uint32_t * >( p ); }
+
+
+// Synthetic frames are generated by a software device, so they carry real stream profiles,
+// intrinsics, extrinsics and metadata like those of a camera
+void make_synthetic( rs2::software_device & dev, int width, int height, int count, inputs & in )
+{
+    in.source = "synthetic";
+    in.width = width;
+    in.height = height;
+
+    auto depth_sensor = dev.add_sensor( "Depth" );
+    auto color_sensor = dev.add_sensor( "Color" );
+    auto z16h_sensor = dev.add_sensor( "Compressed Depth" );
+    depth_sensor.add_read_only_option( RS2_OPTION_DEPTH_UNITS, 0.001f );
+    depth_sensor.add_read_only_option( RS2_OPTION_STEREO_BASELINE, 50.f );
+
+    auto intr = make_intrinsics( width, height );
+    auto depth_stream = depth_sensor.add_video_stream(
+        { RS2_STREAM_DEPTH, 0, 0, width, height, 30, 2, RS2_FORMAT_Z16, intr } );
+    auto ir_stream = depth_sensor.add_video_stream(
+        { RS2_STREAM_INFRARED, 1, 1, width, height, 30, 1, RS2_FORMAT_Y8, intr } );
+    auto color_stream = color_sensor.add_video_stream(
+        { RS2_STREAM_COLOR, 0, 2, width, height, 30, 2, RS2_FORMAT_YUYV, intr } );
+    auto z16h_stream = z16h_sensor.add_video_stream(
+        { RS2_STREAM_DEPTH, 0, 3, width, height, 30, 2, RS2_FORMAT_Z16H, intr } );
+
+    depth_stream.register_extrinsics_to( ir_stream, { { 1, 0, 0, 0, 1, 0, 0, 0, 1 }, { 0, 0, 0 } } );
+    depth_stream.register_extrinsics_to( color_stream,
+                                         { { 1, 0, 0, 0, 1, 0, 0, 0, 1 }, { 0.015f, 0, 0 } } );
+
+    rs2::frame_queue depth_queue( 1 );
+    rs2::frame_queue color_queue( 1 );
+    rs2::frame_queue z16h_queue( 1 );
+    depth_sensor.open( { depth_stream, ir_stream } );
+    color_sensor.open( color_stream );
+    z16h_sensor.open( z16h_stream );
+    depth_sensor.start( depth_queue );
+    color_sensor.start( color_queue );
+    z16h_sensor.start( z16h_queue );
+
+    auto take = []( rs2::frame_queue & q, vector< rs2::frame > & to ) {
+        auto f = q.wait_for_frame();
+        f.keep();
+        to.push_back( f );
+    };
+
+    lcg rnd( 0x5eed );
+    for( int i = 0; i < count; ++i )
+    {
+        auto ts = i * 1000. / 30;
+        auto domain = RS2_TIMESTAMP_DOMAIN_HARDWARE_CLOCK;
+
+        // Consecutive frames alternate between the two HDR sequence ids
+        depth_sensor.set_metadata( RS2_FRAME_METADATA_FRAME_COUNTER, i );
+        depth_sensor.set_metadata( RS2_FRAME_METADATA_SEQUENCE_SIZE, 2 );
+        depth_sensor.set_metadata( RS2_FRAME_METADATA_SEQUENCE_ID, i % 2 );
+
+        auto depth = new uint8_t[width * height * 2];
+        fill_depth( reinterpret_cast< uint16_t * >( depth ), width, height, i, rnd );
+        depth_sensor.on_video_frame(
+            { depth, delete_pixels, width * 2, 2, ts, domain, i, depth_stream, 0.001f } );
+        take( depth_queue, in.depth );
+
+        auto ir = new uint8_t[width * height];
+        fill_ir( ir, width, height, rnd );
+        depth_sensor.on_video_frame( { ir, delete_pixels, width, 1, ts, domain, i, ir_stream } );
+        take( depth_queue, in.ir );
+
+        auto color = new uint8_t[width * height * 2];
+        fill_yuyv( color, width, height, i );
+        color_sensor.on_video_frame( { color, delete_pixels, width * 2, 2, ts, domain, i, color_stream } );
+        take( color_queue, in.color );
+
+        // The decoder takes the compressed size from the metadata, as it does for a camera
+        vector< uint32_t > words;
+        auto length = fill_z16h( words, width, height, rnd );
+        z16h_sensor.set_metadata( RS2_FRAME_METADATA_RAW_FRAME_SIZE, length * 4 );
+        auto z16h = new uint32_t[words.size()];
+        copy( words.begin(), words.end(), z16h );
+        z16h_sensor.on_video_frame( { z16h, delete_words, width * 2, 2, ts, domain, i, z16h_stream, 0.001f } );
+        take( z16h_queue, in.z16h );
+    }
+
+    depth_sensor.stop();
+    color_sensor.stop();
+    z16h_sensor.stop();
+}
+
+
+// Recorded frames are read as fast as the playback allows, keeping up to 'count' of each stream
+void load_recording( rs2::context & ctx, string const & path, int count, inputs & in )
+{
+    in.source = path;
+
+    auto dev = ctx.load_device( path );
+    auto playback = dev.as< rs2::playback >();
+    playback.set_real_time( false );
+
+    mutex m;
+    auto on_frame = [&]( rs2::frame f ) {
+        auto vf = f.as< rs2::video_frame >();
+        if( ! vf )
+            return;
+
+        vector< rs2::frame > * to = nullptr;
+        auto format = f.get_profile().format();
+        switch( f.get_profile().stream_type() )
+        {
+        case RS2_STREAM_DEPTH: to = format == RS2_FORMAT_Z16H ? &in.z16h : &in.depth; break;
+        case RS2_STREAM_COLOR: to = &in.color; break;
+        case RS2_STREAM_INFRARED: to = &in.ir; break;
+        default: return;
+        }
+
+        lock_guard< mutex > lock( m );
+        if( int( to->size() ) < count )
+        {
+            f.keep();
+            to->push_back( f );
+        }
+    };
+
+    auto sensors = dev.query_sensors();
+    for( auto && s : sensors )
+    {
+        s.open( s.get_stream_profiles() );
+        s.start( on_frame );
+    }
+
+    while( playback.current_status() != RS2_PLAYBACK_STATUS_STOPPED )
+        this_thread::sleep_for( milliseconds( 10 ) );
+
+    for( auto && s : sensors )
+    {
+        s.stop();
+        s.close();
+    }
+
+    // Everything downstream of the decompression works on plain Z16
+    if( ! in.z16h.empty() && in.depth.empty() )
+    {
+        rs2::depth_huffman_decoder decoder;
+        for( auto && f : in.z16h )
+        {
+            auto d = decoder.process( f );
+            d.keep();
+            in.depth.push_back( d );
+        }
+    }
+
+    if( ! in.depth.empty() )
+    {
+        auto vf = in.depth.front().as< rs2::video_frame >();
+        in.width = vf.get_width();
+        in.height = vf.get_height();
+    }
+}
+
+
+void make_derived( inputs & in )
+{
+    rs2::disparity_transform to_disparity( true );
+    for( auto && f : in.depth )
+    {
+        auto d = to_disparity.process( f );
+        d.keep();
+        in.disparity.push_back( d );
+    }
+
+    frameset_bundler bundler;
+    for( size_t i = 0; i < in.depth.size(); ++i )
+    {
+        if( ! in.color.empty() )
+            in.depth_color.push_back( bundler.bundle( { in.depth[i], in.color[i % in.color.size()] } ) );
+
+        // HDR merge only does anything with frames that carry the sequence metadata
+        if( i < in.ir.size() && in.depth[i].supports_frame_metadata( RS2_FRAME_METADATA_SEQUENCE_ID ) )
+            in.depth_ir.push_back( bundler.bundle( { in.depth[i], in.ir[i] } ) );
+    }
+}
+
+
+struct bench_case
+{
+    string name;
+    vector< rs2::frame > inputs::*input;
+    function< shared_ptr< rs2::filter >() > make;
+};
+
+
+vector< bench_case > get_cases()
+{
+    return {
+        { "decimation_filter", &inputs::depth, [] { return make_shared< rs2::decimation_filter >(); } },
+        { "spatial_filter", &inputs::depth, [] { return make_shared< rs2::spatial_filter >(); } },
+        { "temporal_filter", &inputs::depth, [] { return make_shared< rs2::temporal_filter >(); } },
+        { "hole_filling_filter", &inputs::depth, [] { return make_shared< rs2::hole_filling_filter >(); } },
+        { "threshold_filter", &inputs::depth, [] { return make_shared< rs2::threshold_filter >(); } },
+        { "units_transform", &inputs::depth, [] { return make_shared< rs2::units_transform >(); } },
+        { "depth_to_disparity", &inputs::depth, [] { return make_shared< rs2::disparity_transform >( true ); } },
+        { "disparity_to_depth", &inputs::disparity, [] { return make_shared< rs2::disparity_transform >( false ); } },
+        { "colorizer", &inputs::depth, [] { return make_shared< rs2::colorizer >(); } },
+        { "pointcloud", &inputs::depth, [] { return make_shared< rs2::pointcloud >(); } },
+        { "pointcloud_textured", &inputs::depth_color, [] { return make_shared< rs2::pointcloud >(); } },
+        { "align_to_color", &inputs::depth_color, [] { return make_shared< rs2::align >( RS2_STREAM_COLOR ); } },
+        { "align_to_depth", &inputs::depth_color, [] { return make_shared< rs2::align >( RS2_STREAM_DEPTH ); } },
+        { "hdr_merge", &inputs::depth_ir, [] { return make_shared< rs2::hdr_merge >(); } },
+        { "yuy_decoder", &inputs::color, [] { return make_shared< rs2::yuy_decoder >(); } },
+        { "depth_huffman_decoder", &inputs::z16h, [] { return make_shared< rs2::depth_huffman_decoder >(); } },
+    };
+}
+
+
+// Why a case cannot run with the given inputs, or an empty string if it can
+string skip_reason( bench_case const & c, inputs const & in )
+{
+    if( ! ( in.*c.input ).empty() )
+    {
+        if( c.name == "yuy_decoder" && in.color.front().get_profile().format() != RS2_FORMAT_YUYV )
+            return "color stream is not YUYV";
+        return {};
+    }
+    if( c.input == &inputs::z16h )
+        return "recording has no Z16H depth stream";
+    if( c.input == &inputs::depth_ir )
+        return "needs depth and infrared frames with HDR sequence metadata";
+    if( c.input == &inputs::depth_color || c.input == &inputs::color )
+        return "needs a color stream";
+    return "needs a depth stream";
+}
+
+
+json run_case( bench_case const & c, inputs const & in, int frames, int warmup )
+{
+    auto & frames_in = in.*c.input;
+    auto block = c.make();
+
+    auto vf = frames_in.front().as< rs2::video_frame >();
+    if( auto fs = frames_in.front().as< rs2::frameset >() )
+        vf = fs.get_depth_frame();
+    auto pixels = vf.get_width() * vf.get_height();
+
+    for( int i = 0; i < warmup; ++i )
+        block->process( frames_in[i % frames_in.size()] );
+
+    vector< double > ns;
+    ns.reserve( frames );
+    uint64_t allocs = 0;
+    for( int i = 0; i < frames; ++i )
+    {
+        auto & f = frames_in[i % frames_in.size()];
+        auto a0 = allocations.load();
+        auto t0 = high_resolution_clock::now();
+        auto out = block->process( f );
+        auto t1 = high_resolution_clock::now();
+        out = rs2::frame();  // returned to the pool outside of the measurement, but counted
+        allocs += allocations.load() - a0;
+        ns.push_back( double( duration_cast< nanoseconds >( t1 - t0 ).count() ) );
+    }
+
+    auto mean = accumulate( ns.begin(), ns.end(), 0.0 ) / ns.size();
+    sort( ns.begin(), ns.end() );
+    auto percentile = [&]( int p ) { return ns[min( ns.size() - 1, ns.size() * p / 100 )]; };
+
+    json res;
+    res["name"] = c.name;
+    res["width"] = vf.get_width();
+    res["height"] = vf.get_height();
+    res["frames"] = frames;
+    res["mean_ns"] = mean;
+    res["p50_ns"] = percentile( 50 );
+    res["p99_ns"] = percentile( 99 );
+    res["max_ns"] = ns.back();
+    res["ns_per_pixel"] = percentile( 50 ) / pixels;
+    res["allocations_per_frame"] = double( allocs ) / frames;
+    return res;
+}
+
+
+// The C API calls made for every frame cost little more than their wrapping (BEGIN_API_CALL in
+// src/api.h), so timing them shows the overhead of each build configuration, e.g. TRACE_API
+struct api_case
+{
+    string name;
+    int calls;  // API calls per iteration
+    function< void( rs2_frame *, int iterations ) > run;
+};
+
+
+vector< api_case > get_api_cases( rs2_frame_metadata_value metadata )
+{
+    return {
+        { "rs2_get_frame_data", 1, []( rs2_frame * f, int n ) {
+             rs2_error * e = nullptr;
+             for( int i = 0; i < n && ! e; ++i )
+                 rs2_get_frame_data( f, &e );
+             rs2::error::handle( e );
+         } },
+        { "rs2_get_frame_metadata", 1, [metadata]( rs2_frame * f, int n ) {
+             rs2_error * e = nullptr;
+             for( int i = 0; i < n && ! e; ++i )
+                 rs2_get_frame_metadata( f, metadata, &e );
+             rs2::error::handle( e );
+         } },
+        { "rs2_frame_add_ref+rs2_release_frame", 2, []( rs2_frame * f, int n ) {
+             rs2_error * e = nullptr;
+             for( int i = 0; i < n && ! e; ++i )
+             {
+                 rs2_frame_add_ref( f, &e );
+                 rs2_release_frame( f );
+             }
+             rs2::error::handle( e );
+         } },
+    };
+}
+
+
+// Times batches of 'batch' iterations, and reports the time per call
+json run_api_case( api_case const & c, rs2::frame const & f, int batches, int batch )
+{
+    auto frame = f.get();
+    c.run( frame, batch );  // warm-up
+
+    vector< double > ns;
+    ns.reserve( batches );
+    for( int i = 0; i < batches; ++i )
+    {
+        auto t0 = high_resolution_clock::now();
+        c.run( frame, batch );
+        auto t1 = high_resolution_clock::now();
+        ns.push_back( double( duration_cast< nanoseconds >( t1 - t0 ).count() ) / ( batch * c.calls ) );
+    }
+
+    auto mean = accumulate( ns.begin(), ns.end(), 0.0 ) / ns.size();
+    sort( ns.begin(), ns.end() );
+    auto percentile = [&]( int p ) { return ns[min( ns.size() - 1, ns.size() * p / 100 )]; };
+
+    json res;
+    res["name"] = c.name;
+    res["calls"] = uint64_t( batches ) * batch * c.calls;
+    res["mean_ns"] = mean;
+    res["p50_ns"] = percentile( 50 );
+    res["p99_ns"] = percentile( 99 );
+    res["max_ns"] = ns.back();
+    return res;
+}
+
+
+// Compares the median of every block and API call against a previous run; returns those that
+// got slower by more than 'tolerance' percent
+json find_regressions( json const & results, string const & baseline_path, double tolerance )
+{
+    ifstream file( baseline_path );
+    if( ! file )
+        throw runtime_error( "Could not open baseline " + baseline_path );
+    json baseline;
+    file >> baseline;
+
+    json regressions = json::array();
+    for( auto section : { "blocks", "api_calls" } )
+    {
+        map< string, double > before;
+        if( baseline.count( section ) )
+            for( auto && b : baseline[section] )
+                before[b["name"].get< string >()] = b["p50_ns"].get< double >();
+
+        for( auto && b : results[section] )
+        {
+            auto it = before.find( b["name"].get< string >() );
+            if( it == before.end() || it->second <= 0 )
+                continue;
+
+            auto change = ( b["p50_ns"].get< double >() / it->second - 1 ) * 100;
+            if( change > tolerance )
+                regressions.push_back( { { "name", it->first },
+                                         { "baseline_p50_ns", it->second },
+                                         { "p50_ns", b["p50_ns"] },
+                                         { "change_percent", change } } );
+        }
+    }
+    return regressions;
+}
+
+
+int main( int argc, char ** argv ) try
+{
+    rs2::log_to_console( RS2_LOG_SEVERITY_ERROR );
+
+    CmdLine cmd( "librealsense rs-bench tool", ' ', RS2_API_VERSION_STR );
+    ValueArg< string > input( "i", "input", "Recording (.bag) to take the frames from, instead of synthetic frames", false, "", "bag-file" );
+    ValueArg< int > width( "x", "width", "Width of the synthetic frames", false, 848, "pixels" );
+    ValueArg< int > height( "y", "height", "Height of the synthetic frames", false, 480, "pixels" );
+    ValueArg< int > count( "c", "count", "Number of distinct input frames per stream", false, 30, "frames" );
+    ValueArg< int > frames( "n", "frames", "Number of frames to measure per block", false, 300, "frames" );
+    ValueArg< int > warmup( "w", "warmup", "Number of frames to process before measuring", false, 10, "frames" );
+    ValueArg< int > api_batch( "a", "api-calls", "Number of API calls timed together when measuring their overhead", false, 1000, "calls" );
+    ValueArg< string > filter( "f", "filter", "Only benchmark the blocks whose name contains this string", false, "", "name" );
+    ValueArg< string > output( "o", "output", "Write the results to this file instead of the standard output", false, "", "json-file" );
+    ValueArg< string > baseline( "b", "baseline", "Results of a previous run; exit with an error if any block got slower", false, "", "json-file" );
+    ValueArg< double > tolerance( "t", "tolerance", "Slowdown of the median, in percent, allowed against the baseline", false, 10, "percent" );
+    cmd.add( input );
+    cmd.add( width );
+    cmd.add( height );
+    cmd.add( count );
+    cmd.add( frames );
+    cmd.add( warmup );
+    cmd.add( api_batch );
+    cmd.add( filter );
+    cmd.add( output );
+    cmd.add( baseline );
+    cmd.add( tolerance );
+    cmd.parse( argc, argv );
+
+    if( frames.getValue() <= 0 || count.getValue() <= 0 || api_batch.getValue() <= 0 )
+        throw runtime_error( "--frames, --count and --api-calls must be positive" );
+
+    // Keeps the devices producing the frames alive for as long as the frames are in use
+    rs2::context ctx;
+    rs2::software_device dev;
+    inputs in;
+    // An even number of frames keeps the HDR sequence ids paired when the inputs wrap around
+    auto distinct = count.getValue() + count.getValue() % 2;
+    if( input.isSet() )
+        load_recording( ctx, input.getValue(), distinct, in );
+    else
+        make_synthetic( dev, width.getValue(), height.getValue(), distinct, in );
+    make_derived( in );
+
+    json results;
+    results["version"] = RS2_API_VERSION_STR;
+    results["cpu"] = get_cpu();
+    results["threads"] = thread::hardware_concurrency();
+    results["input"] = in.source;
+    results["width"] = in.width;
+    results["height"] = in.height;
+    results["blocks"] = json::array();
+    results["api_calls"] = json::array();
+    results["skipped"] = json::array();
+
+    for( auto && c : get_cases() )
+    {
+        if( c.name.find( filter.getValue() ) == string::npos )
+            continue;
+
+        auto reason = skip_reason( c, in );
+        if( ! reason.empty() )
+        {
+            results["skipped"].push_back( { { "name", c.name }, { "reason", reason } } );
+            continue;
+        }
+        cerr << "Benchmarking " << c.name << "..." << endl;
+        results["blocks"].push_back( run_case( c, in, frames.getValue(), warmup.getValue() ) );
+    }
+
+    // Any metadata the frames have will do
+    auto metadata = RS2_FRAME_METADATA_COUNT;
+    if( ! in.depth.empty() )
+        for( int m = 0; m < RS2_FRAME_METADATA_COUNT && metadata == RS2_FRAME_METADATA_COUNT; ++m )
+            if( in.depth.front().supports_frame_metadata( rs2_frame_metadata_value( m ) ) )
+                metadata = rs2_frame_metadata_value( m );
+
+    for( auto && c : get_api_cases( metadata ) )
+    {
+        if( c.name.find( filter.getValue() ) == string::npos )
+            continue;
+
+        string reason;
+        if( in.depth.empty() )
+            reason = "needs a depth stream";
+        else if( c.name == "rs2_get_frame_metadata" && metadata == RS2_FRAME_METADATA_COUNT )
+            reason = "depth frames have no metadata";
+        if( ! reason.empty() )
+        {
+            results["skipped"].push_back( { { "name", c.name }, { "reason", reason } } );
+            continue;
+        }
+        cerr << "Benchmarking " << c.name << "..." << endl;
+        results["api_calls"].push_back( run_api_case( c, in.depth.front(), frames.getValue(), api_batch.getValue() ) );
+    }
+
+    int exit_code = EXIT_SUCCESS;
+    if( baseline.isSet() )
+    {
+        auto regressions = find_regressions( results, baseline.getValue(), tolerance.getValue() );
+        for( auto && r : regressions )
+            cerr << "REGRESSION: " << r["name"].get< string >() << " median went from "
+                 << r["baseline_p50_ns"].get< double >() << " ns to " << r["p50_ns"].get< double >()
+                 << " ns" << endl;
+        if( ! regressions.empty() )
+            exit_code = EXIT_FAILURE;
+        results["regressions"] = regressions;
+    }
+
+    if( output.isSet() )
+    {
+        ofstream file( output.getValue() );
+        file << results.dump( 4 ) << endl;
+    }
+    else
+        cout << results.dump( 4 ) << endl;
+
+    return exit_code;
+}
+catch( const rs2::error & e )
+{
+    cerr << "RealSense error calling " << e.get_failed_function() << "(" << e.get_failed_args() << "):\n    " << e.what() << endl;
+    return EXIT_FAILURE;
+}
+catch( const exception & e )
+{
+    cerr << e.what() << endl;
+    return EXIT_FAILURE;
+}
@@ -15,6 +15,8 @@ namespace rs2 {
             class converter_ply : public converter_base {
             protected:
                 std::string _filePath;
+                // Each frame is converted on a new worker thread, after the previous one is done
+                rs2::ply_exporter _exporter;
 
             public:
                 converter_ply(const std::string& filePath)
@@ -50,7 +52,7 @@ namespace rs2 {
                                     << "_" << std::setprecision(14) << std::fixed << frameDepth.get_timestamp()
                                     << ".ply";
 
-                                points.export_to_ply(filename.str(), frameColor);
+                                points.export_to_ply(_exporter, filename.str(), frameColor);
 
                                 std::stringstream metadata_file;
                                 metadata_file << _filePath
@@ -13,6 +13,7 @@
 #include "librealsense2/hpp/rs_options.hpp"
 #include <ipDeviceCommon/RsCommon.h>
 #include "RsUsageEnvironment.h"
+#include <compression/CompressionFactory.h>
 
 // RTSPServer implementation
 
@@ -73,7 +74,7 @@ RsRTSPServer::RsRTSPClientConnection::~RsRTSPClientConnection() {}
 void RsRTSPServer::RsRTSPClientConnection::handleCmd_DESCRIBE(char const* urlPreSuffix, char const* urlSuffix, char const* fullRequestStr) {
     fOurRTSPServer.closeAllClientSessionsForServerMediaSession(STEREO_SENSOR_NAME.c_str());
     fOurRTSPServer.closeAllClientSessionsForServerMediaSession(RGB_SENSOR_NAME.c_str());
-    
+
     RTSPServer::RTSPClientConnection::handleCmd_DESCRIBE(urlPreSuffix, urlSuffix, fullRequestStr);
 }
 
@@ -155,6 +156,7 @@ void RsRTSPServer::RsRTSPClientConnection::handleCmd_SET_PARAMETER(char const* t
 
 RsRTSPServer::RsRTSPClientSession ::RsRTSPClientSession(RTSPServer& t_ourServer, u_int32_t t_sessionId)
     : RTSPClientSession(t_ourServer, t_sessionId)
+    , m_rvlSlices(false)
 {}
 
 RsRTSPServer::RsRTSPClientSession::~RsRTSPClientSession() {
@@ -274,6 +276,13 @@ void RsRTSPServer::RsRTSPClientSession::handleCmd_SET_PARAMETER(RTSPClientConnec
 }
 void RsRTSPServer::RsRTSPClientSession::handleCmd_SETUP(RTSPServer::RTSPClientConnection* t_ourClientConnection, char const* t_urlPreSuffix, char const* t_urlSuffix, char const* t_fullRequestStr)
 {
+    // Clients that decode RVL slices say so in the User-Agent of their requests; older ones get LZ4 depth
+    std::string request(t_fullRequestStr);
+    std::string const userAgent("User-Agent:");
+    size_t begin = request.find(userAgent);
+    size_t end = begin == std::string::npos ? begin : request.find("\r\n", begin);
+    m_rvlSlices = begin != std::string::npos && request.substr(begin, end - begin).find(RVL_SLICES_TAG) != std::string::npos;
+
     RTSPServer::RTSPClientSession::handleCmd_SETUP(t_ourClientConnection, t_urlPreSuffix, t_urlSuffix, t_fullRequestStr);
     ServerMediaSubsession* subsession;
     if(t_urlSuffix[0] != '\0' && strcmp(fOurServerMediaSession->streamName(), t_urlPreSuffix) == 0)
@@ -295,7 +304,7 @@ void RsRTSPServer::RsRTSPClientSession::handleCmd_SETUP(RTSPServer::RTSPClientCo
 
 void RsRTSPServer::RsRTSPClientSession::openRsCamera()
 {
-    static_cast<RsServerMediaSession*>(fOurServerMediaSession)->openRsCamera(m_streamProfiles);
+    static_cast<RsServerMediaSession*>(fOurServerMediaSession)->openRsCamera(m_streamProfiles, m_rvlSlices);
 }
 
 void RsRTSPServer::RsRTSPClientSession::closeRsCamera()
@@ -64,6 +64,7 @@ public:
 
     private:
         std::unordered_map<long long int, rs2::frame_queue> m_streamProfiles;
+        bool m_rvlSlices; // whether the client of this session decodes RVL slices
     };
 
 protected:
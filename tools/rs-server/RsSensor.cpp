@@ -28,7 +28,7 @@ RsSensor::RsSensor(UsageEnvironment* t_env, rs2::sensor t_sensor, rs2::device t_
     m_memPool = new MemoryPool();
 }
 
-int RsSensor::open(std::unordered_map<long long int, rs2::frame_queue>& t_streamProfilesQueues)
+int RsSensor::open(std::unordered_map<long long int, rs2::frame_queue>& t_streamProfilesQueues, bool t_rvlSlices)
 {
     std::vector<rs2::stream_profile> requestedStreamProfiles;
     for(auto streamProfile : t_streamProfilesQueues)
@@ -39,10 +39,11 @@ int RsSensor::open(std::unordered_map<long long int, rs2::frame_queue>& t_stream
         if(CompressionFactory::isCompressionSupported(m_streamProfiles.at(streamProfileKey).format(), m_streamProfiles.at(streamProfileKey).stream_type()))
         {
             rs2::video_stream_profile vsp = m_streamProfiles.at(streamProfileKey);
-            std::shared_ptr<ICompression> compressPtr = CompressionFactory::getObject(vsp.width(), vsp.height(), vsp.format(), vsp.stream_type(), getStreamProfileBpp(vsp.format()));
+            std::shared_ptr<ICompression> compressPtr = CompressionFactory::getObject(vsp.width(), vsp.height(), vsp.format(), vsp.stream_type(), getStreamProfileBpp(vsp.format()), t_rvlSlices);
             if(compressPtr != nullptr)
             {
-                m_iCompress.insert(std::pair<long long int, std::shared_ptr<ICompression>>(streamProfileKey, compressPtr));
+                // Replaces the compressor of a previous session, whose client may have decoded another codec
+                m_iCompress[streamProfileKey] = compressPtr;
             }
         }
         else
@@ -78,6 +79,10 @@ int RsSensor::start(std::unordered_map<long long int, rs2::frame_queue>& t_strea
             if(CompressionFactory::isCompressionSupported(frame.get_profile().format(), frame.get_profile().stream_type()))
             {
                 unsigned char* buff = m_memPool->getNextMem();
+                if(buff == nullptr)
+                {
+                    return;
+                }
                 int frameSize = m_iCompress.at(profileKey)->compressBuffer((unsigned char*)frame.get_data(), frame.get_data_size(), buff);
                 if(frameSize == -1)
                 {
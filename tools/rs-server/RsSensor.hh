@@ -20,7 +20,8 @@ class RsSensor
 {
 public:
     RsSensor(UsageEnvironment* t_env, rs2::sensor t_sensor, rs2::device t_device);
-    int open(std::unordered_map<long long int, rs2::frame_queue>& t_streamProfilesQueues);
+    // t_rvlSlices: whether the client decodes RVL slices, for Z16 depth
+    int open(std::unordered_map<long long int, rs2::frame_queue>& t_streamProfilesQueues, bool t_rvlSlices);
     int start(std::unordered_map<long long int, rs2::frame_queue>& t_streamProfilesQueues);
     int close();
     int stop();
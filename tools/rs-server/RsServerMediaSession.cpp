@@ -18,14 +18,14 @@ RsServerMediaSession::RsServerMediaSession(UsageEnvironment& t_env, RsSensor& t_
 
 RsServerMediaSession::~RsServerMediaSession() {}
 
-void RsServerMediaSession::openRsCamera(std::unordered_map<long long int, rs2::frame_queue>& t_streamProfiles)
+void RsServerMediaSession::openRsCamera(std::unordered_map<long long int, rs2::frame_queue>& t_streamProfiles, bool t_rvlSlices)
 {
     if(m_isActive)
     {
         envir() << "sensor is already open, closing sensor and than open again...\n";
         closeRsCamera();
     }
-    m_rsSensor.open(t_streamProfiles);
+    m_rsSensor.open(t_streamProfiles, t_rvlSlices);
     m_rsSensor.start(t_streamProfiles);
     m_isActive = true;
 }
@@ -11,7 +11,7 @@ class RsServerMediaSession : public ServerMediaSession
 public:
     static RsServerMediaSession* createNew(UsageEnvironment& t_env, RsSensor& t_sensor, char const* t_streamName = NULL, char const* t_info = NULL, char const* t_description = NULL, Boolean t_isSSM = False, char const* t_miscSDPLines = NULL);
     RsSensor& getRsSensor();
-    void openRsCamera(std::unordered_map<long long int, rs2::frame_queue>& t_streamProfiles);
+    void openRsCamera(std::unordered_map<long long int, rs2::frame_queue>& t_streamProfiles, bool t_rvlSlices);
     void closeRsCamera();
 
 protected:
@@ -0,0 +1,55 @@
+// License: Apache 2.0. See LICENSE file in root directory.
+// Copyright(c) 2021 Intel Corporation. All Rights Reserved.
+
+// Unit Test Goals:
+// Align projects each depth pixel onto the other image, rounded to whole pixels: the AVX2 kernel
+// must land every depth pixel on the same pixel of the other image as the SSE kernel does.
+
+//#cmake:add-file ../../../src/cpu-features.cpp
+//#cmake:add-file ../../../src/proc/sse/sse-align-texture-map.cpp
+//#cmake:add-file ../../../src/proc/sse/avx-align.cpp
+
+#include "../simd-common.h"
+#include <src/proc/sse/sse-align.h>
+
+using namespace librealsense;
+
+
+void check_projection( size_t count, rs2_distortion dist, unsigned seed )
+{
+    auto z = make_depth( count, 97, seed );
+    std::vector< float > map_x, map_y;
+    make_rays( count, seed, map_x, map_y );
+    auto to = make_color_intrinsics( dist );
+    auto extrinsics = make_depth_to_color();
+
+    std::vector< int2 > expected( count, { -1, -1 } );
+    get_texture_map_sse( z.data(), 0.001f, count, map_x.data(), map_y.data(), expected.data(), to, extrinsics, dist );
+
+    std::vector< int2 > pixels( count, { -1, -1 } );
+    auto done = get_texture_map_avx2( z.data(), 0.001f, count, map_x.data(), map_y.data(), pixels.data(), to, extrinsics, dist );
+    require_whole_blocks( done, count, 8 );
+
+    for( size_t i = 0; i < done; ++i )
+    {
+        CAPTURE( i, z[i] );
+        REQUIRE( pixels[i].x == expected[i].x );
+        REQUIRE( pixels[i].y == expected[i].y );
+    }
+    for( size_t i = done; i < count; ++i )
+        REQUIRE( pixels[i].x == -1 );  // left for the caller
+}
+
+
+TEST_CASE( "align AVX2 texture map is bit-exact" )
+{
+    if( cpu_lacks_avx2() )
+        return;
+
+    for( size_t count : { 8, 64, 1283, 848 * 480 } )
+    {
+        CAPTURE( count );
+        check_projection( count, RS2_DISTORTION_NONE, 1 );
+        check_projection( count, RS2_DISTORTION_MODIFIED_BROWN_CONRADY, 2 );
+    }
+}
@@ -0,0 +1,42 @@
+// License: Apache 2.0. See LICENSE file in root directory.
+// Copyright(c) 2021 Intel Corporation. All Rights Reserved.
+
+// Unit Test Goals:
+// The AVX2 lookup-table coloring of depth must write the same RGB8 pixels as the colorizer's plain
+// lookup, and nothing past the pixels it reports as processed.
+
+//#cmake:add-file ../../../src/cpu-features.cpp
+//#cmake:add-file ../../../src/proc/sse/sse-colorizer.cpp
+//#cmake:add-file ../../../src/proc/sse/avx-colorizer.cpp
+
+#include "../simd-common.h"
+#include <src/proc/sse/sse-colorizer.h>
+
+using namespace librealsense;
+
+
+TEST_CASE( "colorizer AVX2 lookup" )
+{
+    if( cpu_lacks_avx2() )
+        return;
+
+    std::mt19937 gen( 1 );
+    std::vector< uint32_t > lut( 0x10000 );
+    for( auto & c : lut )
+        c = gen() & 0xffffff;
+
+    for( size_t count : { 7, 8, 9, 1000, 848 * 480 } )
+    {
+        CAPTURE( count );
+        auto depth = make_depth( count, 37, unsigned( count ) );
+
+        std::vector< uint8_t > rgb( count * 3 + 32, 0xab );
+        auto done = colorize_avx2( depth.data(), count, lut.data(), rgb.data() );
+        require_whole_blocks( done, count, 8 );
+
+        // The rest is left for the caller, untouched
+        std::vector< uint8_t > expected( rgb.size(), 0xab );
+        colorize_scalar( depth.data(), done, lut.data(), expected.data() );
+        require_same( expected, rgb );
+    }
+}
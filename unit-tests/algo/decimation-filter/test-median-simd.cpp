@@ -0,0 +1,93 @@
+// License: Apache 2.0. See LICENSE file in root directory.
+// Copyright(c) 2021 Intel Corporation. All Rights Reserved.
+
+// Unit Test Goals:
+// The vectorized median decimation must give the same results as the scalar code: the median of the
+// non-zero pixels of each patch, the lower middle one for an even count, and 0 for empty patches.
+
+//#cmake:add-file ../../../src/cpu-features.cpp
+//#cmake:add-file ../../../src/proc/sse/sse-decimation-filter.cpp
+//#cmake:add-file ../../../src/proc/sse/avx-decimation-filter.cpp
+
+#include "../simd-common.h"
+#include <src/proc/sse/sse-decimation-filter.h>
+
+#include <algorithm>
+
+using namespace librealsense;
+
+
+uint16_t reference_median( const uint16_t * in, size_t width_in, size_t scale, size_t x )
+{
+    std::vector< uint16_t > valid;
+    for( size_t n = 0; n < scale; ++n )
+        for( size_t m = 0; m < scale; ++m )
+            if( auto z = in[n * width_in + x * scale + m] )
+                valid.push_back( z );
+    if( valid.empty() )
+        return 0;
+    std::sort( valid.begin(), valid.end() );
+    return valid[( valid.size() - 1 ) / 2];
+}
+
+
+typedef size_t ( *median_kernel )( const uint16_t *, size_t, size_t, size_t, uint16_t * );
+
+// Returns the number of pixels the kernel processed
+size_t compare_with_reference( median_kernel kernel, size_t block, size_t scale, size_t width_out, unsigned seed )
+{
+    std::mt19937 gen( seed );
+    std::uniform_int_distribution< int > depth( 0, 65535 );
+    std::uniform_int_distribution< int > percent( 0, 99 );
+
+    // Varying amounts of holes, so all the counts of valid pixels occur, and the extremes of the range
+    size_t width_in = width_out * scale + scale - 1;
+    std::vector< uint16_t > in( width_in * scale );
+    for( auto & z : in )
+    {
+        auto p = percent( gen );
+        z = p < 40 ? 0 : p < 45 ? 65535 : p < 50 ? 1 : uint16_t( depth( gen ) );
+    }
+
+    std::vector< uint16_t > out( width_out, 0xdead );
+    auto done = kernel( in.data(), width_in, scale, width_out, out.data() );
+    // Whole blocks, or none when the kernel was not built with SIMD support
+    REQUIRE( done <= width_out );
+    REQUIRE( done % block == 0 );
+
+    for( size_t x = 0; x < done; ++x )
+    {
+        CAPTURE( x );
+        REQUIRE( out[x] == reference_median( in.data(), width_in, scale, x ) );
+    }
+    for( size_t x = done; x < width_out; ++x )
+        REQUIRE( out[x] == 0xdead );  // left for the caller
+    return done;
+}
+
+
+TEST_CASE( "decimation SSE median" )
+{
+    for( size_t scale : { 2, 3 } )
+        for( size_t width_out : { 7, 8, 213, 640 } )
+        {
+            CAPTURE( scale, width_out );
+            for( unsigned seed = 0; seed < 20; ++seed )
+                compare_with_reference( decimate_depth_median_sse, 8, scale, width_out, seed );
+        }
+}
+
+TEST_CASE( "decimation AVX2 median" )
+{
+    if( cpu_lacks_avx2() )
+        return;
+
+    for( size_t scale : { 2, 3 } )
+        for( size_t width_out : { 15, 16, 213, 640 } )
+        {
+            CAPTURE( scale, width_out );
+            for( unsigned seed = 0; seed < 20; ++seed )
+                require_whole_blocks( compare_with_reference( decimate_depth_median_avx2, 16, scale, width_out, seed ),
+                                      width_out, 16 );
+        }
+}
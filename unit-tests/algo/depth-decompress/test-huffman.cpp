@@ -0,0 +1,89 @@
+// License: Apache 2.0. See LICENSE file in root directory.
+// Copyright(c) 2021 Intel Corporation. All Rights Reserved.
+
+// Unit Test Goals:
+// The table-driven Z16H decoder must give the same images as unhuffimage4(), and accept or reject the
+// same compressed data. Any sequence of nibbles is valid for the state machine, so random words are
+// decoded, cut around the length that fills the image.
+
+//#cmake:add-file ../../../src/proc/huffman-decoder.cpp
+
+#include "../algo-common.h"
+#include <common/decompress-huffman.h>
+#include <src/proc/huffman-decoder.h>
+
+#include <random>
+#include <vector>
+
+using namespace librealsense;
+
+
+// The number of compressed words after which at least 'needed' bytes are decoded
+size_t words_to_fill( const std::vector< uint32_t > & words, size_t first, size_t needed )
+{
+    uint32_t state = 0;
+    size_t decoded = 0;
+    for( size_t i = first; i < words.size(); ++i )
+    {
+        for( int shift = 28; shift >= 0; shift -= 4 )
+        {
+            uint32_t step = uint32_t( DecompressionStateTable[state * 16 + ( ( words[i] >> shift ) & 0xf )] );
+            if( step & 0x8 )
+                decoded += 1 + ( step & 0x7 );
+            state = ( step >> 6 ) & 0x1ff;
+        }
+        if( decoded >= needed )
+            return i + 1;
+    }
+    return words.size();
+}
+
+
+void compare_with_reference( uint32_t width, uint32_t height, int zero_bias, unsigned seed, int & accepted )
+{
+    std::mt19937 gen( seed );
+    std::uniform_int_distribution< uint32_t > bits;
+
+    // Biasing nibbles to 0xf makes long runs of unchanged bytes, as in real depth
+    uint32_t stride = width * 2;
+    std::vector< uint32_t > words( ( stride + 3 ) / 4 + stride * height );
+    for( auto & w : words )
+    {
+        w = bits( gen );
+        for( int n = 0; n < zero_bias; ++n )
+            w |= 0xf << ( 4 * ( bits( gen ) % 8 ) );
+    }
+
+    auto first = ( stride + 3 ) / 4;
+    auto fill = words_to_fill( words, first, size_t( stride ) * ( height - 1 ) );
+    REQUIRE( fill < words.size() );
+    for( size_t length = fill - 1; length <= fill + 1; ++length )
+    {
+        CAPTURE( width, height, seed, length );
+        std::vector< uint32_t > data( words.begin(), words.begin() + length );
+        // unhuffimage4() may write a little past the end of the image for corrupt data
+        std::vector< uint8_t > expected( stride * height + 64 ), actual( stride * height );
+
+        bool expected_ok = unhuffimage4( data.data(), uint32_t( length ), stride, height, expected.data() );
+        bool ok = decompress_huffman_depth( data.data(), uint32_t( length ), stride, height, actual.data() );
+        REQUIRE( ok == expected_ok );
+        if( ok )
+        {
+            ++accepted;
+            REQUIRE( std::equal( actual.begin(), actual.end(), expected.begin() ) );
+        }
+    }
+}
+
+
+TEST_CASE( "table-driven Huffman decoder matches unhuffimage4" )
+{
+    int accepted = 0;
+    for( uint32_t width : { 32, 100, 848 } )
+        for( uint32_t height : { 3, 17, 480 } )
+            for( int zero_bias : { 0, 2, 6 } )
+                for( unsigned seed = 0; seed < 10; ++seed )
+                    compare_with_reference( width, height, zero_bias, seed, accepted );
+    // Most cut lengths are rejected, but exact fits must be hit too
+    REQUIRE( accepted > 50 );
+}
@@ -0,0 +1,110 @@
+// License: Apache 2.0. See LICENSE file in root directory.
+// Copyright(c) 2021 Intel Corporation. All Rights Reserved.
+
+// Unit Test Goals:
+// Every vectorized format-converter kernel must give exactly the same output planes as the scalar
+// kernel of its format pair, for any input bytes and any number of pixels, and write nothing past
+// the pixels it was given. On a CPU with AVX2, the AVX2 kernels must process all their whole blocks
+// rather than leave half of them to the SSE code.
+
+//#cmake:add-file ../../../src/cpu-features.cpp
+//#cmake:add-file ../../../src/proc/format-converter-kernels.cpp
+//#cmake:add-file ../../../src/proc/sse/sse-format-converters.cpp
+//#cmake:add-file ../../../src/proc/sse/avx-format-converters.cpp
+
+#include "../simd-common.h"
+#include <src/proc/format-converter-kernels.h>
+#include <src/proc/sse/sse-format-converters.h>
+
+using namespace librealsense;
+
+
+// Output planes are at most 3 bytes per pixel (RGB8); the sources at most 4 (INZI, Y16I)
+const size_t max_out_bpp = 3;
+const size_t max_in_bpp = 4;
+const size_t guard = 64;
+
+
+std::vector< std::vector< uint8_t > > convert( format_converter_kernel kernel, const std::vector< uint8_t > & in, size_t count )
+{
+    std::vector< std::vector< uint8_t > > out( 2, std::vector< uint8_t >( count * max_out_bpp + guard, 0xcd ) );
+    uint8_t * const dest[] = { out[0].data(), out[1].data() };
+    kernel( dest, in.data(), count );
+    return out;
+}
+
+
+TEST_CASE( "format converter kernels match the scalar ones" )
+{
+    auto & kernels = get_format_converter_kernels();
+    std::mt19937 gen( 0 );
+    std::uniform_int_distribution< int > byte( 0, 255 );
+
+    int compared = 0;
+    for( auto & k : kernels )
+    {
+        if( k.isa == simd_isa::scalar || ( k.isa == simd_isa::avx2 && ! cpu_has_avx2() ) )
+            continue;
+
+        auto scalar = std::find_if( kernels.begin(), kernels.end(), [&]( const format_converter_kernel_info & s ) {
+            return s.source == k.source && s.target == k.target && s.isa == simd_isa::scalar;
+        } );
+        REQUIRE( scalar != kernels.end() );
+
+        // Around the block sizes of the kernels (5 to 32 pixels), and a whole image
+        for( size_t count : { 0, 1, 4, 5, 8, 15, 16, 17, 20, 31, 32, 33, 40, 63, 64, 100, 848 * 480 } )
+        {
+            CAPTURE( int( k.source ), int( k.target ), int( k.isa ), count );
+            std::vector< uint8_t > in( count * max_in_bpp + guard );
+            for( auto & b : in )
+                b = uint8_t( byte( gen ) );
+
+            auto expected = convert( scalar->kernel, in, count );
+            auto actual = convert( k.kernel, in, count );
+            REQUIRE( actual == expected );
+            ++compared;
+        }
+    }
+    REQUIRE( compared > 0 );
+}
+
+
+TEST_CASE( "format converter kernels dispatch to a kernel of each pair" )
+{
+    for( auto & k : get_format_converter_kernels() )
+    {
+        CAPTURE( int( k.source ), int( k.target ) );
+        auto best = get_format_converter_kernel( k.source, k.target );
+        REQUIRE( best );
+        if( k.isa == simd_isa::avx2 && cpu_has_avx2() )
+            REQUIRE( best == k.kernel );
+    }
+    REQUIRE( ! get_format_converter_kernel( RS2_FORMAT_Z16, RS2_FORMAT_RGB8 ) );
+}
+
+
+TEST_CASE( "format converter AVX2 kernels process whole AVX2 blocks" )
+{
+    if( cpu_lacks_avx2() )
+        return;
+
+    // Half a block more than whole ones, which the SSE code, with blocks half as large, would process
+    for( size_t blocks : { 1, 10, 848 * 480 / 32 } )
+    {
+        CAPTURE( blocks );
+        std::vector< uint8_t > in( ( blocks + 1 ) * 32 * max_in_bpp );
+        std::vector< uint8_t > out1( ( blocks + 1 ) * 32 * 2 ), out2( out1.size() );
+        auto in16 = reinterpret_cast< const uint16_t * >( in.data() );
+        auto out16 = reinterpret_cast< uint16_t * >( out1.data() );
+        auto out16_2 = reinterpret_cast< uint16_t * >( out2.data() );
+
+        size_t count = blocks * 32 + 16;
+        require_whole_blocks( split_y8i_avx2( in.data(), count, out1.data(), out2.data() ), count, 32 );
+        require_whole_blocks( y10_to_y8_avx2( in16, count, out1.data() ), count, 32 );
+        require_whole_blocks( unpack_y10bpack_avx2( in.data(), count, out16 ), count, 32 );
+
+        count = blocks * 16 + 8;
+        require_whole_blocks( split_y16i_avx2( in16, count, out16, out16_2 ), count, 16 );
+        require_whole_blocks( y10_to_y16_avx2( in16, count, out16 ), count, 16 );
+    }
+}
@@ -0,0 +1,242 @@
+// License: Apache 2.0. See LICENSE file in root directory.
+// Copyright(c) 2021 Intel Corporation. All Rights Reserved.
+
+// Unit Test Goals:
+// The PLY files of ply_writer must hold the same vertices, normals, colors and faces as the serial
+// export it replaced, whatever the number of threads writing the rows, and a writer must give the
+// same file when reused.
+
+//#cmake:add-file ../../../src/ply-writer.cpp
+
+#include "../algo-common.h"
+#include <src/ply-writer.h>
+
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+#include <fstream>
+#include <iterator>
+#include <map>
+#include <random>
+#include <vector>
+
+using namespace librealsense;
+
+
+// The body of the file written by the serial export (points::export_to_ply), with the faces in
+// row-major order and the normals computed as save_to_ply did, face by face. Colors are taken
+// from the texture pixel nearest to each vertex's coordinates, clamped to the image.
+std::string reference_body( const std::vector< float3 > & v, int width, int height, bool normals,
+                            const float2 * uv = nullptr, const ply_writer::texture * tex = nullptr )
+{
+    auto valid = []( const float3 & p ) {
+        return std::fabs( p.x ) >= 1e-6 || std::fabs( p.y ) >= 1e-6 || std::fabs( p.z ) >= 1e-6;
+    };
+    auto flip = []( const float3 & p ) { return float3{ p.x, -p.y, -p.z }; };
+    auto cross = []( const float3 & a, const float3 & b ) {
+        return float3{ a.y * b.z - a.z * b.y, a.z * b.x - a.x * b.z, a.x * b.y - a.y * b.x };
+    };
+
+    std::map< int, int > index;
+    std::vector< float3 > vertices;
+    std::vector< const uint8_t * > colors;
+    for( int i = 0; i < width * height; ++i )
+        if( valid( v[i] ) )
+        {
+            index[i] = int( vertices.size() );
+            vertices.push_back( flip( v[i] ) );
+            if( uv && tex )
+            {
+                int tx = std::min( std::max( int( uv[i].x * tex->width + .5f ), 0 ), tex->width - 1 );
+                int ty = std::min( std::max( int( uv[i].y * tex->height + .5f ), 0 ), tex->height - 1 );
+                colors.push_back( tex->data + ty * tex->stride + tx * tex->bpp );
+            }
+        }
+
+    const float threshold = 0.05f;
+    std::vector< int > faces;
+    std::map< int, std::vector< float3 > > face_normals;
+    for( int y = 0; y < height - 1; ++y )
+        for( int x = 0; x < width - 1; ++x )
+        {
+            int a = y * width + x, b = a + 1, c = a + width, d = c + 1;
+            if( ! ( v[a].z && v[b].z && v[c].z && v[d].z && std::fabs( v[a].z - v[b].z ) < threshold
+                    && std::fabs( v[a].z - v[c].z ) < threshold && std::fabs( v[b].z - v[d].z ) < threshold
+                    && std::fabs( v[c].z - v[d].z ) < threshold ) )
+                continue;
+            if( ! index.count( a ) || ! index.count( b ) || ! index.count( c ) || ! index.count( d ) )
+                continue;
+            faces.insert( faces.end(), { index[a], index[d], index[b], index[d], index[a], index[c] } );
+
+            auto n1 = cross( flip( v[d] ) - flip( v[a] ), flip( v[b] ) - flip( v[a] ) );
+            auto n2 = cross( flip( v[c] ) - flip( v[a] ), flip( v[d] ) - flip( v[a] ) );
+            face_normals[index[a]].insert( face_normals[index[a]].end(), { n1, n2 } );
+            face_normals[index[b]].push_back( n1 );
+            face_normals[index[c]].push_back( n2 );
+            face_normals[index[d]].insert( face_normals[index[d]].end(), { n1, n2 } );
+        }
+
+    std::string body;
+    for( int i = 0; i < int( vertices.size() ); ++i )
+    {
+        body.append( reinterpret_cast< const char * >( &vertices[i] ), sizeof( float3 ) );
+        if( normals )
+        {
+            float3 sum = { 0, 0, 0 };
+            for( auto & n : face_normals[i] )
+                sum = sum + n;
+            if( ! face_normals[i].empty() )
+                sum = sum * ( 1.f / std::sqrt( sum.x * sum.x + sum.y * sum.y + sum.z * sum.z ) );
+            body.append( reinterpret_cast< const char * >( &sum ), sizeof( float3 ) );
+        }
+        if( ! colors.empty() )
+            body.append( reinterpret_cast< const char * >( colors[i] ), 3 );
+    }
+    for( size_t i = 0; i < faces.size(); i += 3 )
+    {
+        char three = 3;
+        body.append( &three, 1 );
+        body.append( reinterpret_cast< const char * >( &faces[i] ), 3 * sizeof( int ) );
+    }
+    return body;
+}
+
+std::string read_file( const std::string & fname )
+{
+    std::ifstream in( fname, std::ios_base::binary );
+    return std::string( std::istreambuf_iterator< char >( in ), std::istreambuf_iterator< char >() );
+}
+
+// A cloud of surfaces at random depths, with holes and depth discontinuities
+std::vector< float3 > make_cloud( int width, int height )
+{
+    std::mt19937 gen( 7 );
+    std::uniform_real_distribution< float > xy( -1.f, 1.f ), z( 0.5f, 0.56f );
+    std::vector< float3 > cloud( width * height );
+    for( auto & p : cloud )
+    {
+        p = { xy( gen ), xy( gen ), z( gen ) };
+        if( gen() % 8 == 0 )
+            p = { 0, 0, 0 };
+        else if( gen() % 16 == 0 )
+            p.z = 0;
+    }
+    return cloud;
+}
+
+
+TEST_CASE( "ply_writer matches the serial export", "[ply]" )
+{
+    const int width = 64, height = 48;
+    auto cloud = make_cloud( width, height );
+    const std::string fname = "test-ply-writer.ply";
+
+    // A single thread, fewer threads than rows, and more (most then have nothing to do)
+    for( size_t threads : { 1, 3, 8, 64 } )
+    for( bool normals : { false, true } )
+    {
+        CAPTURE( threads, normals );
+        ply_writer writer( threads );
+        ply_writer::options opts;
+        opts.normals = normals;
+        writer.write( fname, cloud.data(), width, height, nullptr, nullptr, opts );
+
+        auto file = read_file( fname );
+        auto end = file.find( "end_header\n" );
+        REQUIRE( end != std::string::npos );
+        auto header = file.substr( 0, end );
+        CAPTURE( header );
+        REQUIRE( ( header.find( "property float32 nx" ) != std::string::npos ) == normals );
+        REQUIRE( header.find( "element face" ) != std::string::npos );
+
+        auto body = file.substr( end + strlen( "end_header\n" ) );
+        auto expected = reference_body( cloud, width, height, normals );
+        REQUIRE( body.size() == expected.size() );
+        if( ! normals )
+            REQUIRE( body == expected );
+        else
+        {
+            // The normals are summed in another order: compare the floats approximately
+            int vertex_count = std::stoi( header.substr( header.find( "element vertex " ) + 15 ) );
+            size_t vertices_size = vertex_count * 6 * sizeof( float );
+            std::vector< float > out( vertex_count * 6 ), ref( vertex_count * 6 );
+            memcpy( out.data(), body.data(), vertices_size );
+            memcpy( ref.data(), expected.data(), vertices_size );
+            for( int i = 0; i < vertex_count * 6; ++i )
+                REQUIRE( std::fabs( out[i] - ref[i] ) < 1e-4f );
+            REQUIRE( body.substr( vertices_size ) == expected.substr( vertices_size ) );
+        }
+    }
+
+    // Reused for the same cloud, the writer must write the same file
+    ply_writer writer;
+    writer.write( fname, cloud.data(), width, height, nullptr, nullptr, ply_writer::options() );
+    auto first = read_file( fname );
+    writer.write( fname, cloud.data(), width, height, nullptr, nullptr, ply_writer::options() );
+    REQUIRE( read_file( fname ) == first );
+    std::remove( fname.c_str() );
+}
+
+
+TEST_CASE( "ply_writer without a mesh", "[ply]" )
+{
+    const int width = 16, height = 8;
+    auto cloud = make_cloud( width, height );
+    const std::string fname = "test-ply-writer.ply";
+
+    ply_writer::options opts;
+    opts.mesh = false;
+    opts.normals = true;  // ignored without the mesh
+    ply_writer().write( fname, cloud.data(), width, height, nullptr, nullptr, opts );
+
+    auto file = read_file( fname );
+    auto end = file.find( "end_header\n" );
+    REQUIRE( file.substr( 0, end ).find( "element face" ) == std::string::npos );
+    REQUIRE( file.substr( 0, end ).find( "nx" ) == std::string::npos );
+
+    auto expected = reference_body( cloud, width, height, false );
+    auto body = file.substr( end + strlen( "end_header\n" ) );
+    REQUIRE( expected.substr( 0, body.size() ) == body );
+    std::remove( fname.c_str() );
+}
+
+
+TEST_CASE( "ply_writer with colors", "[ply]" )
+{
+    const int width = 40, height = 30;
+    auto cloud = make_cloud( width, height );
+    const std::string fname = "test-ply-writer.ply";
+
+    // Texture coordinates are partly outside the image, as they are at the edges of a real cloud
+    std::mt19937 gen( 11 );
+    std::uniform_real_distribution< float > coord( -0.1f, 1.1f );
+    std::vector< float2 > uv( width * height );
+    for( auto & c : uv )
+        c = { coord( gen ), coord( gen ) };
+
+    // RGB8 and, with a padded stride, RGBA8 textures of another size than the cloud
+    for( int bpp : { 3, 4 } )
+    {
+        const int tex_width = 25, tex_height = 17, stride = tex_width * bpp + 8;
+        std::vector< uint8_t > pixels( stride * tex_height );
+        for( size_t i = 0; i < pixels.size(); ++i )
+            pixels[i] = uint8_t( gen() );
+        ply_writer::texture tex = { pixels.data(), tex_width, tex_height, bpp, stride };
+
+        for( size_t threads : { 1, 4 } )
+        {
+            CAPTURE( bpp, threads );
+            ply_writer( threads ).write( fname, cloud.data(), width, height, uv.data(), &tex, ply_writer::options() );
+
+            auto file = read_file( fname );
+            auto end = file.find( "end_header\n" );
+            REQUIRE( end != std::string::npos );
+            auto header = file.substr( 0, end );
+            REQUIRE( header.find( "property uchar red\nproperty uchar green\nproperty uchar blue\n" ) != std::string::npos );
+
+            auto body = file.substr( end + strlen( "end_header\n" ) );
+            REQUIRE( body == reference_body( cloud, width, height, false, uv.data(), &tex ) );
+        }
+    }
+    std::remove( fname.c_str() );
+}
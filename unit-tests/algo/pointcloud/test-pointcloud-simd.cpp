@@ -0,0 +1,87 @@
+// License: Apache 2.0. See LICENSE file in root directory.
+// Copyright(c) 2021 Intel Corporation. All Rights Reserved.
+
+// Unit Test Goals:
+// The pointcloud's AVX2 kernels must match its SSE ones: the vertices deprojected from depth, and
+// their texture coordinates and pixels in the color image, for every distortion model of the latter.
+
+//#cmake:add-file ../../../src/cpu-features.cpp
+//#cmake:add-file ../../../src/proc/sse/sse-pointcloud-kernels.cpp
+//#cmake:add-file ../../../src/proc/sse/avx-pointcloud.cpp
+
+#include "../simd-common.h"
+#include <src/proc/sse/sse-pointcloud.h>
+
+using namespace librealsense;
+
+
+// Deprojects with both kernels, returning the SSE vertices
+std::vector< float3 > check_deprojection( std::vector< uint16_t > const & z, unsigned seed )
+{
+    size_t count = z.size();
+    std::vector< float > map_x, map_y;
+    make_rays( count, seed, map_x, map_y );
+
+    std::vector< float3 > expected( count );
+    deproject_depth_sse( z.data(), 0.001f, count, map_x.data(), map_y.data(), expected.data() );
+
+    std::vector< float3 > points( count, { -1, -1, -1 } );
+    auto done = deproject_depth_avx2( z.data(), 0.001f, count, map_x.data(), map_y.data(), points.data() );
+    require_whole_blocks( done, count, 8 );
+    for( size_t i = 0; i < done; ++i )
+    {
+        CAPTURE( i, z[i] );
+        require_same( expected[i].x, points[i].x );
+        require_same( expected[i].y, points[i].y );
+        require_same( expected[i].z, points[i].z );
+    }
+    for( size_t i = done; i < count; ++i )
+        REQUIRE( points[i].z == -1 );  // left for the caller
+    return expected;
+}
+
+// Maps the vertices, including those of holes (at the origin), with both kernels
+void check_texture_map( std::vector< float3 > const & points, rs2_distortion dist )
+{
+    size_t count = points.size();
+    auto color = make_color_intrinsics( dist );
+    auto extrinsics = make_depth_to_color();
+
+    std::vector< float2 > expected_texture( count ), expected_pixels( count );
+    get_texture_map_sse( points.data(), count, color, extrinsics, expected_texture.data(), expected_pixels.data() );
+
+    std::vector< float2 > texture( count, { -1, -1 } ), pixels( count, { -1, -1 } );
+    auto mapped = get_texture_map_avx2( points.data(), count, color, extrinsics, texture.data(), pixels.data() );
+    require_whole_blocks( mapped, count, 8 );
+    for( size_t i = 0; i < mapped; ++i )
+    {
+        CAPTURE( i, points[i].z );
+        require_same( expected_pixels[i].x, pixels[i].x );
+        require_same( expected_pixels[i].y, pixels[i].y );
+        require_same( expected_texture[i].x, texture[i].x );
+        require_same( expected_texture[i].y, texture[i].y );
+    }
+    for( size_t i = mapped; i < count; ++i )
+        REQUIRE( pixels[i].x == -1 );  // left for the caller
+}
+
+
+TEST_CASE( "pointcloud AVX2 deprojection and texture map are bit-exact" )
+{
+    if( cpu_lacks_avx2() )
+        return;
+
+    for( size_t count : { 8, 64, 1283, 848 * 480 } )
+    {
+        CAPTURE( count );
+        auto points = check_deprojection( make_depth( count, 97, 1 ), 1 );
+        for( auto dist : { RS2_DISTORTION_NONE,
+                           RS2_DISTORTION_MODIFIED_BROWN_CONRADY,
+                           RS2_DISTORTION_INVERSE_BROWN_CONRADY,
+                           RS2_DISTORTION_BROWN_CONRADY } )
+        {
+            CAPTURE( dist );
+            check_texture_map( points, dist );
+        }
+    }
+}
@@ -0,0 +1,115 @@
+// License: Apache 2.0. See LICENSE file in root directory.
+// Copyright(c) 2021 Intel Corporation. All Rights Reserved.
+
+#pragma once
+
+// Common to the tests of the vectorized kernels (src/proc/sse): each is compared, bit for bit, with
+// the code the library runs without it.
+// The AVX2 kernels are built for AVX2 in the unit tests as they are in the library (see
+// unit-test-config.py), so on a CPU with AVX2 they must process all their whole blocks.
+
+#include "algo-common.h"
+#include <src/cpu-features.h>
+#include <librealsense2/h/rs_sensor.h>
+
+#include <cmath>
+#include <cstring>
+#include <random>
+#include <vector>
+
+
+// The AVX2 kernels must only be called when the CPU supports them; tests of them return early if not
+inline bool cpu_lacks_avx2()
+{
+    if( librealsense::cpu_has_avx2() )
+        return false;
+    WARN( "The CPU does not support AVX2: the AVX2 kernels are not tested" );
+    return true;
+}
+
+
+// A vectorized kernel processes whole blocks of 'block' items from the start, and leaves the rest
+inline void require_whole_blocks( size_t done, size_t count, size_t block )
+{
+    REQUIRE( done == count - count % block );
+}
+
+
+template< class T >
+void require_same( std::vector< T > const & expected, std::vector< T > const & actual )
+{
+    REQUIRE( expected.size() == actual.size() );
+    // Bit-exact, including the sign of zeros
+    REQUIRE( std::memcmp( expected.data(), actual.data(), expected.size() * sizeof( T ) ) == 0 );
+}
+
+inline void require_same( float expected, float actual )
+{
+    REQUIRE( std::memcmp( &expected, &actual, sizeof( float ) ) == 0 );
+}
+
+
+// Depth of a surface sloping along each 'period' pixels, with noise, holes and far outliers, so that
+// every branch of the filters is taken
+inline std::vector< uint16_t > make_depth( size_t count, size_t period, unsigned seed )
+{
+    std::mt19937 gen( seed );
+    std::uniform_int_distribution< int > noise( -12, 12 );
+    std::uniform_int_distribution< int > event( 0, 99 );
+    std::vector< uint16_t > depth( count );
+    for( size_t i = 0; i < count; ++i )
+    {
+        int e = event( gen );
+        if( e < 10 )
+            depth[i] = 0;
+        else if( e < 15 )
+            depth[i] = uint16_t( 60000 + noise( gen ) * 400 );
+        else
+            depth[i] = uint16_t( 1000 + ( i % period ) * 4 + noise( gen ) );
+    }
+    return depth;
+}
+
+// The disparity of make_depth(), with holes of both signs of zero and a few negative (invalid) values
+inline std::vector< float > make_disparity( size_t count, size_t period, unsigned seed )
+{
+    auto depth = make_depth( count, period, seed );
+    std::vector< float > disparity( count );
+    for( size_t i = 0; i < count; ++i )
+    {
+        if( depth[i] )
+            disparity[i] = 50000.f / depth[i];
+        else
+            disparity[i] = i % 7 ? 0.f : i % 3 ? -0.f : -1.f;
+    }
+    return disparity;
+}
+
+
+// The (x, y) ray maps of depth pixels, which the deprojection kernels scale by their depth
+inline void make_rays( size_t count, unsigned seed, std::vector< float > & map_x, std::vector< float > & map_y )
+{
+    std::mt19937 gen( seed );
+    std::uniform_real_distribution< float > ray( -0.6f, 0.6f );
+    map_x.resize( count );
+    map_y.resize( count );
+    for( size_t i = 0; i < count; ++i )
+    {
+        map_x[i] = ray( gen );
+        map_y[i] = ray( gen );
+    }
+}
+
+// A color camera next to the depth one: slightly rotated and offset, with strong distortion
+// coefficients so that the distortion models make a difference
+inline rs2_intrinsics make_color_intrinsics( rs2_distortion dist )
+{
+    return { 1280, 720, 641.5f, 358.25f, 912.f, 911.f, dist, { 0.12f, -0.21f, 0.003f, -0.002f, 0.05f } };
+}
+
+inline rs2_extrinsics make_depth_to_color()
+{
+    float a = 0.02f;
+    return { { std::cos( a ), std::sin( a ), 0.001f, -std::sin( a ), std::cos( a ), 0, 0, 0, 1 },
+             { 0.015f, -0.0002f, 0.0003f } };
+}
@@ -0,0 +1,77 @@
+// License: Apache 2.0. See LICENSE file in root directory.
+// Copyright(c) 2021 Intel Corporation. All Rights Reserved.
+
+// Unit Test Goals:
+// The vectorized vertical passes of the spatial filter must be bit-exact with the scalar ones.
+
+//#cmake:add-file ../../../src/cpu-features.cpp
+//#cmake:add-file ../../../src/proc/sse/sse-spatial-filter.cpp
+//#cmake:add-file ../../../src/proc/sse/avx-spatial-filter.cpp
+
+#include "../simd-common.h"
+#include <src/proc/sse/sse-spatial-filter.h>
+
+using namespace librealsense;
+
+
+// Filters the image with the kernel, then the columns it leaves with the scalar passes, as spatial_filter
+// does, and compares with the scalar passes alone; returns the number of columns the kernel processed
+template< class T, class Kernel >
+size_t compare_with_scalar( std::vector< T > const & input, size_t width, size_t height, float alpha, T delta_z, Kernel kernel )
+{
+    auto expected = input;
+    spatial_filter_vertical_scalar( expected.data(), width, height, 0, alpha, delta_z );
+
+    auto actual = input;
+    auto done = kernel( actual.data(), width, height, alpha, delta_z );
+    REQUIRE( done <= width );
+    spatial_filter_vertical_scalar( actual.data(), width, height, done, alpha, delta_z );
+
+    require_same( expected, actual );
+    return done;
+}
+
+
+TEST_CASE( "spatial filter vertical SSE pass is bit-exact" )
+{
+    size_t const sizes[][2] = { { 64, 48 }, { 77, 31 }, { 7, 5 }, { 16, 2 } };
+    for( auto & s : sizes )
+    {
+        size_t w = s[0], h = s[1];
+        CAPTURE( w, h );
+        compare_with_scalar( make_depth( w * h, w, 1 ), w, h, 0.5f, uint16_t( 20 ),
+            []( uint16_t * i, size_t w, size_t h, float a, uint16_t d ) { return spatial_filter_vertical_sse( i, w, h, a, d ); } );
+        compare_with_scalar( make_depth( w * h, w, 2 ), w, h, 0.37f, uint16_t( 1 ),
+            []( uint16_t * i, size_t w, size_t h, float a, uint16_t d ) { return spatial_filter_vertical_sse( i, w, h, a, d ); } );
+        compare_with_scalar( make_disparity( w * h, w, 3 ), w, h, 0.5f, 0.5f,
+            []( float * i, size_t w, size_t h, float a, float d ) { return spatial_filter_vertical_sse( i, w, h, a, d ); } );
+        compare_with_scalar( make_disparity( w * h, w, 4 ), w, h, 0.81f, 20.f,
+            []( float * i, size_t w, size_t h, float a, float d ) { return spatial_filter_vertical_sse( i, w, h, a, d ); } );
+    }
+}
+
+TEST_CASE( "spatial filter vertical AVX2 pass is bit-exact" )
+{
+    if( cpu_lacks_avx2() )
+        return;
+
+    // 16 depth or 8 disparity columns at a time
+    size_t const sizes[][2] = { { 64, 48 }, { 77, 31 }, { 15, 5 }, { 1280, 2 } };
+    for( auto & s : sizes )
+    {
+        size_t w = s[0], h = s[1];
+        CAPTURE( w, h );
+        require_whole_blocks( compare_with_scalar( make_depth( w * h, w, 5 ), w, h, 0.5f, uint16_t( 20 ),
+            []( uint16_t * i, size_t w, size_t h, float a, uint16_t d ) { return spatial_filter_vertical_avx2( i, w, h, a, d ); } ),
+            w, 16 );
+        require_whole_blocks( compare_with_scalar( make_depth( w * h, w, 6 ), w, h, 0.25f, uint16_t( 50 ),
+            []( uint16_t * i, size_t w, size_t h, float a, uint16_t d ) { return spatial_filter_vertical_avx2( i, w, h, a, d ); } ),
+            w, 16 );
+        require_whole_blocks( compare_with_scalar( make_disparity( w * h, w, 7 ), w, h, 0.5f, 0.5f,
+            []( float * i, size_t w, size_t h, float a, float d ) { return spatial_filter_vertical_avx2( i, w, h, a, d ); } ),
+            w, 8 );
+        require_whole_blocks( compare_with_scalar( make_disparity( w * h, w, 8 ), w, h, 0.81f, 20.f,
+            []( float * i, size_t w, size_t h, float a, float d ) { return spatial_filter_vertical_avx2( i, w, h, a, d ); } ),
+            w, 8 );
+    }
+}
@@ -0,0 +1,103 @@
+// License: Apache 2.0. See LICENSE file in root directory.
+// Copyright(c) 2021 Intel Corporation. All Rights Reserved.
+
+// Unit Test Goals:
+// The vectorized temporal filter must be bit-exact with the scalar one over a sequence of frames,
+// including the history it keeps between frames.
+
+//#cmake:add-file ../../../src/cpu-features.cpp
+//#cmake:add-file ../../../src/proc/sse/sse-temporal-filter.cpp
+//#cmake:add-file ../../../src/proc/sse/avx-temporal-filter.cpp
+
+#include "../simd-common.h"
+#include <src/proc/sse/sse-temporal-filter.h>
+
+using namespace librealsense;
+
+
+template< class T >
+std::vector< T > make_frame( size_t count, unsigned seed );
+
+template<>
+std::vector< uint16_t > make_frame( size_t count, unsigned seed )
+{
+    return make_depth( count, 37, seed );
+}
+
+template<>
+std::vector< float > make_frame( size_t count, unsigned seed )
+{
+    return make_disparity( count, 37, seed );
+}
+
+
+// Smooths a sequence of frames with the kernel, then the pixels it leaves with the scalar code, as
+// temporal_filter does, and compares with the scalar code alone, history included; returns the number
+// of pixels the kernel processed in each frame
+template< class T, class Kernel >
+size_t compare_sequence( size_t count, float alpha, uint8_t delta, Kernel kernel )
+{
+    std::mt19937 gen( 17 );
+    std::vector< T > last_expected( count ), last_actual( count );
+    std::vector< uint8_t > history_expected( count ), history_actual( count );
+
+    size_t done = 0;
+    for( unsigned index = 0; index < 20; ++index )
+    {
+        CAPTURE( index );
+        temporal_smooth_params params;
+        params.alpha = alpha;
+        params.one_minus_alpha = 1.f - alpha;
+        params.delta_z = delta;
+        params.mask = uint8_t( 1 << ( index % 8 ) );
+        for( auto & b : params.persistent )
+            b = uint8_t( gen() );
+
+        auto expected = make_frame< T >( count, index );
+        auto actual = expected;
+
+        temporal_filter_smooth_scalar( expected.data(), last_expected.data(), history_expected.data(), count, params );
+
+        done = kernel( actual.data(), last_actual.data(), history_actual.data(), count, params );
+        REQUIRE( done <= count );
+        temporal_filter_smooth_scalar( actual.data() + done, last_actual.data() + done, history_actual.data() + done, count - done, params );
+
+        require_same( expected, actual );
+        require_same( last_expected, last_actual );
+        require_same( history_expected, history_actual );
+    }
+    return done;
+}
+
+
+TEST_CASE( "temporal filter SSE smoothing is bit-exact" )
+{
+    for( size_t count : { 848 * 4, 1001, 3 } )
+    {
+        CAPTURE( count );
+        compare_sequence< uint16_t >( count, 0.4f, 20, []( uint16_t * f, uint16_t * l, uint8_t * h, size_t n, temporal_smooth_params const & p ) {
+            return temporal_filter_smooth_sse( f, l, h, n, p );
+        } );
+        compare_sequence< float >( count, 0.33f, 1, []( float * f, float * l, uint8_t * h, size_t n, temporal_smooth_params const & p ) {
+            return temporal_filter_smooth_sse( f, l, h, n, p );
+        } );
+    }
+}
+
+TEST_CASE( "temporal filter AVX2 smoothing is bit-exact" )
+{
+    if( cpu_lacks_avx2() )
+        return;
+
+    // 16 depth or 8 disparity pixels at a time
+    for( size_t count : { 848 * 4, 1001, 7 } )
+    {
+        CAPTURE( count );
+        require_whole_blocks( compare_sequence< uint16_t >( count, 0.4f, 20, []( uint16_t * f, uint16_t * l, uint8_t * h, size_t n, temporal_smooth_params const & p ) {
+            return temporal_filter_smooth_avx2( f, l, h, n, p );
+        } ), count, 16 );
+        require_whole_blocks( compare_sequence< float >( count, 0.33f, 1, []( float * f, float * l, uint8_t * h, size_t n, temporal_smooth_params const & p ) {
+            return temporal_filter_smooth_avx2( f, l, h, n, p );
+        } ), count, 8 );
+    }
+}
@@ -0,0 +1,173 @@
+// License: Apache 2.0. See LICENSE file in root directory.
+// Copyright(c) 2021 Intel Corporation. All Rights Reserved.
+
+// Unit Test Goals:
+// Each slice of RvlSliceCompression must be coded exactly as RVL codes its rows, and images must
+// come back unchanged whatever the number of slices they were cut into. Corrupted data must be
+// rejected without writing past the image.
+
+//#cmake:add-file ../../src/compression/RvlSliceCompression.cpp
+
+#include "../catch.h"
+#include <src/compression/RvlSliceCompression.h>
+
+#include <cstring>
+#include <random>
+#include <vector>
+
+
+// RvlCompression::compressBuffer, without its size header
+std::vector< int > reference_rvl( const short * pixels, const short * end )
+{
+    std::vector< int > words;
+    int word = 0, nibbles = 0;
+    auto encode = [&]( int value ) {
+        do
+        {
+            int nibble = value & 0x7;
+            if( value >>= 3 )
+                nibble |= 0x8;
+            word = ( word << 4 ) | nibble;
+            if( ++nibbles == 8 )
+            {
+                words.push_back( word );
+                nibbles = 0;
+                word = 0;
+            }
+        } while( value );
+    };
+    short previous = 0;
+    while( pixels != end )
+    {
+        int zeros = 0, nonzeros = 0;
+        for( ; pixels != end && ! *pixels; pixels++, zeros++ )
+            ;
+        encode( zeros );
+        for( const short * p = pixels; p != end && *p++; nonzeros++ )
+            ;
+        encode( nonzeros );
+        for( int i = 0; i < nonzeros; i++ )
+        {
+            short current = *pixels++;
+            int delta = current - previous;
+            encode( ( delta << 1 ) ^ ( delta >> 31 ) );
+            previous = current;
+        }
+    }
+    if( nibbles )
+        words.push_back( word << 4 * ( 8 - nibbles ) );
+    return words;
+}
+
+// Depth-like: smooth surfaces with holes, some far and some near, and noise
+std::vector< short > make_depth( int width, int height, unsigned seed )
+{
+    std::mt19937 gen( seed );
+    std::vector< short > depth( width * height );
+    for( int y = 0; y < height; ++y )
+        for( int x = 0; x < width; ++x )
+        {
+            int d = 800 + x + 3 * y + int( gen() % 5 );
+            if( ( x / 16 + y / 8 ) % 5 == 0 || gen() % 20 == 0 )
+                d = 0;
+            else if( gen() % 50 == 0 )
+                d = int( gen() % 65536 );  // from the far end of the range too
+            depth[y * width + x] = short( d );
+        }
+    return depth;
+}
+
+
+TEST_CASE( "RVL slices are RVL", "[rvl]" )
+{
+    const int width = 848, height = 480, slices = 7;
+    auto depth = make_depth( width, height, 1 );
+    const int size = width * height * 2;
+
+    RvlSliceCompression codec( width, height, RS2_FORMAT_Z16, 2, slices );
+    std::vector< unsigned char > compressed( size );
+    int compressed_size = codec.compressBuffer( (unsigned char *)depth.data(), size, compressed.data() );
+    REQUIRE( compressed_size > 0 );
+    REQUIRE( compressed_size < size / 2 );
+
+    int payload_size;
+    memcpy( &payload_size, compressed.data(), sizeof( int ) );
+    REQUIRE( payload_size + int( sizeof( int ) ) == compressed_size );
+
+    std::vector< int > payload( payload_size / sizeof( int ) );
+    memcpy( payload.data(), compressed.data() + sizeof( int ), payload_size );
+    REQUIRE( payload[0] == slices );
+    size_t offset = 1 + slices;
+    for( int i = 0; i < slices; ++i )
+    {
+        int first = i * height / slices, last = ( i + 1 ) * height / slices;
+        auto expected = reference_rvl( depth.data() + first * width, depth.data() + last * width );
+        REQUIRE( payload[1 + i] == int( expected.size() ) );
+        REQUIRE( std::equal( expected.begin(), expected.end(), payload.begin() + offset ) );
+        offset += expected.size();
+    }
+    REQUIRE( offset == payload.size() );
+}
+
+
+TEST_CASE( "RVL slices round trip", "[rvl]" )
+{
+    const int width = 640, height = 480;
+    for( int slices : { 1, 3, 16 } )
+    {
+        CAPTURE( slices );
+        auto depth = make_depth( width, height, slices );
+        const int size = width * height * 2;
+        RvlSliceCompression encoder( width, height, RS2_FORMAT_Z16, 2, slices );
+        std::vector< unsigned char > compressed( size );
+        int compressed_size = encoder.compressBuffer( (unsigned char *)depth.data(), size, compressed.data() );
+        REQUIRE( compressed_size > 0 );
+
+        // The decoder takes the slices from the data, not from its own settings
+        RvlSliceCompression decoder( width, height, RS2_FORMAT_Z16, 2, 5 );
+        std::vector< short > decoded( width * height, -1 );
+        REQUIRE( decoder.decompressBuffer( compressed.data() + sizeof( int ),
+                                           compressed_size - sizeof( int ),
+                                           (unsigned char *)decoded.data() )
+                 == size );
+        REQUIRE( decoded == depth );
+    }
+}
+
+
+TEST_CASE( "RVL slices reject corrupted data", "[rvl]" )
+{
+    const int width = 64, height = 48;
+    auto depth = make_depth( width, height, 3 );
+    const int size = width * height * 2;
+    RvlSliceCompression codec( width, height, RS2_FORMAT_Z16, 2, 4 );
+    std::vector< unsigned char > compressed( size );
+    int compressed_size = codec.compressBuffer( (unsigned char *)depth.data(), size, compressed.data() );
+    REQUIRE( compressed_size > 0 );
+    auto payload = compressed.data() + sizeof( int );
+    int payload_size = compressed_size - sizeof( int );
+
+    // Guard words after the image catch any write past it
+    std::vector< short > decoded( width * height + 16, 0x5a5a );
+
+    // Truncated
+    REQUIRE( codec.decompressBuffer( payload, payload_size - 8, (unsigned char *)decoded.data() ) == -1 );
+
+    // Bad slice table
+    std::vector< unsigned char > bad( payload, payload + payload_size );
+    int count = 100;
+    memcpy( bad.data(), &count, sizeof( count ) );
+    REQUIRE( codec.decompressBuffer( bad.data(), payload_size, (unsigned char *)decoded.data() ) == -1 );
+
+    // Random code
+    std::mt19937 gen( 5 );
+    for( int i = 0; i < 100; ++i )
+    {
+        bad.assign( payload, payload + payload_size );
+        for( size_t j = sizeof( int ) * 5; j < bad.size(); ++j )
+            bad[j] = (unsigned char)gen();
+        codec.decompressBuffer( bad.data(), payload_size, (unsigned char *)decoded.data() );
+        for( int j = width * height; j < int( decoded.size() ); ++j )
+            REQUIRE( decoded[j] == 0x5a5a );
+    }
+}
@@ -0,0 +1,169 @@
+// License: Apache 2.0. See LICENSE file in root directory.
+// Copyright(c) 2021 Intel Corporation. All Rights Reserved.
+
+// Unit Test Goals:
+// Test the bounded, size-classed pool recycling the frame buffers of the network device.
+
+//#cmake:add-file ../../src/ipDeviceCommon/MemoryPool.h
+
+#include "../catch.h"
+#include <src/ipDeviceCommon/MemoryPool.h>
+
+#include <thread>
+#include <vector>
+
+
+TEST_CASE( "memory pool recycles buffers", "[memory-pool]" )
+{
+    MemoryPool pool;
+
+    auto a = pool.getNextMem( 1000 );
+    REQUIRE( a != nullptr );
+    REQUIRE( uintptr_t( a ) % 16 == 0 );
+    a[999] = 1;
+    pool.returnMem( a );
+
+    // The same buffer serves any size of its class
+    REQUIRE( pool.getNextMem( 60000 ) == a );
+    pool.returnMem( a );
+
+    // ... but not another
+    auto b = pool.getNextMem( 1 << 20 );
+    REQUIRE( b != a );
+    pool.returnMem( b );
+
+    auto stats = pool.getStats();
+    REQUIRE( stats.allocations == 2 );
+    REQUIRE( stats.reuses == 1 );
+    REQUIRE( stats.inUse == 0 );
+    REQUIRE( stats.highWaterMark == 1 );
+
+    // Frames of the largest size fit
+    auto c = pool.getNextMem();
+    REQUIRE( c != nullptr );
+    pool.returnMem( c );
+    REQUIRE( pool.getNextMem( 16 << 20 ) == nullptr );
+}
+
+
+TEST_CASE( "memory pool is bounded", "[memory-pool]" )
+{
+    MemoryPool pool( 3 );
+
+    std::vector< unsigned char * > buffers;
+    for( int i = 0; i < 3; ++i )
+        buffers.push_back( pool.getNextMem( 100 ) );
+    REQUIRE( pool.getNextMem( 100 ) == nullptr );
+
+    // Other sizes have their own buffers
+    auto other = pool.getNextMem( 100000 );
+    REQUIRE( other != nullptr );
+    pool.returnMem( other );
+
+    pool.returnMem( buffers.back() );
+    buffers.pop_back();
+    REQUIRE( pool.getNextMem( 100 ) != nullptr );
+
+    auto stats = pool.getStats();
+    REQUIRE( stats.exhaustions == 1 );
+    REQUIRE( stats.allocations == 4 );
+    REQUIRE( stats.inUse == 3 );
+    REQUIRE( stats.highWaterMark == 4 );
+}
+
+
+TEST_CASE( "memory pool does not allocate in steady state", "[memory-pool]" )
+{
+    MemoryPool pool( 8 );
+
+    // Buffers taken on one thread and returned on another, as frames are
+    std::vector< std::thread > threads;
+    for( int t = 0; t < 4; ++t )
+        threads.emplace_back( [&]() {
+            for( int i = 0; i < 1000; ++i )
+            {
+                auto mem = pool.getNextMem( 200000 );
+                if( mem )
+                    std::thread( [&pool, mem]() { pool.returnMem( mem ); } ).join();
+            }
+        } );
+    for( auto & t : threads )
+        t.join();
+
+    auto stats = pool.getStats();
+    REQUIRE( stats.inUse == 0 );
+    REQUIRE( stats.allocations <= 4 );
+    REQUIRE( stats.highWaterMark <= 4 );
+    REQUIRE( stats.allocations + stats.reuses == 4000 );
+}
+
+
+TEST_CASE( "memory pool bound can be changed", "[memory-pool]" )
+{
+    MemoryPool pool( 2 );
+    REQUIRE( pool.getMaxBuffers() == 2 );
+
+    auto a = pool.getNextMem( 100 );
+    auto b = pool.getNextMem( 100 );
+    REQUIRE( pool.getNextMem( 100 ) == nullptr );
+
+    pool.setMaxBuffers( 3 );
+    auto c = pool.getNextMem( 100 );
+    REQUIRE( c != nullptr );
+    REQUIRE( pool.getNextMem( 100 ) == nullptr );
+
+    // Lowered below the buffers in use: those stay usable, none are added
+    pool.setMaxBuffers( 1 );
+    pool.returnMem( c );
+    REQUIRE( pool.getNextMem( 100 ) == c );
+    REQUIRE( pool.getNextMem( 100 ) == nullptr );
+    for( auto mem : { a, b, c } )
+        pool.returnMem( mem );
+    REQUIRE( pool.getStats().allocations == 3 );
+}
+
+
+TEST_CASE( "receiving with the pool exhausted drops frames, not the stream", "[memory-pool]" )
+{
+    MemoryPool pool( 2 );
+    ReceiveBuffer receiver( pool, 1000 );
+
+    // Frames passed on hold their buffers until the application releases them
+    std::vector< unsigned char * > held;
+    for( int i = 0; i < 2; ++i )
+    {
+        REQUIRE( receiver.next() != nullptr );
+        auto frame = receiver.take();
+        REQUIRE( frame != nullptr );
+        held.push_back( frame );
+    }
+
+    // Out of buffers: there is still somewhere to receive to, but those frames are dropped
+    for( int i = 0; i < 3; ++i )
+    {
+        auto buffer = receiver.next();
+        REQUIRE( buffer != nullptr );
+        buffer[999] = 1;
+        REQUIRE( receiver.take() == nullptr );
+    }
+    REQUIRE( pool.getStats().exhaustions == 3 );
+
+    // ... until a buffer is released
+    pool.returnMem( held.back() );
+    held.pop_back();
+    auto buffer = receiver.next();
+    REQUIRE( receiver.take() == buffer );
+    held.push_back( buffer );
+
+    // A buffer still receiving is returned with the receiver
+    pool.returnMem( held.back() );
+    held.pop_back();
+    {
+        ReceiveBuffer other( pool, 1000 );
+        REQUIRE( other.next() != nullptr );
+        REQUIRE( pool.getStats().inUse == 2 );
+    }
+    REQUIRE( pool.getStats().inUse == 1 );
+    for( auto mem : held )
+        pool.returnMem( mem );
+}
@@ -0,0 +1,237 @@
+// License: Apache 2.0. See LICENSE file in root directory.
+// Copyright(c) 2021 Intel Corporation. All Rights Reserved.
+
+//#cmake:add-file ../../src/executor.h
+//#cmake:add-file ../../src/executor.cpp
+
+#include <unit-tests/test.h>
+#include <src/executor.h>
+
+#include <chrono>
+#include <vector>
+
+using namespace librealsense;
+
+TEST_CASE( "executor runs every posted task" )
+{
+    std::atomic< int > count( 0 );
+    {
+        auto ex = std::make_shared< executor >( 4 );
+        REQUIRE( ex->get_thread_count() == 4 );
+        for( int i = 0; i < 1000; ++i )
+            ex->post( [&]() { ++count; } );
+    }
+    // Pending tasks are drained before the executor's threads exit
+    REQUIRE( count == 1000 );
+}
+
+TEST_CASE( "strand preserves order and never overlaps" )
+{
+    auto ex = std::make_shared< executor >( 4 );
+    auto s = ex->make_strand( 10000 );
+
+    std::vector< int > order;
+    std::atomic< int > running( 0 );
+    std::atomic< bool > overlapped( false );
+    for( int i = 0; i < 1000; ++i )
+        s->post( [&, i]() {
+            if( running++ )
+                overlapped = true;
+            order.push_back( i );
+            --running;
+        } );
+    std::mutex m;
+    std::condition_variable cv;
+    bool done = false;
+    s->post( [&]() {
+        std::lock_guard< std::mutex > lock( m );
+        done = true;
+        cv.notify_one();
+    } );
+    {
+        std::unique_lock< std::mutex > lock( m );
+        REQUIRE( cv.wait_for( lock, std::chrono::seconds( 5 ), [&]() { return done; } ) );
+    }
+
+    REQUIRE_FALSE( overlapped );
+    REQUIRE( order.size() == 1000 );
+    for( int i = 0; i < 1000; ++i )
+        REQUIRE( order[i] == i );
+    REQUIRE( s->get_dropped() == 0 );
+}
+
+TEST_CASE( "concurrent strand overlaps the work but delivers in order" )
+{
+    auto ex = std::make_shared< executor >( 4 );
+    auto s = ex->make_strand( 10000, 4 );
+    REQUIRE( s->get_concurrency() == 4 );
+
+    const int N = 200;
+    std::vector< int > order;
+    std::atomic< int > running( 0 ), max_running( 0 ), delivering( 0 );
+    std::atomic< bool > overlapped_delivery( false );
+    std::atomic< int > delivered( 0 );
+    for( int i = 0; i < N; ++i )
+        s->post_ordered( [&, i]() {
+            int now = ++running;
+            int prev = max_running;
+            while( now > prev && ! max_running.compare_exchange_weak( prev, now ) )
+                ;
+            // Earlier tasks take longer, so that later ones finish first
+            std::this_thread::sleep_for( std::chrono::microseconds( ( N - i ) % 7 * 100 ) );
+            --running;
+            return executor::task( [&, i]() {
+                if( delivering++ )
+                    overlapped_delivery = true;
+                order.push_back( i );
+                --delivering;
+                ++delivered;
+            } );
+        } );
+    auto const deadline = std::chrono::steady_clock::now() + std::chrono::seconds( 5 );
+    while( delivered < N && std::chrono::steady_clock::now() < deadline )
+        std::this_thread::yield();
+
+    REQUIRE( delivered == N );
+    REQUIRE_FALSE( overlapped_delivery );
+    CHECK( max_running > 1 );
+    for( int i = 0; i < N; ++i )
+        REQUIRE( order[i] == i );
+}
+
+TEST_CASE( "concurrent strand delivers past a failed task" )
+{
+    auto ex = std::make_shared< executor >( 2 );
+    auto s = ex->make_strand( 100, 2 );
+
+    std::vector< int > order;
+    std::atomic< int > delivered( 0 );
+    for( int i = 0; i < 5; ++i )
+        s->post_ordered( [&, i]() {
+            if( i == 2 )
+                throw std::runtime_error( "oops" );
+            return executor::task( [&, i]() {
+                order.push_back( i );
+                ++delivered;
+            } );
+        } );
+    while( delivered < 4 )
+        std::this_thread::yield();
+    s->stop();
+    REQUIRE( order == std::vector< int >{ 0, 1, 3, 4 } );
+}
+
+TEST_CASE( "strand drops the oldest tasks when over capacity" )
+{
+    auto ex = std::make_shared< executor >( 1 );
+    auto s = ex->make_strand( 2 );
+
+    // Block the strand so the next tasks pile up
+    std::mutex m;
+    std::condition_variable cv;
+    bool started = false, release = false;
+    s->post( [&]() {
+        std::unique_lock< std::mutex > lock( m );
+        started = true;
+        cv.notify_all();
+        cv.wait( lock, [&]() { return release; } );
+    } );
+    {
+        std::unique_lock< std::mutex > lock( m );
+        cv.wait( lock, [&]() { return started; } );
+    }
+
+    std::vector< int > ran;
+    std::atomic< int > count( 0 );
+    for( int i = 0; i < 5; ++i )
+        s->post( [&, i]() {
+            ran.push_back( i );
+            ++count;
+        } );
+    REQUIRE( s->get_dropped() == 3 );
+
+    {
+        std::lock_guard< std::mutex > lock( m );
+        release = true;
+    }
+    cv.notify_all();
+    while( count < 2 )
+        std::this_thread::yield();
+
+    REQUIRE( ran == std::vector< int >{ 3, 4 } );
+}
+
+TEST_CASE( "strand stop waits for the running task" )
+{
+    auto ex = std::make_shared< executor >( 2 );
+    auto s = ex->make_strand( 10 );
+
+    std::atomic< bool > started( false ), finished( false );
+    s->post( [&]() {
+        started = true;
+        std::this_thread::sleep_for( std::chrono::milliseconds( 100 ) );
+        finished = true;
+    } );
+    while( ! started )
+        std::this_thread::yield();
+    s->stop();
+    REQUIRE( finished );
+
+    // Nothing runs once stopped
+    std::atomic< bool > ran( false );
+    s->post( [&]() { ran = true; } );
+    ex.reset();
+    REQUIRE_FALSE( ran );
+}
+
+TEST_CASE( "strand stop on a worker thread does not wait" )
+{
+    // A single worker: the strand's runner is queued behind the task that stops it, so waiting
+    // for it there would never return
+    auto ex = std::make_shared< executor >( 1 );
+    auto s = ex->make_strand( 10 );
+
+    std::atomic< bool > ran( false ), stopped( false );
+    ex->post( [&]() {
+        s->post( [&]() { ran = true; } );
+        s->stop();
+        stopped = true;
+    } );
+    auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds( 5 );
+    while( ! stopped && std::chrono::steady_clock::now() < deadline )
+        std::this_thread::yield();
+    REQUIRE( stopped );
+    ex.reset();
+    REQUIRE_FALSE( ran );
+}
+
+TEST_CASE( "exceptions in tasks do not take down the worker" )
+{
+    std::atomic< int > count( 0 );
+    {
+        auto ex = std::make_shared< executor >( 1 );
+        ex->post( []() { throw std::runtime_error( "oops" ); } );
+        ex->post( [&]() { ++count; } );
+    }
+    REQUIRE( count == 1 );
+}
+
+TEST_CASE( "executor can be released from its own task" )
+{
+    std::atomic< bool > done( false );
+    {
+        auto ex = std::make_shared< executor >( 2 );
+        auto s = ex->make_strand( 10 );
+        // The strand keeps the executor alive; the task drops the last reference to the strand
+        auto holder = std::make_shared< std::shared_ptr< executor::strand > >( s );
+        s->post( [holder, &done]() {
+            holder->reset();
+            done = true;
+        } );
+        s.reset();
+        holder.reset();
+        ex.reset();
+    }
+    while( ! done )
+        std::this_thread::yield();
+}
@@ -0,0 +1,154 @@
+// License: Apache 2.0. See LICENSE file in root directory.
+// Copyright(c) 2021 Intel Corporation. All Rights Reserved.
+
+// Unit Test Goals:
+// Frames produced with a user-supplied frame allocator (rs2::processing_block::set_frame_allocator) must
+// live in the buffers it hands out and carry the pixels written to them, and every buffer must be given
+// back once its frame is released. The depth comes from a software device, so no camera is needed.
+
+#include "../catch.h"
+#include <librealsense2/rs.hpp>
+#include <librealsense2/hpp/rs_internal.hpp>
+
+#include <cstdlib>
+#include <cstring>
+#include <map>
+#include <mutex>
+#include <vector>
+
+
+// Hands out malloc'ed buffers and remembers them, so frames can be checked to live in one
+class tracking_allocator
+{
+    std::mutex _mutex;
+    std::map< const void *, size_t > _buffers;
+    int _allocations = 0;
+    int _mismatches = 0;  // buffers given back that were not handed out, or with another size
+
+public:
+    void * allocate( size_t size )
+    {
+        void * buffer = std::malloc( size );
+        std::lock_guard< std::mutex > lock( _mutex );
+        _buffers[buffer] = size;
+        ++_allocations;
+        return buffer;
+    }
+
+    void deallocate( void * buffer, size_t size )
+    {
+        std::lock_guard< std::mutex > lock( _mutex );
+        // Called from library threads, where Catch cannot be used: count, and check later
+        auto it = _buffers.find( buffer );
+        if( it == _buffers.end() || it->second != size )
+        {
+            ++_mismatches;
+            return;
+        }
+        _buffers.erase( it );
+        std::free( buffer );
+    }
+
+    bool owns( const void * data, size_t size )
+    {
+        std::lock_guard< std::mutex > lock( _mutex );
+        auto it = _buffers.upper_bound( data );
+        if( it == _buffers.begin() )
+            return false;
+        --it;
+        auto begin = static_cast< const char * >( it->first );
+        return static_cast< const char * >( data ) + size <= begin + it->second;
+    }
+
+    int allocations() const { return _allocations; }
+    int mismatches() const { return _mismatches; }
+    size_t outstanding() const { return _buffers.size(); }
+
+    template< class T >
+    void install( T & block )
+    {
+        block.set_frame_allocator( [this]( size_t size ) { return allocate( size ); },
+                                   [this]( void * buffer, size_t size ) { deallocate( buffer, size ); } );
+    }
+};
+
+
+TEST_CASE( "frame allocator: processing block frames carry the written pixels", "[frame-allocator]" )
+{
+    const int W = 64, H = 48, BPP = 2;
+
+    rs2::software_device dev;
+    auto sensor = dev.add_sensor( "Depth" );
+    rs2_intrinsics intrinsics = { W, H, W / 2.f, H / 2.f, 100.f, 100.f, RS2_DISTORTION_NONE, { 0 } };
+    auto profile = sensor.add_video_stream( { RS2_STREAM_DEPTH, 0, 0, W, H, 30, BPP, RS2_FORMAT_Z16, intrinsics } );
+    sensor.add_read_only_option( RS2_OPTION_DEPTH_UNITS, 0.001f );
+
+    std::vector< uint16_t > pixels( W * H );
+    for( int i = 0; i < W * H; ++i )
+        pixels[i] = uint16_t( 500 + ( i * 37 ) % 3000 );
+
+    rs2::frame_queue depth_queue( 1 );
+    sensor.open( profile );
+    sensor.start( depth_queue );
+    sensor.on_video_frame( { pixels.data(),
+                             []( void * ) {},
+                             W * BPP,
+                             BPP,
+                             0.,
+                             RS2_TIMESTAMP_DOMAIN_HARDWARE_CLOCK,
+                             1,
+                             profile,
+                             0.001f } );
+    rs2::frame depth = depth_queue.wait_for_frame();
+    REQUIRE( memcmp( depth.get_data(), pixels.data(), pixels.size() * BPP ) == 0 );
+
+    tracking_allocator allocator;
+
+    SECTION( "a frame written by a custom block" )
+    {
+        rs2::frame_queue out( 1 );
+        {
+            rs2::processing_block copy( []( rs2::frame f, rs2::frame_source & source ) {
+                auto vf = f.as< rs2::video_frame >();
+                auto copied = source.allocate_video_frame( f.get_profile(), f, vf.get_bytes_per_pixel(),
+                                                           vf.get_width(), vf.get_height(),
+                                                           vf.get_stride_in_bytes(), RS2_EXTENSION_DEPTH_FRAME );
+                memcpy( const_cast< void * >( copied.get_data() ), vf.get_data(),
+                        vf.get_height() * vf.get_stride_in_bytes() );
+                source.frame_ready( copied );
+            } );
+            allocator.install( copy );
+            copy.start( out );
+            copy.invoke( depth );
+
+            auto copied = out.wait_for_frame();
+            REQUIRE( allocator.owns( copied.get_data(), pixels.size() * BPP ) );
+            REQUIRE( memcmp( copied.get_data(), pixels.data(), pixels.size() * BPP ) == 0 );
+        }
+        CHECK( allocator.allocations() == 1 );
+    }
+
+    SECTION( "a frame written by the colorizer" )
+    {
+        rs2::colorizer internal;
+        auto expected = internal.process( depth ).as< rs2::video_frame >();
+        REQUIRE( expected );
+        {
+            rs2::colorizer colorizer;
+            allocator.install( colorizer );
+            auto colorized = colorizer.process( depth ).as< rs2::video_frame >();
+            REQUIRE( colorized );
+            auto size = size_t( colorized.get_height() * colorized.get_stride_in_bytes() );
+            REQUIRE( allocator.owns( colorized.get_data(), size ) );
+            REQUIRE( memcmp( colorized.get_data(), expected.get_data(), size ) == 0 );
+        }
+        CHECK( allocator.allocations() >= 1 );
+    }
+
+    depth = rs2::frame();
+    sensor.stop();
+    sensor.close();
+    // The blocks, and the frames they produced, are gone: every buffer must have been handed back
+    CHECK( allocator.outstanding() == 0 );
+    CHECK( allocator.mismatches() == 0 );
+}
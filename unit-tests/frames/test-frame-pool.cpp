@@ -0,0 +1,93 @@
+// License: Apache 2.0. See LICENSE file in root directory.
+// Copyright(c) 2021 Intel Corporation. All Rights Reserved.
+
+// Unit Test Goals:
+// Test the size-bucketed frame recycling pool used by frame_archive.
+
+//#cmake:add-file ../../src/frame-pool.h
+
+#include "../catch.h"
+#include <src/frame-pool.h>
+
+using namespace librealsense;
+
+
+// Minimal stand-in for a frame: the pool only needs the buffer and its timestamp
+struct pooled_frame
+{
+    std::vector< byte > data;
+    struct
+    {
+        rs2_time_t timestamp = 0;
+    } additional_data;
+};
+
+static pooled_frame make_frame( size_t size, rs2_time_t timestamp )
+{
+    pooled_frame f;
+    f.data.resize( size );
+    f.additional_data.timestamp = timestamp;
+    return f;
+}
+
+
+TEST_CASE( "frame pool returns buffers of the requested size", "[frame-pool]" )
+{
+    frame_pool< pooled_frame > pool;
+    pooled_frame f;
+
+    REQUIRE_FALSE( pool.acquire( 100, 0, f ) );  // empty pool
+
+    REQUIRE( pool.release( make_frame( 100, 0 ) ) );
+    REQUIRE( pool.release( make_frame( 200, 0 ) ) );
+    CHECK( pool.get_stats().pooled == 2 );
+
+    REQUIRE_FALSE( pool.acquire( 300, 10, f ) );  // no bucket of this size
+    REQUIRE( pool.acquire( 200, 10, f ) );
+    CHECK( f.data.size() == 200 );
+    REQUIRE( pool.acquire( 100, 10, f ) );
+    CHECK( f.data.size() == 100 );
+    REQUIRE_FALSE( pool.acquire( 100, 10, f ) );
+
+    auto stats = pool.get_stats();
+    CHECK( stats.hits == 2 );
+    CHECK( stats.misses == 3 );
+    CHECK( stats.evictions == 0 );
+    CHECK( stats.pooled == 0 );
+}
+
+TEST_CASE( "frame pool evicts unused buffers", "[frame-pool]" )
+{
+    frame_pool< pooled_frame > pool( 1000 );
+    pooled_frame f;
+
+    REQUIRE( pool.release( make_frame( 100, 0 ) ) );
+    REQUIRE( pool.release( make_frame( 100, 500 ) ) );
+    REQUIRE( pool.release( make_frame( 200, 0 ) ) );
+
+    // The newest buffer is reused; the remaining one of the same size is too old to keep
+    REQUIRE( pool.acquire( 100, 1200, f ) );
+    CHECK( f.additional_data.timestamp == 500 );
+
+    // The 200-byte bucket was aged out by the periodic sweep
+    REQUIRE_FALSE( pool.acquire( 200, 1300, f ) );
+
+    auto stats = pool.get_stats();
+    CHECK( stats.evictions == 2 );
+    CHECK( stats.pooled == 0 );
+}
+
+TEST_CASE( "stopped frame pool does not accept buffers", "[frame-pool]" )
+{
+    frame_pool< pooled_frame > pool;
+    pooled_frame f;
+
+    REQUIRE( pool.release( make_frame( 100, 0 ) ) );
+    pool.stop();
+    CHECK( pool.get_stats().pooled == 0 );
+
+    auto g = make_frame( 100, 0 );
+    REQUIRE_FALSE( pool.release( std::move( g ) ) );
+    CHECK( g.data.size() == 100 );  // not moved from
+    REQUIRE_FALSE( pool.acquire( 100, 0, f ) );
+}
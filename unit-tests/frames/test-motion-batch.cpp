@@ -0,0 +1,146 @@
+// License: Apache 2.0. See LICENSE file in root directory.
+// Copyright(c) 2022 Intel Corporation. All Rights Reserved.
+
+// Unit Test Goals:
+// A batched HID accel frame (see RS2_OPTION_MOTION_SAMPLES_PER_FRAME) must come out of the motion
+// transform as one motion frame with all its samples converted, in order, with their timestamps;
+// get_motion_data() is the first sample and the frame's timestamp is the last one's. The batch is
+// built here the way hid_sensor builds it, so no camera is needed.
+
+//#cmake: static!
+
+#include "../catch.h"
+#include <librealsense2/rs.hpp>
+#include <src/source.h>
+#include <src/stream.h>
+#include <src/environment.h>
+#include <src/proc/motion-transform.h>
+
+#include <cstring>
+
+using namespace librealsense;
+
+
+static std::shared_ptr< motion_stream_profile > make_raw_accel_profile()
+{
+    auto profile = std::make_shared< motion_stream_profile >( platform::stream_profile{} );
+    profile->set_stream_type( RS2_STREAM_ACCEL );
+    profile->set_format( RS2_FORMAT_MOTION_RAW );
+    profile->set_framerate( 200 );
+    profile->set_unique_id( environment::get_instance().generate_stream_id() );
+    return profile;
+}
+
+// Sample i of the batch is (i, -2i, 1000 + i) in HID units (0.001g), at 100 + 5i ms
+static short raw_x( int i ) { return short( i ); }
+static short raw_y( int i ) { return short( -2 * i ); }
+static short raw_z( int i ) { return short( 1000 + i ); }
+static rs2_time_t sample_time( int i ) { return 100. + 5 * i; }
+
+static frame_holder make_batch( frame_source & source, std::shared_ptr< stream_profile_interface > profile, int samples )
+{
+    const int stride = sizeof( hid_data );
+    frame_additional_data data;
+    data.timestamp = sample_time( samples - 1 );
+    data.frame_number = samples;
+    frame_holder f = source.alloc_frame( RS2_EXTENSION_MOTION_FRAME, motion_frame::batch_size( samples, stride ), data, true );
+    REQUIRE( f );
+    f->set_stream( profile );
+
+    auto mf = static_cast< motion_frame * >( f.frame );
+    auto bytes = const_cast< byte * >( mf->get_frame_data() );
+    for( int i = 0; i < samples; ++i )
+    {
+        hid_data sample = {};
+        sample.x = raw_x( i );
+        sample.y = raw_y( i );
+        sample.z = raw_z( i );
+        memcpy( bytes + i * stride, &sample, stride );
+        rs2_time_t t = sample_time( i );
+        memcpy( bytes + motion_frame::timestamps_offset( samples, stride ) + i * sizeof( rs2_time_t ), &t, sizeof( t ) );
+    }
+    mf->assign_samples( samples, stride );
+    return f;
+}
+
+static rs2_vector expected_accel( int i )
+{
+    // As the transform computes it: the raw values, as floats, times 0.001g (with g a float)
+    float factor = float( 0.001 * 9.80665f );
+    return { raw_x( i ) * factor, raw_y( i ) * factor, raw_z( i ) * factor };
+}
+
+
+TEST_CASE( "motion transform converts a whole batch of samples", "[motion-batch]" )
+{
+    frame_source source;
+    source.init( std::make_shared< metadata_parser_map >() );
+    auto profile = make_raw_accel_profile();
+
+    acceleration_transform accel;
+    for( int samples : { 2, 5, 64 } )
+    {
+        CAPTURE( samples );
+        auto results = accel.invoke_and_hold( make_batch( source, profile, samples ) );
+        REQUIRE( results.size() == 1 );
+        rs2::frame f( (rs2_frame *)results[0].frame );  // takes over the reference
+        results[0].frame = nullptr;
+
+        auto mf = f.as< rs2::motion_frame >();
+        REQUIRE( mf );
+        REQUIRE( mf.get_profile().stream_type() == RS2_STREAM_ACCEL );
+        REQUIRE( mf.get_profile().format() == RS2_FORMAT_MOTION_XYZ32F );
+        REQUIRE( mf.get_sample_count() == samples );
+
+        auto values = mf.get_motion_samples();
+        auto timestamps = mf.get_sample_timestamps();
+        for( int i = 0; i < samples; ++i )
+        {
+            CAPTURE( i );
+            auto expected = expected_accel( i );
+            REQUIRE( values[i].x == expected.x );
+            REQUIRE( values[i].y == expected.y );
+            REQUIRE( values[i].z == expected.z );
+            REQUIRE( timestamps[i] == sample_time( i ) );
+        }
+
+        auto first = mf.get_motion_data();
+        REQUIRE( first.x == values[0].x );
+        REQUIRE( first.y == values[0].y );
+        REQUIRE( first.z == values[0].z );
+        REQUIRE( mf.get_timestamp() == sample_time( samples - 1 ) );
+        REQUIRE( mf.get_frame_number() == (unsigned long long)samples );
+    }
+}
+
+TEST_CASE( "unbatched motion frames carry one sample", "[motion-batch]" )
+{
+    frame_source source;
+    source.init( std::make_shared< metadata_parser_map >() );
+    auto profile = make_raw_accel_profile();
+
+    frame_additional_data data;
+    data.timestamp = sample_time( 3 );
+    frame_holder raw = source.alloc_frame( RS2_EXTENSION_MOTION_FRAME, sizeof( hid_data ), data, true );
+    REQUIRE( raw );
+    raw->set_stream( profile );
+    hid_data sample = {};
+    sample.x = raw_x( 3 );
+    sample.y = raw_y( 3 );
+    sample.z = raw_z( 3 );
+    memcpy( const_cast< byte * >( raw->get_frame_data() ), &sample, sizeof( sample ) );
+
+    acceleration_transform accel;
+    auto results = accel.invoke_and_hold( std::move( raw ) );
+    REQUIRE( results.size() == 1 );
+    rs2::frame f( (rs2_frame *)results[0].frame );
+    results[0].frame = nullptr;
+
+    auto mf = f.as< rs2::motion_frame >();
+    REQUIRE( mf );
+    REQUIRE( mf.get_sample_count() == 1 );
+    auto expected = expected_accel( 3 );
+    REQUIRE( mf.get_motion_data().x == expected.x );
+    REQUIRE( mf.get_motion_data().z == expected.z );
+    REQUIRE( mf.get_sample_timestamps()[0] == mf.get_timestamp() );
+}
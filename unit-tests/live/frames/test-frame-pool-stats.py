@@ -0,0 +1,37 @@
+# License: Apache 2.0. See LICENSE file in root directory.
+# Copyright(c) 2022 Intel Corporation. All Rights Reserved.
+
+# test:device D400*
+
+import pyrealsense2 as rs
+from rspy import test, log
+import time
+
+# Depth frames released right away must have their buffers recycled for the frames that follow, which
+# sensor.get_frame_pool_statistics() reports
+
+device = test.find_first_device_or_exit()
+depth_sensor = device.first_depth_sensor()
+depth_profile = next(p for p in depth_sensor.profiles if p.stream_type() == rs.stream.depth and p.format() == rs.format.z16)
+
+################################################################################################
+
+test.start("Released frames are recycled")
+frames = 0
+def frame_cb(frame):
+    global frames
+    frames += 1
+depth_sensor.open(depth_profile)
+depth_sensor.start(frame_cb)
+time.sleep(3)
+stats = depth_sensor.get_frame_pool_statistics()
+depth_sensor.stop()
+depth_sensor.close()
+log.d(frames, "frames:", stats.hits, "hits,", stats.misses, "misses,", stats.evictions, "evictions,", stats.pooled, "pooled")
+test.check(frames > 10)
+test.check(stats.hits + stats.misses >= frames)
+test.check(stats.hits > stats.misses)
+test.finish()
+
+################################################################################################
+test.print_results_and_exit()
@@ -0,0 +1,62 @@
+# License: Apache 2.0. See LICENSE file in root directory.
+# Copyright(c) 2022 Intel Corporation. All Rights Reserved.
+
+# test:device D435I
+# test:device D455
+
+import pyrealsense2 as rs
+from rspy import test, log
+import time
+
+# With RS2_OPTION_MOTION_SAMPLES_PER_FRAME set, each gyro frame must carry that many samples, with
+# increasing timestamps of which the last is the frame's
+
+SAMPLES_PER_FRAME = 10
+
+device = test.find_first_device_or_exit()
+motion_sensor = device.first_motion_sensor()
+gyro_profile = next(p for p in motion_sensor.profiles if p.stream_type() == rs.stream.gyro)
+
+def stream_gyro(seconds):
+    frames = []
+    def frame_cb(frame):
+        mf = frame.as_motion_frame()
+        frames.append((mf.get_sample_count(), mf.get_sample_timestamps(), mf.get_motion_samples(), frame.get_timestamp()))
+    motion_sensor.open(gyro_profile)
+    motion_sensor.start(frame_cb)
+    time.sleep(seconds)
+    motion_sensor.stop()
+    motion_sensor.close()
+    return frames
+
+################################################################################################
+
+test.start("Single samples by default")
+test.check_equal(motion_sensor.get_option(rs.option.motion_samples_per_frame), 1)
+frames = stream_gyro(2)
+test.check(len(frames) > 0)
+for count, timestamps, samples, timestamp in frames:
+    test.check_equal(count, 1)
+    test.check_equal(timestamps[0], timestamp)
+test.finish()
+
+################################################################################################
+
+test.start("Batched samples")
+motion_sensor.set_option(rs.option.motion_samples_per_frame, SAMPLES_PER_FRAME)
+frames = stream_gyro(2)
+test.check(len(frames) > 0)
+log.d(len(frames), "batched frames at", gyro_profile.fps(), "fps")
+last = 0
+for count, timestamps, samples, timestamp in frames:
+    test.check_equal(count, SAMPLES_PER_FRAME)
+    test.check_equal(len(samples), SAMPLES_PER_FRAME)
+    test.check_equal(timestamps[-1], timestamp)
+    for ts in timestamps:
+        test.check(ts > last)
+        last = ts
+motion_sensor.set_option(rs.option.motion_samples_per_frame, 1)
+test.finish()
+
+################################################################################################
+test.print_results_and_exit()
@@ -0,0 +1,53 @@
+# License: Apache 2.0. See LICENSE file in root directory.
+# Copyright(c) 2022 Intel Corporation. All Rights Reserved.
+
+# test:device D400*
+
+import pyrealsense2 as rs
+from rspy import test, log
+
+# Option values are reused for as long as the control cache max age allows, which
+# sensor.get_control_cache_statistics() reports
+
+device = test.find_first_device_or_exit()
+depth_sensor = device.first_depth_sensor()
+option = rs.option.laser_power
+
+################################################################################################
+
+test.start("The control cache max age is an option of the sensor")
+test.check(depth_sensor.supports(rs.option.control_cache_max_age))
+default_age = depth_sensor.get_option(rs.option.control_cache_max_age)
+test.check_equal(default_age, 1000)
+test.finish()
+
+################################################################################################
+
+test.start("Values are read from the cache within the max age")
+depth_sensor.set_option(rs.option.control_cache_max_age, 60000)
+depth_sensor.get_option(option)
+before = depth_sensor.get_control_cache_statistics()
+for i in range(10):
+    depth_sensor.get_option(option)
+after = depth_sensor.get_control_cache_statistics()
+log.d("transfers:", before.transfers, "->", after.transfers, "; values saved:", before.values_saved, "->", after.values_saved)
+test.check_equal(after.values_saved - before.values_saved, 10)
+test.check_equal(after.transfers, before.transfers)
+test.finish()
+
+################################################################################################
+
+test.start("A max age of 0 reads every value from the camera")
+depth_sensor.set_option(rs.option.control_cache_max_age, 0)
+before = depth_sensor.get_control_cache_statistics()
+for i in range(10):
+    depth_sensor.get_option(option)
+after = depth_sensor.get_control_cache_statistics()
+log.d("transfers:", before.transfers, "->", after.transfers, "; values saved:", before.values_saved, "->", after.values_saved)
+test.check_equal(after.transfers - before.transfers, 10)
+test.check_equal(after.values_saved, before.values_saved)
+depth_sensor.set_option(rs.option.control_cache_max_age, default_age)
+test.finish()
+
+################################################################################################
+test.print_results_and_exit()
@@ -0,0 +1,147 @@
+// License: Apache 2.0. See LICENSE file in root directory.
+// Copyright(c) 2021 Intel Corporation. All Rights Reserved.
+
+// Unit Test Goals:
+// Test the cache of option values and ranges that saves the control transfers of UVC options.
+
+//#cmake:add-file ../../src/option-cache.h
+
+#include "../catch.h"
+#include <src/option-cache.h>
+
+#include <stdexcept>
+#include <thread>
+
+using namespace librealsense;
+
+
+// Stand-in for a camera control: counts the transfers made to it
+struct control
+{
+    float value = 0;
+    int reads = 0;
+    int writes = 0;
+    int range_reads = 0;
+
+    float read() { ++reads; return value; }
+    void write( float v ) { ++writes; value = v; }
+    option_range read_range() { ++range_reads; return { 0, 100, 1, 50 }; }
+};
+
+static float query( option_cache & cache, option_cache::entry & e, control & c )
+{
+    return cache.query( e, [&]() { return c.read(); } );
+}
+
+static void set( option_cache & cache, option_cache::entry & e, control & c, float value )
+{
+    cache.set( e, value, [&]() { c.write( value ); } );
+}
+
+
+TEST_CASE( "option cache answers repeated queries", "[option-cache]" )
+{
+    option_cache cache;
+    option_cache::entry e;
+    control c;
+    c.value = 3;
+
+    REQUIRE( query( cache, e, c ) == 3 );
+    REQUIRE( query( cache, e, c ) == 3 );
+    REQUIRE( query( cache, e, c ) == 3 );
+    REQUIRE( c.reads == 1 );
+
+    for( int i = 0; i < 3; ++i )
+        REQUIRE( cache.get_range( e, [&]() { return c.read_range(); } ).max == 100 );
+    REQUIRE( c.range_reads == 1 );
+
+    auto stats = cache.get_stats();
+    REQUIRE( stats.transfers == 2 );
+    REQUIRE( stats.values_saved == 2 );
+    REQUIRE( stats.ranges_saved == 2 );
+}
+
+
+TEST_CASE( "option cache writes through and invalidates the other options", "[option-cache]" )
+{
+    option_cache cache;
+    option_cache::entry e1, e2;
+    control c1, c2;
+
+    query( cache, e1, c1 );
+    query( cache, e2, c2 );
+    set( cache, e1, c1, 7 );
+    c2.value = 9;  // as if changed by setting c1
+
+    REQUIRE( query( cache, e1, c1 ) == 7 );
+    REQUIRE( c1.reads == 1 );
+    REQUIRE( query( cache, e2, c2 ) == 9 );
+    REQUIRE( c2.reads == 2 );
+}
+
+
+TEST_CASE( "option cache values go stale", "[option-cache]" )
+{
+    option_cache cache( std::chrono::milliseconds( 20 ) );
+    option_cache::entry e;
+    control c;
+
+    query( cache, e, c );
+    c.value = 1;
+    REQUIRE( query( cache, e, c ) == 0 );
+    std::this_thread::sleep_for( std::chrono::milliseconds( 40 ) );
+    REQUIRE( query( cache, e, c ) == 1 );
+    REQUIRE( c.reads == 2 );
+
+    cache.set_max_age( std::chrono::milliseconds( 0 ) );
+    query( cache, e, c );
+    query( cache, e, c );
+    REQUIRE( c.reads == 4 );
+}
+
+
+TEST_CASE( "option cache never keeps volatile values", "[option-cache]" )
+{
+    option_cache cache;
+    option_cache::entry e;
+    e.set_volatile( true );
+    control c;
+
+    query( cache, e, c );
+    set( cache, e, c, 5 );
+    REQUIRE( query( cache, e, c ) == 5 );
+    REQUIRE( c.reads == 2 );
+}
+
+
+TEST_CASE( "option cache is discarded on failed sets", "[option-cache]" )
+{
+    option_cache cache;
+    option_cache::entry e1, e2;
+    control c1, c2;
+
+    query( cache, e1, c1 );
+    query( cache, e2, c2 );
+    REQUIRE_THROWS( cache.set( e1, 1, []() { throw std::runtime_error( "set failed" ); } ) );
+    query( cache, e1, c1 );
+    query( cache, e2, c2 );
+    REQUIRE( c1.reads == 2 );
+    REQUIRE( c2.reads == 2 );
+}
+
+
+TEST_CASE( "disabled option cache reads every time", "[option-cache]" )
+{
+    option_cache cache;
+    cache.disable();
+    option_cache::entry e;
+    control c;
+
+    query( cache, e, c );
+    query( cache, e, c );
+    cache.get_range( e, [&]() { return c.read_range(); } );
+    cache.get_range( e, [&]() { return c.read_range(); } );
+    REQUIRE( c.reads == 2 );
+    REQUIRE( c.range_reads == 2 );
+    REQUIRE( cache.get_stats().values_saved == 0 );
+}
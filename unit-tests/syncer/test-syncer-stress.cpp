@@ -0,0 +1,125 @@
+// License: Apache 2.0. See LICENSE file in root directory.
+// Copyright(c) 2021 Intel Corporation. All Rights Reserved.
+
+// Stress benchmark for the syncer: 4 software cameras x 3 streams, each stream fed from its own thread
+// (like the per-stream USB callback threads of real devices) into one rs2::syncer, as fast as possible
+// and with synthetic hardware timestamps. Reports how long a frame takes to get into the syncer (time
+// spent waiting on other streams shows up here) and the resulting frameset throughput. It asserts
+// nothing about timing and is meant to be run by hand.
+//#test:donotrun
+
+#include "../catch.h"
+#include <librealsense2/rs.hpp>
+#include <librealsense2/hpp/rs_internal.hpp>
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <iostream>
+#include <thread>
+#include <vector>
+
+typedef std::chrono::steady_clock clock_type;
+
+TEST_CASE( "syncer stress: 4 cameras x 3 streams" )
+{
+    const int CAMERAS = 4;
+    const int FRAMES = 3000;
+    const int W = 64, H = 48, BPP = 2, FPS = 30;
+    const rs2_stream types[] = { RS2_STREAM_DEPTH, RS2_STREAM_COLOR, RS2_STREAM_INFRARED };
+    const rs2_format formats[] = { RS2_FORMAT_Z16, RS2_FORMAT_YUYV, RS2_FORMAT_Y16 };
+
+    struct stream
+    {
+        rs2::software_sensor sensor;
+        rs2::stream_profile profile;
+    };
+
+    std::vector< rs2::software_device > devices( CAMERAS );
+    std::vector< stream > streams;
+    for( int c = 0; c < CAMERAS; ++c )
+    {
+        devices[c].create_matcher( RS2_MATCHER_DEFAULT );
+        for( int s = 0; s < 3; ++s )
+        {
+            auto sensor = devices[c].add_sensor( "Sensor " + std::to_string( s ) );
+            rs2_intrinsics intrinsics = { W, H, W / 2.f, H / 2.f, 100.f, 100.f, RS2_DISTORTION_NONE, { 0 } };
+            // Unique ids must not collide between the cameras, as they all go through the same syncer
+            auto profile = sensor.add_video_stream( { types[s], 0, 100 + c * 3 + s, W, H, FPS, BPP, formats[s], intrinsics } );
+            streams.push_back( { sensor, profile } );
+        }
+    }
+
+    rs2::syncer sync( 1000 );
+    for( auto & s : streams )
+    {
+        s.sensor.open( s.profile );
+        s.sensor.start( sync );
+    }
+
+    std::vector< uint8_t > pixels( W * H * BPP );
+    std::atomic< bool > done( false );
+    std::atomic< long long > framesets( 0 ), frames_out( 0 );
+    std::thread consumer( [&]() {
+        while( true )
+        {
+            rs2::frameset fs;
+            if( sync.try_wait_for_frames( &fs, 100 ) )
+            {
+                ++framesets;
+                frames_out += fs.size();
+            }
+            else if( done )
+                break;
+        }
+    } );
+
+    std::vector< double > max_enqueue_us( streams.size() ), total_enqueue_us( streams.size() );
+    auto const start = clock_type::now();
+    std::vector< std::thread > producers;
+    for( size_t i = 0; i < streams.size(); ++i )
+        producers.emplace_back( [&, i]() {
+            auto & s = streams[i];
+            for( int n = 0; n < FRAMES; ++n )
+            {
+                auto const t0 = clock_type::now();
+                s.sensor.on_video_frame( { pixels.data(),
+                                           []( void * ) {},
+                                           W * BPP,
+                                           BPP,
+                                           n * 1000. / FPS,
+                                           RS2_TIMESTAMP_DOMAIN_HARDWARE_CLOCK,
+                                           n,
+                                           s.profile } );
+                double us = std::chrono::duration< double, std::micro >( clock_type::now() - t0 ).count();
+                total_enqueue_us[i] += us;
+                max_enqueue_us[i] = std::max( max_enqueue_us[i], us );
+            }
+        } );
+    for( auto & t : producers )
+        t.join();
+    auto const seconds = std::chrono::duration< double >( clock_type::now() - start ).count();
+    done = true;
+    consumer.join();
+
+    for( auto & s : streams )
+    {
+        s.sensor.stop();
+        s.sensor.close();
+    }
+
+    double total = 0, worst = 0;
+    for( size_t i = 0; i < streams.size(); ++i )
+    {
+        total += total_enqueue_us[i];
+        worst = std::max( worst, max_enqueue_us[i] );
+    }
+    std::cout << streams.size() << " streams x " << FRAMES << " frames in " << seconds << " s: "
+              << streams.size() * FRAMES / seconds << " frames/s in, " << framesets / seconds
+              << " framesets/s out (" << double( frames_out ) / std::max( 1LL, framesets.load() )
+              << " frames each)\n"
+              << "    on_video_frame: avg " << total / ( streams.size() * FRAMES ) << " us, max " << worst
+              << " us" << std::endl;
+
+    CHECK( framesets > 0 );
+}
@@ -79,6 +79,8 @@ def generate_cmake( builddir, testdir, testname, filelist, custom_main ):
     makefile = builddir + '/' + testdir + '/CMakeLists.txt'
     log.d( '   creating:', makefile )
     handle = open( makefile, 'w' )
+    # AVX2 kernels (src/proc/sse/avx-*.cpp) are built for AVX2, as they are in the library
+    avx_files = [f for f in filelist if os.path.basename( f ).startswith( 'avx-' ) and f.endswith( '.cpp' )]
     filelist = '\n    '.join( filelist )
     handle.write( '''
 # This file is automatically generated!!
@@ -102,6 +104,19 @@ set_target_properties( ''' + testname + ''' PROPERTIES FOLDER "Unit-Tests/''' +
 # Add the repo root directory (so includes into src/ will be specific: <src/...>)
 target_include_directories(''' + testname + ''' PRIVATE ''' + root + ''')
 
+''' )
+    if avx_files:
+        avx_files = '\n        '.join( avx_files )
+        handle.write( '''if(LRS_TRY_USE_AVX)
+    if(MSVC)
+        set_source_files_properties( ''' + avx_files + '''
+            PROPERTIES COMPILE_FLAGS /arch:AVX2 )
+    else()
+        set_source_files_properties( ''' + avx_files + '''
+            PROPERTIES COMPILE_FLAGS -mavx2 )
+    endif()
+endif()
+
 ''' )
     handle.close()
 
@@ -0,0 +1,149 @@
+// License: Apache 2.0. See LICENSE file in root directory.
+// Copyright(c) 2021 Intel Corporation. All Rights Reserved.
+
+#include <unit-tests/test.h>
+#include <librealsense2/utilities/time/timer.h>
+#include <librealsense2/utilities/concurrency/concurrency.h>
+
+#include <algorithm>
+#include <vector>
+
+using namespace utilities::time;
+
+TEST_CASE( "ring queue drops the oldest item when full" )
+{
+    std::vector< int > dropped;
+    ring_single_consumer_queue< int > q( 3, [&]( int const & i ) { dropped.push_back( i ); } );
+
+    for( int i = 0; i < 5; ++i )
+        REQUIRE( q.enqueue( std::move( i ) ) );
+
+    REQUIRE( q.size() == 3 );
+    REQUIRE( dropped == std::vector< int >{ 0, 1 } );
+
+    int val = -1;
+    REQUIRE( q.peek( [&]( int const & i ) { val = i; } ) );
+    REQUIRE( val == 2 );
+    for( int i = 2; i < 5; ++i )
+    {
+        REQUIRE( q.try_dequeue( &val ) );
+        REQUIRE( val == i );
+    }
+    REQUIRE_FALSE( q.try_dequeue( &val ) );
+    REQUIRE( q.empty() );
+}
+
+TEST_CASE( "ring queue stop" )
+{
+    int dropped = 0;
+    ring_single_consumer_queue< int > q( 10, [&]( int const & ) { ++dropped; } );
+
+    q.enqueue( 1 );
+    q.stop();
+    REQUIRE( q.stopped() );
+    REQUIRE( q.empty() );
+
+    // Items enqueued after a stop are dropped
+    REQUIRE_FALSE( q.enqueue( 2 ) );
+    REQUIRE_FALSE( q.blocking_enqueue( 3 ) );
+    REQUIRE( dropped == 2 );
+
+    // ... and a dequeue does not wait
+    stopwatch sw;
+    int val;
+    REQUIRE_FALSE( q.dequeue( &val, 2000 ) );
+    REQUIRE( sw.get_elapsed_ms() < 1000 );
+
+    q.start();
+    REQUIRE( q.enqueue( 4 ) );
+    REQUIRE( q.dequeue( &val, 1000 ) );
+    REQUIRE( val == 4 );
+}
+
+TEST_CASE( "ring queue wakes a waiting consumer" )
+{
+    ring_single_consumer_queue< int > q;
+    stopwatch sw;
+
+    std::thread producer( [&]() {
+        std::this_thread::sleep_for( std::chrono::milliseconds( 500 ) );
+        q.enqueue( 7 );
+    } );
+
+    int val = 0;
+    REQUIRE( q.dequeue( &val, 5000 ) );
+    REQUIRE( val == 7 );
+    REQUIRE( sw.get_elapsed_ms() < 2000 );
+    producer.join();
+}
+
+TEST_CASE( "ring queue blocking enqueue waits for room" )
+{
+    ring_single_consumer_queue< int > q( 2 );
+    stopwatch sw;
+
+    std::thread consumer( [&]() {
+        std::this_thread::sleep_for( std::chrono::milliseconds( 500 ) );
+        int val;
+        q.dequeue( &val, 1000 );
+    } );
+
+    REQUIRE( q.blocking_enqueue( 1 ) );
+    REQUIRE( q.blocking_enqueue( 2 ) );
+    REQUIRE( sw.get_elapsed_ms() < 500 );
+    REQUIRE( q.blocking_enqueue( 3 ) );  // waits for the consumer
+    REQUIRE( sw.get_elapsed_ms() >= 400 );
+    REQUIRE( q.size() == 2 );
+
+    consumer.join();
+}
+
+TEST_CASE( "ring queue with multiple producers" )
+{
+    ring_single_consumer_queue< int > q( 16 );
+
+    const int PRODUCERS = 4;
+    const int ITEMS_PER_PRODUCER = 10000;
+    std::vector< std::thread > producers;
+    for( int p = 0; p < PRODUCERS; ++p )
+        producers.emplace_back( [&, p]() {
+            for( int i = 0; i < ITEMS_PER_PRODUCER; ++i )
+                q.blocking_enqueue( p * ITEMS_PER_PRODUCER + i );
+        } );
+
+    // Nothing is lost, and each producer's items arrive in order
+    std::vector< int > last( PRODUCERS, -1 );
+    for( int n = 0; n < PRODUCERS * ITEMS_PER_PRODUCER; ++n )
+    {
+        int val;
+        REQUIRE( q.dequeue( &val, 5000 ) );
+        int p = val / ITEMS_PER_PRODUCER;
+        REQUIRE( val > last[p] );
+        last[p] = val;
+    }
+    REQUIRE( q.empty() );
+
+    for( auto & t : producers )
+        t.join();
+}
+
+TEST_CASE( "ring queue dequeue batch" )
+{
+    ring_single_consumer_queue< int > q;
+    std::vector< int > values;
+    auto collect = [&]( int && i ) { values.push_back( i ); };
+
+    for( int i = 0; i < 6; ++i )
+        q.enqueue( std::move( i ) );
+    REQUIRE( q.try_dequeue_batch( 4, collect ) == 4 );
+    REQUIRE( q.dequeue_batch( 4, 1000, collect ) == 2 );
+    REQUIRE( values == std::vector< int >{ 0, 1, 2, 3, 4, 5 } );
+
+    // With a wake threshold, a lone item is delivered once it waited long enough
+    q.set_wake_threshold( 3, std::chrono::milliseconds( 500 ) );
+    stopwatch sw;
+    q.enqueue( 6 );
+    REQUIRE( q.dequeue_batch( 4, 5000, collect ) == 1 );
+    REQUIRE( sw.get_elapsed_ms() >= 400 );
+    REQUIRE( sw.get_elapsed_ms() < 2000 );
+}
@@ -0,0 +1,69 @@
+// License: Apache 2.0. See LICENSE file in root directory.
+// Copyright(c) 2021 Intel Corporation. All Rights Reserved.
+
+// Compares per-hop latency and throughput of the mutex-based and the lock-free queues; it asserts
+// nothing about timing and is meant to be run by hand
+//#test:donotrun
+
+#include <unit-tests/test.h>
+#include <librealsense2/utilities/concurrency/concurrency.h>
+
+#include <algorithm>
+#include <chrono>
+#include <iomanip>
+#include <iostream>
+#include <vector>
+
+typedef std::chrono::steady_clock clock_type;
+
+// Each item carries the time it was enqueued, so the consumer can measure how long the hop took
+template< class Queue >
+void run_benchmark( char const * name, int producers )
+{
+    const int ITEMS_PER_PRODUCER = 200000;
+    Queue q( 64 );
+
+    std::vector< double > latencies;
+    latencies.reserve( producers * ITEMS_PER_PRODUCER );
+
+    auto const start = clock_type::now();
+    std::vector< std::thread > threads;
+    for( int p = 0; p < producers; ++p )
+        threads.emplace_back( [&]() {
+            for( int i = 0; i < ITEMS_PER_PRODUCER; ++i )
+                q.blocking_enqueue( clock_type::now().time_since_epoch().count() );
+        } );
+
+    for( int n = 0; n < producers * ITEMS_PER_PRODUCER; ++n )
+    {
+        clock_type::rep stamp;
+        REQUIRE( q.dequeue( &stamp, 5000 ) );
+        auto const now = clock_type::now().time_since_epoch().count();
+        latencies.push_back(
+            std::chrono::duration< double, std::micro >( clock_type::duration( now - stamp ) ).count() );
+    }
+    auto const elapsed = std::chrono::duration< double >( clock_type::now() - start ).count();
+
+    for( auto & t : threads )
+        t.join();
+
+    std::sort( latencies.begin(), latencies.end() );
+    double sum = 0;
+    for( auto l : latencies )
+        sum += l;
+
+    std::cout << std::left << std::setw( 28 ) << name << " producers=" << producers << std::fixed
+              << std::setprecision( 2 ) << "  throughput=" << latencies.size() / elapsed / 1e6
+              << " Mitems/s  latency mean=" << sum / latencies.size()
+              << "us p50=" << latencies[latencies.size() / 2]
+              << "us p99=" << latencies[latencies.size() * 99 / 100] << "us" << std::endl;
+}
+
+TEST_CASE( "queue hop benchmark" )
+{
+    for( int producers : { 1, 2, 4 } )
+    {
+        run_benchmark< single_consumer_queue< clock_type::rep > >( "single_consumer_queue", producers );
+        run_benchmark< ring_single_consumer_queue< clock_type::rep > >( "ring_single_consumer_queue", producers );
+    }
+}
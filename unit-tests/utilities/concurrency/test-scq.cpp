@@ -148,3 +148,50 @@ TEST_CASE("verify mutex protection")
     enqueue_thread1.join();
     enqueue_thread2.join();
 }
+
+TEST_CASE( "dequeue batch" )
+{
+    single_consumer_queue< int > scq;
+    std::vector< int > values;
+    auto collect = [&]( int && i ) { values.push_back( i ); };
+
+    REQUIRE( scq.try_dequeue_batch( 4, collect ) == 0 );  // nothing on queue
+
+    for( int i = 0; i < 6; ++i )
+        scq.enqueue( std::move( i ) );
+    REQUIRE( scq.try_dequeue_batch( 4, collect ) == 4 );  // no more than asked for
+    REQUIRE( scq.dequeue_batch( 4, 1000, collect ) == 2 );  // whatever is left
+    REQUIRE( values == std::vector< int >{ 0, 1, 2, 3, 4, 5 } );
+    REQUIRE( scq.empty() );
+
+    stopwatch sw;
+    REQUIRE( scq.dequeue_batch( 4, 500, collect ) == 0 );  // waits, then times out
+    REQUIRE( sw.get_elapsed_ms() >= 400 );
+}
+
+TEST_CASE( "wake threshold" )
+{
+    single_consumer_queue< int > scq;
+    scq.set_wake_threshold( 3, std::chrono::milliseconds( 500 ) );
+    std::vector< int > values;
+    auto collect = [&]( int && i ) { values.push_back( i ); };
+
+    // The consumer is not woken up before 3 items accumulated...
+    std::thread producer( [&]() {
+        for( int i = 0; i < 3; ++i )
+        {
+            std::this_thread::sleep_for( std::chrono::milliseconds( 50 ) );
+            scq.enqueue( std::move( i ) );
+        }
+    } );
+    REQUIRE( scq.dequeue_batch( 10, 5000, collect ) == 3 );
+    producer.join();
+
+    // ... unless the first of them waited too long
+    stopwatch sw;
+    scq.enqueue( 3 );
+    REQUIRE( scq.dequeue_batch( 10, 5000, collect ) == 1 );
+    REQUIRE( sw.get_elapsed_ms() >= 400 );
+    REQUIRE( sw.get_elapsed_ms() < 2000 );
+    REQUIRE( values == std::vector< int >{ 0, 1, 2, 3 } );
+}
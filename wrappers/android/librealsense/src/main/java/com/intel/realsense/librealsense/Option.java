@@ -95,7 +95,10 @@ public enum Option {
     OPTION_RECEIVER_SENSITIVITY(90),
     OPTION_AUTO_EXPOSURE_LIMIT_TOGGLE(91),
     OPTION_AUTO_GAIN_LIMIT_TOGGLE(92),
-    OPTION_EMITTER_FREQUENCY(93);
+    OPTION_EMITTER_FREQUENCY(93),
+    OPTION_ZERO_COPY(94),
+    OPTION_MOTION_SAMPLES_PER_FRAME(95),
+    OPTION_CONTROL_CACHE_MAX_AGE(96);
 
 
     private final int mValue;
@@ -192,6 +192,9 @@ PYBIND11_MODULE(NAME, m) {
         .value("exposure limit toggle", RS2_OPTION_AUTO_EXPOSURE_LIMIT_TOGGLE)
         .value("gain limit toggle", RS2_OPTION_AUTO_GAIN_LIMIT_TOGGLE)
         .value("emitter frequency", RS2_OPTION_EMITTER_FREQUENCY)
+        .value("zero copy", RS2_OPTION_ZERO_COPY)
+        .value("motion samples per frame", RS2_OPTION_MOTION_SAMPLES_PER_FRAME)
+        .value("control cache max age", RS2_OPTION_CONTROL_CACHE_MAX_AGE)
         .value("count", RS2_OPTION_COUNT);
 
     py::enum_<platform::power_state> power_state(m, "power_state");
@@ -36,7 +36,11 @@ void init_context(py::module &m) {
              "On successful load, the device will be appended to the context and a devices_changed event triggered.",
              "filename"_a)
         .def("unload_device", &rs2::context::unload_device, "filename"_a) // No docstring in C++
-        .def("unload_tracking_module", &rs2::context::unload_tracking_module); // No docstring in C++
+        .def("unload_tracking_module", &rs2::context::unload_tracking_module) // No docstring in C++
+        .def("set_executor", &rs2::context::set_executor, "Configure the worker threads that processing blocks attached "
+             "to this context process frames on.", "threads"_a, "cpus"_a = std::vector<int>())
+        .def("attach_executor", &rs2::context::attach_executor, "Have frames passed to a processing block processed on the "
+             "worker threads of this context rather than on the caller's thread.", "block"_a);
 
     // rs2::device_hub
     /** end rs_context.hpp **/
@@ -219,6 +219,10 @@ void init_frame(py::module &m) {
             return oss.str();
         });
 
+    py::class_<rs2::ply_exporter> ply_exporter(m, "ply_exporter", "Keeps the buffers of a PLY export for the next one, so that exporting "
+                                               "a sequence of point clouds of the same size does not allocate.");
+    ply_exporter.def(py::init<>());
+
     py::class_<rs2::points, rs2::frame> points(m, "points", "Extends the frame class with additional point cloud related attributes and functions.");
     points.def(py::init<>())
         .def(py::init<rs2::frame>())
@@ -252,7 +256,12 @@ void init_frame(py::module &m) {
                 throw std::domain_error("dims arg only supports values of 1, 2 or 3");
             }
         }, "Retrieve the texture coordinates (uv map) for the point cloud", py::keep_alive<0, 1>(), "dims"_a=1)
-        .def("export_to_ply", &rs2::points::export_to_ply, "Export the point cloud to a PLY file")
+        .def("export_to_ply", (void (rs2::points::*)(const std::string&, rs2::video_frame)) &rs2::points::export_to_ply, "Export the point cloud to a PLY file")
+        .def("export_to_ply", (void (rs2::points::*)(const std::string&, rs2::video_frame, bool, bool, float)) &rs2::points::export_to_ply,
+             "Export the point cloud to a binary PLY file, with or without the mesh and its normals", "fname"_a, "texture"_a, "mesh"_a, "normals"_a, "threshold"_a)
+        .def("export_to_ply", (void (rs2::points::*)(rs2::ply_exporter&, const std::string&, rs2::video_frame, bool, bool, float)) &rs2::points::export_to_ply,
+             "Export the point cloud to a binary PLY file, with the buffers of an exporter kept for the next export",
+             "exporter"_a, "fname"_a, "texture"_a, "mesh"_a = true, "normals"_a = false, "threshold"_a = 0.05f)
         .def("size", &rs2::points::size); // No docstring in C++
 
     py::class_<rs2::depth_frame, rs2::video_frame> depth_frame(m, "depth_frame", "Extends the video_frame class with additional depth related attributes and functions.");
@@ -268,7 +277,16 @@ void init_frame(py::module &m) {
     py::class_<rs2::motion_frame, rs2::frame> motion_frame(m, "motion_frame", "Extends the frame class with additional motion related attributes and functions");
     motion_frame.def(py::init<rs2::frame>())
         .def("get_motion_data", &rs2::motion_frame::get_motion_data, "Retrieve the motion data from IMU sensor.")
-        .def_property_readonly("motion_data", &rs2::motion_frame::get_motion_data, "Motion data from IMU sensor. Identical to calling get_motion_data.");
+        .def_property_readonly("motion_data", &rs2::motion_frame::get_motion_data, "Motion data from IMU sensor. Identical to calling get_motion_data.")
+        .def("get_sample_count", &rs2::motion_frame::get_sample_count, "Retrieve the number of IMU samples the frame carries.")
+        .def("get_motion_samples", [](const rs2::motion_frame& self) {
+            auto samples = self.get_motion_samples();
+            return std::vector<rs2_vector>(samples, samples + self.get_sample_count());
+        }, "Retrieve the motion data of all the samples the frame carries.")
+        .def("get_sample_timestamps", [](const rs2::motion_frame& self) {
+            auto timestamps = self.get_sample_timestamps();
+            return std::vector<double>(timestamps, timestamps + self.get_sample_count());
+        }, "Retrieve the timestamps of all the samples the frame carries.");
 
     py::class_<rs2::pose_frame, rs2::frame> pose_frame(m, "pose_frame", "Extends the frame class with additional pose related attributes and functions.");
     pose_frame.def(py::init<rs2::frame>())
@@ -23,5 +23,8 @@ PYBIND11_MODULE(NAME, m) {
     net_device.def(py::init<std::string>(), "address"_a)
         .def("add_to", &rs2::net_device::add_to, "Add net device to existing context.\n"
              "Any future queries on the context will return this device.\n"
-             "This operation cannot be undone (except for destroying the context)", "ctx"_a);
+             "This operation cannot be undone (except for destroying the context)", "ctx"_a)
+        .def_static("set_max_frame_buffers", &rs2::net_device::set_max_frame_buffers, "Limit the number of buffers net devices "
+             "receive frames of each size into (100 by default). Once that many are held, further frames of that size are "
+             "dropped until buffers are released.", "max_buffers"_a);
 }
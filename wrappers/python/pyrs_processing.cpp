@@ -41,6 +41,19 @@ void init_processing(py::module &m) {
             auto success = self.try_wait_for_frame(&frame, timeout_ms);
             return std::make_tuple(success, frame);
         }, "timeout_ms"_a = 5000, py::call_guard<py::gil_scoped_release>()) // No docstring in C++
+        .def("poll_for_frames_batch", [](const rs2::frame_queue &self, size_t max_frames) {
+            std::vector<rs2::frame> frames;
+            self.poll_for_frames_batch(frames, max_frames);
+            return frames;
+        }, "Dequeue all frames available in the queue, up to max_frames, at once", "max_frames"_a)
+        .def("try_wait_for_frames_batch", [](const rs2::frame_queue &self, size_t max_frames, unsigned int timeout_ms) {
+            std::vector<rs2::frame> frames;
+            self.try_wait_for_frames_batch(frames, max_frames, timeout_ms);
+            return frames;
+        }, "Wait until frames become available in the queue and dequeue them, up to max_frames, at once",
+            "max_frames"_a, "timeout_ms"_a = 5000, py::call_guard<py::gil_scoped_release>())
+        .def("set_wake_threshold", &rs2::frame_queue::set_wake_threshold, "Have a consumer waiting on the queue woken "
+             "only once this many frames are queued, or the first of them waited latency_us microseconds", "frames"_a, "latency_us"_a)
         .def("__call__", &rs2::frame_queue::operator(), "Identical to calling enqueue.", "f"_a)
         .def("capacity", &rs2::frame_queue::capacity, "Return the capacity of the queue.")
         .def("size", &rs2::frame_queue::size, "Number of enqueued frames.")
@@ -55,6 +68,13 @@ void init_processing(py::module &m) {
             self.start(f);
         }, "Start the processing block with callback function to inform the application the frame is processed.", "callback"_a)
         .def("invoke", &rs2::processing_block::invoke, "Ask processing block to process the frame", "f"_a)
+        .def("uses_executor", &rs2::processing_block::uses_executor, "Check whether frames passed to the processing block "
+             "are processed on the worker threads of a context.")
+        .def("set_stateless", &rs2::processing_block::set_stateless, "Declare that the processing block keeps no state "
+             "from one frame to the next, so that it may process several frames at once when attached to an executor.",
+             "stateless"_a = true)
+        .def("detach_executor", &rs2::processing_block::detach_executor, "Process frames passed to the processing block on "
+             "the caller's thread again.")
         .def("supports", (bool (rs2::processing_block::*)(rs2_camera_info) const) &rs2::processing_block::supports, "Check if a specific camera info field is supported.")
         .def("get_info", &rs2::processing_block::get_info, "Retrieve camera specific information, like versions of various internal components.");
         /*.def("__call__", &rs2::processing_block::operator(), "f"_a)*/
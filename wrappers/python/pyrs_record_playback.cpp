@@ -22,6 +22,11 @@ void init_record_playback(py::module &m) {
              "play the same way the file was recorded. If the application takes too long to handle the callback, frames may be dropped. In non real time "
              "mode, playback will wait for each callback to finish handling the data before reading the next frame. In this mode no frames will be dropped, "
              "and the application controls the framerate of playback via callback duration.", "real_time"_a)
+        .def("set_index_file", &rs2::playback::set_index_file, "Enables or disables the index sidecar file (<file>.idx) of the played file: the message "
+             "index is loaded from it when it matches the file, and it is created or replaced otherwise. Applies from the next time the file is reopened, "
+             "when the playback is stopped or resumed.", "enabled"_a)
+        .def("set_read_ahead", &rs2::playback::set_read_ahead, "Set how much data, in bytes, non real time playback may read from the file ahead "
+             "of the frames it raises, on a background thread; 0 disables reading ahead. Real time playback does not read ahead.", "bytes"_a)
         // set_playback_speed?
         .def("set_status_changed_callback", [](rs2::playback& self, std::function<void(rs2_playback_status)> callback) {
             self.set_status_changed_callback(callback);
@@ -30,11 +35,24 @@ void init_record_playback(py::module &m) {
         .def("current_status", &rs2::playback::current_status, "Returns the current state of the playback device");
     // Stop?
 
+    py::class_<rs2_record_statistics> record_statistics(m, "record_statistics", "Counters of the frames going through the write queue of a recorder.");
+    record_statistics.def(py::init<>())
+        .def_readonly("queued_bytes", &rs2_record_statistics::queued_bytes, "Frame data waiting to be written to the file")
+        .def_readonly("written_frames", &rs2_record_statistics::written_frames, "Frames written to the file")
+        .def_readonly("dropped_frames", &rs2_record_statistics::dropped_frames, "Frames dropped because the write queue was over its budget")
+        .def_readonly("max_write_latency", &rs2_record_statistics::max_write_latency, "Longest time, in milliseconds, from a frame's arrival to its write completing")
+        .def_readonly("average_write_latency", &rs2_record_statistics::average_write_latency, "Average time, in milliseconds, from a frame's arrival to its write completing");
+
     py::class_<rs2::recorder, rs2::device> recorder(m, "recorder", "Records the given device and saves it to the given file as rosbag format.");
     recorder.def(py::init<const std::string&, rs2::device>())
         .def(py::init<const std::string&, rs2::device, bool>())
         .def("pause", &rs2::recorder::pause, "Pause the recording device without stopping the actual device from streaming.")
-        .def("resume", &rs2::recorder::resume, "Unpauses the recording device, making it resume recording.");
+        .def("resume", &rs2::recorder::resume, "Unpauses the recording device, making it resume recording.")
+        .def("get_statistics", &rs2::recorder::get_statistics, "Counters of the frames going through the write queue of the recorder.")
+        .def("set_max_cached_data_size", &rs2::recorder::set_max_cached_data_size, "Sets the budget of the write queue of the recorder, in bytes: "
+             "frames arriving while more frame data than this is waiting to be written are dropped.", "max_cached_data_size"_a)
+        .def("set_index_file", &rs2::recorder::set_index_file, "Enables or disables writing a copy of the message index to a sidecar file "
+             "(<file>.idx) when the recording ends, for playback to load quickly.", "enabled"_a);
     // filename?
     /** end rs_record_playback.hpp **/
 }
@@ -36,6 +36,19 @@ void init_sensor(py::module &m) {
 
     // not binding notifications_callback, templated
 
+    py::class_<rs2_frame_pool_statistics> frame_pool_statistics(m, "frame_pool_statistics", "Counters of how well a sensor recycles the buffers of its frames.");
+    frame_pool_statistics.def(py::init<>())
+        .def_readonly("hits", &rs2_frame_pool_statistics::hits, "Frames whose buffer was recycled from a released frame")
+        .def_readonly("misses", &rs2_frame_pool_statistics::misses, "Frames that needed a new buffer")
+        .def_readonly("evictions", &rs2_frame_pool_statistics::evictions, "Released buffers freed because they were not reused in time")
+        .def_readonly("pooled", &rs2_frame_pool_statistics::pooled, "Released buffers currently waiting to be reused");
+
+    py::class_<rs2_control_cache_statistics> control_cache_statistics(m, "control_cache_statistics", "Counters of how many control transfers the caching of a sensor's option values and ranges saved.");
+    control_cache_statistics.def(py::init<>())
+        .def_readonly("transfers", &rs2_control_cache_statistics::transfers, "Control transfers made: value and range queries, and sets")
+        .def_readonly("values_saved", &rs2_control_cache_statistics::values_saved, "Value queries answered from the cache")
+        .def_readonly("ranges_saved", &rs2_control_cache_statistics::ranges_saved, "Range queries answered from the cache");
+
     py::class_<rs2::sensor, rs2::options> sensor(m, "sensor"); // No docstring in C++
     sensor.def("open", (void (rs2::sensor::*)(const rs2::stream_profile&) const) &rs2::sensor::open,
                "Open sensor for exclusive access, by commiting to a configuration", "profile"_a, py::call_guard<py::gil_scoped_release>())
@@ -66,6 +79,10 @@ void init_sensor(py::module &m) {
         .def("get_active_streams", &rs2::sensor::get_active_streams, "Retrieves the list of stream profiles currently streaming on the sensor.")
         .def_property_readonly("profiles", &rs2::sensor::get_stream_profiles, "The list of stream profiles supported by the sensor. Identical to calling get_stream_profiles")
         .def("get_recommended_filters", &rs2::sensor::get_recommended_filters, "Return the recommended list of filters by the sensor.")
+        .def("get_frame_pool_statistics", &rs2::sensor::get_frame_pool_statistics, "Retrieve how well the sensor recycles the buffers of its frames, "
+             "since it was last opened.")
+        .def("get_control_cache_statistics", &rs2::sensor::get_control_cache_statistics, "Retrieve how many control transfers the caching "
+             "of the sensor's option values and ranges saved, since it was created.")
         .def(py::init<>())
         .def("__nonzero__", &rs2::sensor::operator bool) // Called to implement truth value testing in Python 2
         .def("__bool__", &rs2::sensor::operator bool)    // Called to implement truth value testing in Python 3